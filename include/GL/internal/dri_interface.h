@@ -1288,6 +1288,11 @@ struct __DRIdri2ExtensionRec {
 #define __DRI_IMAGE_TRANSFER_WRITE           0x2
 #define __DRI_IMAGE_TRANSFER_READ_WRITE      \
         (__DRI_IMAGE_TRANSFER_READ | __DRI_IMAGE_TRANSFER_WRITE)
+/* Map the image storage directly instead of bouncing through a staging
+ * copy; mapImage fails if a direct map isn't possible. Matches
+ * GBM_BO_TRANSFER_DIRECT.
+ */
+#define __DRI_IMAGE_TRANSFER_DIRECT          0x4
 
 /**
  * Extra fourcc formats used internally to Mesa with createImageFromNames.
@@ -2615,6 +2615,16 @@ get_affinities(ra_ctx& ctx, std::vector<IDSet>& live_out_per_block)
    std::vector<std::vector<Temp>> phi_resources;
    std::unordered_map<unsigned, unsigned> temp_to_phi_resources;
 
+   /* Fast path for trivial shaders (blits, clears, tiny fragment shaders):
+    * a single-block program has no phis, so there are no affinities to
+    * build, and the live-out set is empty both before and after the
+    * live-out -> live-in conversion below.  Only the encoding hints
+    * (vectors, vcc, m0) need to be collected; skip the per-instruction
+    * liveness and merge-set bookkeeping that exists solely to feed phi
+    * coalescing.
+    */
+   const bool skip_phi_affinities = ctx.program->blocks.size() == 1;
+
    for (auto block_rit = ctx.program->blocks.rbegin(); block_rit != ctx.program->blocks.rend();
         block_rit++) {
       Block& block = *block_rit;
@@ -2663,6 +2673,9 @@ get_affinities(ra_ctx& ctx, std::vector<IDSet>& live_out_per_block)
             ctx.assignments[instr->operands[0].tempId()].m0 = true;
          }
 
+         if (skip_phi_affinities)
+            continue;
+
          /* add operands to live variables */
          for (const Operand& op : instr->operands) {
             if (op.isTemp())
@@ -22,8 +22,8 @@
 #define LDSDIR_MAX_MOVES    10
 #define LDS_MAX_MOVES       32
 /* creating clauses decreases def-use distances, so make it less aggressive the lower num_waves is */
-#define VMEM_CLAUSE_MAX_GRAB_DIST (ctx.num_waves * 2)
-#define VMEM_STORE_CLAUSE_MAX_GRAB_DIST (ctx.num_waves * 4)
+#define VMEM_CLAUSE_MAX_GRAB_DIST (ctx.num_waves * 2 * ctx.clause_grab_dist_fac)
+#define VMEM_STORE_CLAUSE_MAX_GRAB_DIST (ctx.num_waves * 4 * ctx.clause_grab_dist_fac)
 #define POS_EXP_MAX_MOVES         512
 
 namespace aco {
@@ -117,6 +117,11 @@ struct sched_ctx {
    MoveState mv;
    bool schedule_pos_exports = true;
    unsigned schedule_pos_export_div = 1;
+   /* Multiplier for the clause grab distances. Larger clauses improve
+    * memory-level parallelism on hardware with load clauses, at the cost of
+    * def-to-use distance, so this is only raised where latency hiding depends
+    * more on MLP than on occupancy. */
+   int16_t clause_grab_dist_fac = 1;
 };
 
 /* This scheduler is a simple bottom-up pass based on ideas from
@@ -1166,6 +1171,14 @@ schedule_VMEM_store(sched_ctx& ctx, Block* block, Instruction* current, int idx)
    return skip;
 }
 
+/* Scheduling is strictly intra-block: loop iterations are never overlapped
+ * here.  Classic modulo scheduling with rotated registers does not fit this
+ * pass -- it runs pre-RA on SSA, so there are no physical registers to
+ * rotate, and the spiller/RA have no notion of a kernel that is live across
+ * the backedge.  The supported way to overlap VMEM latency across iterations
+ * is to let NIR unroll the loop; once two iterations share a block, the VMEM
+ * window below interleaves their loads and ALU automatically.
+ */
 void
 schedule_block(sched_ctx& ctx, Program* program, Block* block)
 {
@@ -1281,6 +1294,16 @@ schedule_program(Program* program)
          ctx.schedule_pos_export_div = 4;
    }
 
+   /* On GFX11+, form_hard_clauses turns back-to-back loads into load clauses
+    * which keep several requests in flight, but it can only clause what this
+    * pass has already placed together. Bandwidth-bound compute shaders profit
+    * more from that memory-level parallelism than from the shorter def-to-use
+    * distances, so grab clause candidates from further away there. The
+    * register pressure checks in downwards_move() still bound the clauses.
+    */
+   if (program->gfx_level >= GFX11 && program->stage.hw == AC_HW_COMPUTE_SHADER)
+      ctx.clause_grab_dist_fac = 2;
+
    for (Block& block : program->blocks)
       schedule_block(ctx, program, &block);
 
@@ -255,6 +255,14 @@ radv_fill_buffer(struct radv_cmd_buffer *cmd_buffer, const struct radv_image *im
    return flush_bits;
 }
 
+/* Copies recorded on the transfer queue already go through the SDMA engine
+ * (radv_sdma.c), which is how apps get uploads to overlap gfx work. There is
+ * deliberately no automatic rerouting of large gfx-queue copies to SDMA: a
+ * command buffer must execute on the queue it was submitted to, and splitting
+ * it into internal SDMA submissions would break the ordering guarantees of
+ * everything recorded around the copy. On gfx/compute the best we can do is
+ * pick between a compute shader and CP DMA below.
+ */
 void
 radv_copy_buffer(struct radv_cmd_buffer *cmd_buffer, struct radeon_winsys_bo *src_bo, struct radeon_winsys_bo *dst_bo,
                  uint64_t src_offset, uint64_t dst_offset, uint64_t size)
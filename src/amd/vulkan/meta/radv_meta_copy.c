@@ -119,6 +119,14 @@ copy_buffer_to_image(struct radv_cmd_buffer *cmd_buffer, struct radv_buffer *buf
     */
    assert(image->vk.samples == 1);
 
+   /* Compute-only queues never fall back to graphics here: every copy
+    * recorded on them goes through the compute meta path below, and the
+    * universal queue also takes it when the destination isn't renderable.
+    * The per-slice dispatches in the loop further down stay separate on
+    * purpose -- each slice rebinds the surface at a different buffer
+    * offset, so a merged dispatch would just move the loop into the
+    * shader without saving any state changes.
+    */
    cs = cmd_buffer->qf == RADV_QUEUE_COMPUTE || !radv_image_is_renderable(device, image);
 
    /* VK_EXT_conditional_rendering says that copy commands should not be
@@ -1946,6 +1946,33 @@ radv_emit_compute_shader(const struct radv_physical_device *pdev, struct radeon_
    radeon_emit(cs, shader->info.regs.cs.compute_num_thread_z);
 }
 
+/* Same as radv_emit_compute_shader() but for the main cmdbuf IB, where the
+ * compute registers are shadowed so that switching back and forth between
+ * pipelines (or dispatching thousands of times) only emits what changed.
+ */
+static void
+radv_emit_compute_shader_state(struct radv_cmd_buffer *cmd_buffer, const struct radv_shader *shader)
+{
+   const struct radv_device *device = radv_cmd_buffer_device(cmd_buffer);
+   const struct radv_physical_device *pdev = radv_device_physical(device);
+   uint64_t va = radv_shader_get_va(shader);
+
+   radeon_opt_set_sh_reg(cmd_buffer, R_00B830_COMPUTE_PGM_LO, RADV_TRACKED_COMPUTE_PGM_LO, va >> 8);
+
+   radeon_opt_set_sh_reg2(cmd_buffer, R_00B848_COMPUTE_PGM_RSRC1, RADV_TRACKED_COMPUTE_PGM_RSRC1,
+                          shader->config.rsrc1, shader->config.rsrc2);
+   if (pdev->info.gfx_level >= GFX10) {
+      radeon_opt_set_sh_reg(cmd_buffer, R_00B8A0_COMPUTE_PGM_RSRC3, RADV_TRACKED_COMPUTE_PGM_RSRC3,
+                            shader->config.rsrc3);
+   }
+
+   radeon_opt_set_sh_reg(cmd_buffer, R_00B854_COMPUTE_RESOURCE_LIMITS, RADV_TRACKED_COMPUTE_RESOURCE_LIMITS,
+                         shader->info.regs.cs.compute_resource_limits);
+   radeon_opt_set_sh_reg3(cmd_buffer, R_00B81C_COMPUTE_NUM_THREAD_X, RADV_TRACKED_COMPUTE_NUM_THREAD_X,
+                          shader->info.regs.cs.compute_num_thread_x, shader->info.regs.cs.compute_num_thread_y,
+                          shader->info.regs.cs.compute_num_thread_z);
+}
+
 static void
 radv_emit_vgt_gs_mode(struct radv_cmd_buffer *cmd_buffer)
 {
@@ -7872,9 +7899,9 @@ radv_emit_compute_pipeline(struct radv_cmd_buffer *cmd_buffer, struct radv_compu
    radeon_check_space(device->ws, cmd_buffer->cs, pdev->info.gfx_level >= GFX10 ? 19 : 16);
 
    if (pipeline->base.type == RADV_PIPELINE_COMPUTE) {
-      radv_emit_compute_shader(pdev, cmd_buffer->cs, cmd_buffer->state.shaders[MESA_SHADER_COMPUTE]);
+      radv_emit_compute_shader_state(cmd_buffer, cmd_buffer->state.shaders[MESA_SHADER_COMPUTE]);
    } else {
-      radv_emit_compute_shader(pdev, cmd_buffer->cs, cmd_buffer->state.rt_prolog);
+      radv_emit_compute_shader_state(cmd_buffer, cmd_buffer->state.rt_prolog);
    }
 
    cmd_buffer->state.emitted_compute_pipeline = pipeline;
@@ -11606,6 +11633,12 @@ radv_CmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPre
    if (compute) {
       cmd_buffer->push_constant_stages |= VK_SHADER_STAGE_COMPUTE_BIT;
 
+      /* The generated IB writes the compute registers itself, so the shadowed
+       * values are unknown afterwards.
+       */
+      BITSET_CLEAR_RANGE(cmd_buffer->tracked_regs.reg_saved_mask, RADV_TRACKED_COMPUTE_PGM_LO,
+                         RADV_TRACKED_COMPUTE_START_Z);
+
       if (!pGeneratedCommandsInfo->pipeline)
          radv_mark_descriptor_sets_dirty(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE);
 
@@ -11699,15 +11732,19 @@ radv_emit_dispatch_packets(struct radv_cmd_buffer *cmd_buffer, const struct radv
          radv_cs_add_buffer(ws, cs, info->indirect);
 
       if (info->unaligned) {
-         radeon_set_sh_reg_seq(cs, R_00B81C_COMPUTE_NUM_THREAD_X, 3);
+         uint32_t num_thread_x, num_thread_y;
+
          if (pdev->info.gfx_level >= GFX12) {
-            radeon_emit(cs, S_00B81C_NUM_THREAD_FULL_GFX12(compute_shader->info.cs.block_size[0]));
-            radeon_emit(cs, S_00B820_NUM_THREAD_FULL_GFX12(compute_shader->info.cs.block_size[1]));
+            num_thread_x = S_00B81C_NUM_THREAD_FULL_GFX12(compute_shader->info.cs.block_size[0]);
+            num_thread_y = S_00B820_NUM_THREAD_FULL_GFX12(compute_shader->info.cs.block_size[1]);
          } else {
-            radeon_emit(cs, S_00B81C_NUM_THREAD_FULL_GFX6(compute_shader->info.cs.block_size[0]));
-            radeon_emit(cs, S_00B820_NUM_THREAD_FULL_GFX6(compute_shader->info.cs.block_size[1]));
+            num_thread_x = S_00B81C_NUM_THREAD_FULL_GFX6(compute_shader->info.cs.block_size[0]);
+            num_thread_y = S_00B820_NUM_THREAD_FULL_GFX6(compute_shader->info.cs.block_size[1]);
          }
-         radeon_emit(cs, S_00B824_NUM_THREAD_FULL(compute_shader->info.cs.block_size[2]));
+
+         radeon_opt_set_sh_reg3(cmd_buffer, R_00B81C_COMPUTE_NUM_THREAD_X, RADV_TRACKED_COMPUTE_NUM_THREAD_X,
+                                num_thread_x, num_thread_y,
+                                S_00B824_NUM_THREAD_FULL(compute_shader->info.cs.block_size[2]));
 
          dispatch_initiator |= S_00B800_USE_THREAD_DIMENSIONS(1);
       }
@@ -11806,19 +11843,19 @@ radv_emit_dispatch_packets(struct radv_cmd_buffer *cmd_buffer, const struct radv
             offsets[i] /= cs_block_size[i];
          }
 
-         radeon_set_sh_reg_seq(cs, R_00B81C_COMPUTE_NUM_THREAD_X, 3);
+         uint32_t num_thread_x, num_thread_y;
+
          if (pdev->info.gfx_level >= GFX12) {
-            radeon_emit(cs,
-                        S_00B81C_NUM_THREAD_FULL_GFX12(cs_block_size[0]) | S_00B81C_NUM_THREAD_PARTIAL(remainder[0]));
-            radeon_emit(cs,
-                        S_00B820_NUM_THREAD_FULL_GFX12(cs_block_size[1]) | S_00B820_NUM_THREAD_PARTIAL(remainder[1]));
+            num_thread_x = S_00B81C_NUM_THREAD_FULL_GFX12(cs_block_size[0]) | S_00B81C_NUM_THREAD_PARTIAL(remainder[0]);
+            num_thread_y = S_00B820_NUM_THREAD_FULL_GFX12(cs_block_size[1]) | S_00B820_NUM_THREAD_PARTIAL(remainder[1]);
          } else {
-            radeon_emit(cs,
-                        S_00B81C_NUM_THREAD_FULL_GFX6(cs_block_size[0]) | S_00B81C_NUM_THREAD_PARTIAL(remainder[0]));
-            radeon_emit(cs,
-                        S_00B820_NUM_THREAD_FULL_GFX6(cs_block_size[1]) | S_00B820_NUM_THREAD_PARTIAL(remainder[1]));
+            num_thread_x = S_00B81C_NUM_THREAD_FULL_GFX6(cs_block_size[0]) | S_00B81C_NUM_THREAD_PARTIAL(remainder[0]);
+            num_thread_y = S_00B820_NUM_THREAD_FULL_GFX6(cs_block_size[1]) | S_00B820_NUM_THREAD_PARTIAL(remainder[1]);
          }
-         radeon_emit(cs, S_00B824_NUM_THREAD_FULL(cs_block_size[2]) | S_00B824_NUM_THREAD_PARTIAL(remainder[2]));
+
+         radeon_opt_set_sh_reg3(cmd_buffer, R_00B81C_COMPUTE_NUM_THREAD_X, RADV_TRACKED_COMPUTE_NUM_THREAD_X,
+                                num_thread_x, num_thread_y,
+                                S_00B824_NUM_THREAD_FULL(cs_block_size[2]) | S_00B824_NUM_THREAD_PARTIAL(remainder[2]));
 
          dispatch_initiator |= S_00B800_PARTIAL_TG_EN(1);
       }
@@ -11843,10 +11880,8 @@ radv_emit_dispatch_packets(struct radv_cmd_buffer *cmd_buffer, const struct radv
       }
 
       if (offsets[0] || offsets[1] || offsets[2]) {
-         radeon_set_sh_reg_seq(cs, R_00B810_COMPUTE_START_X, 3);
-         radeon_emit(cs, offsets[0]);
-         radeon_emit(cs, offsets[1]);
-         radeon_emit(cs, offsets[2]);
+         radeon_opt_set_sh_reg3(cmd_buffer, R_00B810_COMPUTE_START_X, RADV_TRACKED_COMPUTE_START_X, offsets[0],
+                                offsets[1], offsets[2]);
 
          /* The blocks in the packet are not counts but end values. */
          for (unsigned i = 0; i < 3; ++i)
@@ -11905,7 +11940,7 @@ radv_emit_rt_stack_size(struct radv_cmd_buffer *cmd_buffer)
       rsrc2 |= S_00B12C_SCRATCH_EN(1);
 
    radeon_check_space(device->ws, cmd_buffer->cs, 3);
-   radeon_set_sh_reg(cmd_buffer->cs, R_00B84C_COMPUTE_PGM_RSRC2, rsrc2);
+   radeon_opt_set_sh_reg(cmd_buffer, R_00B84C_COMPUTE_PGM_RSRC2, RADV_TRACKED_COMPUTE_PGM_RSRC2, rsrc2);
 }
 
 static void
@@ -13724,8 +13759,6 @@ radv_bind_compute_shader(struct radv_cmd_buffer *cmd_buffer, struct radv_shader_
 {
    struct radv_shader *shader = shader_obj ? shader_obj->shader : NULL;
    struct radv_device *device = radv_cmd_buffer_device(cmd_buffer);
-   const struct radv_physical_device *pdev = radv_device_physical(device);
-   struct radeon_cmdbuf *cs = cmd_buffer->cs;
 
    radv_bind_shader(cmd_buffer, shader, MESA_SHADER_COMPUTE);
 
@@ -13734,7 +13767,7 @@ radv_bind_compute_shader(struct radv_cmd_buffer *cmd_buffer, struct radv_shader_
 
    ASSERTED const unsigned cdw_max = radeon_check_space(device->ws, cmd_buffer->cs, 128);
 
-   radv_emit_compute_shader(pdev, cs, shader);
+   radv_emit_compute_shader_state(cmd_buffer, shader);
 
    /* Update push constants/indirect descriptors state. */
    struct radv_descriptor_state *descriptors_state =
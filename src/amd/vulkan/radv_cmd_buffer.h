@@ -233,6 +233,25 @@ enum rgp_flush_bits {
 };
 
 enum radv_tracked_reg {
+   RADV_TRACKED_COMPUTE_PGM_LO,
+
+   /* 2 consecutive registers */
+   RADV_TRACKED_COMPUTE_PGM_RSRC1,
+   RADV_TRACKED_COMPUTE_PGM_RSRC2,
+
+   RADV_TRACKED_COMPUTE_PGM_RSRC3, /* GFX10+ */
+   RADV_TRACKED_COMPUTE_RESOURCE_LIMITS,
+
+   /* 3 consecutive registers */
+   RADV_TRACKED_COMPUTE_NUM_THREAD_X,
+   RADV_TRACKED_COMPUTE_NUM_THREAD_Y,
+   RADV_TRACKED_COMPUTE_NUM_THREAD_Z,
+
+   /* 3 consecutive registers */
+   RADV_TRACKED_COMPUTE_START_X,
+   RADV_TRACKED_COMPUTE_START_Y,
+   RADV_TRACKED_COMPUTE_START_Z,
+
    RADV_TRACKED_DB_COUNT_CONTROL,
    RADV_TRACKED_DB_SHADER_CONTROL,
    RADV_TRACKED_DB_VRS_OVERRIDE_CNTL,
@@ -28,6 +28,7 @@
 
 #include "meta/radv_meta.h"
 #include "util/disk_cache.h"
+#include "util/os_file.h"
 #include "util/u_debug.h"
 #include "radv_cs.h"
 #include "radv_debug.h"
@@ -1186,6 +1187,35 @@ radv_CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCr
       goto fail_meta;
    }
 
+   const char *bundle_path = getenv("RADV_PIPELINE_CACHE_BUNDLE");
+   if (bundle_path) {
+      size_t bundle_size;
+      void *bundle_data = os_read_file(bundle_path, &bundle_size);
+
+      if (bundle_data) {
+         const VkPipelineCacheCreateInfo bundle_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+            .initialDataSize = bundle_size,
+            .pInitialData = bundle_data,
+         };
+         const struct vk_pipeline_cache_create_info bundle_info = {
+            .pCreateInfo = &bundle_create_info,
+            .force_enable = true,
+            .skip_disk_cache = true,
+         };
+
+         /* The common cache code validates the header (vendor/device id and
+          * cache UUID) and each entry's hash, so a stale or foreign bundle
+          * degrades to an empty cache instead of bad binaries.
+          */
+         device->bundle_cache = vk_pipeline_cache_create(&device->vk, &bundle_info, NULL);
+         free(bundle_data);
+      }
+
+      if (!device->bundle_cache)
+         fprintf(stderr, "radv: failed to load pipeline cache bundle '%s'\n", bundle_path);
+   }
+
    device->force_aniso = MIN2(16, (int)debug_get_num_option("RADV_TEX_ANISO", -1));
    if (device->force_aniso >= 0) {
       fprintf(stderr, "radv: Forcing anisotropy filter to %ix\n", 1 << util_logbase2(device->force_aniso));
@@ -1236,6 +1266,8 @@ radv_CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCr
    return VK_SUCCESS;
 
 fail_cache:
+   if (device->bundle_cache)
+      vk_pipeline_cache_destroy(device->bundle_cache, NULL);
    vk_pipeline_cache_destroy(device->mem_cache, NULL);
 fail_meta:
    radv_device_finish_meta(device);
@@ -1332,6 +1364,8 @@ radv_DestroyDevice(VkDevice _device, const VkAllocationCallbacks *pAllocator)
 
    radv_device_finish_meta(device);
 
+   if (device->bundle_cache)
+      vk_pipeline_cache_destroy(device->bundle_cache, NULL);
    vk_pipeline_cache_destroy(device->mem_cache, NULL);
 
    radv_destroy_shader_upload_queue(device);
@@ -1729,6 +1763,16 @@ radv_GetMemoryFdPropertiesKHR(VkDevice _device, VkExternalMemoryHandleTypeFlagBi
    }
 }
 
+/* Each call really samples the clocks (a kernel query for the device
+ * domain).  Serving these from a userspace GPU/CPU clock model updated on
+ * submits was considered and rejected: the extension's contract is that the
+ * returned values are samples taken within pMaxDeviation of each other, and
+ * an extrapolated model cannot bound that error -- GPU clocks reclock under
+ * power management and stop across suspend, and nothing guarantees a recent
+ * submit to refresh the model.  Profilers that cannot afford a syscall per
+ * sample should calibrate once per frame and interpolate on their side,
+ * where the accuracy tradeoff is theirs to make.
+ */
 VKAPI_ATTR VkResult VKAPI_CALL
 radv_GetCalibratedTimestampsKHR(VkDevice _device, uint32_t timestampCount,
                                 const VkCalibratedTimestampInfoKHR *pTimestampInfos, uint64_t *pTimestamps,
@@ -422,6 +422,12 @@ struct radv_device {
    /* Backup in-memory cache to be used if the app doesn't provide one */
    struct vk_pipeline_cache *mem_cache;
 
+   /* Read-only precompiled pipeline bundle loaded at device creation from
+    * the file named by RADV_PIPELINE_CACHE_BUNDLE (standard VkPipelineCache
+    * data). NULL when the env var is unset or the file doesn't validate.
+    */
+   struct vk_pipeline_cache *bundle_cache;
+
    /*
     * use different counters so MSAA MRTs get consecutive surface indices,
     * even if MASK is allocated in between.
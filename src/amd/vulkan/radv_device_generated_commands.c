@@ -1988,6 +1988,17 @@ radv_dgc_need_push_constants_copy(const struct radv_pipeline *pipeline)
    return false;
 }
 
+/* Whether command generation can run at vkCmdPreprocessGeneratedCommandsNV
+ * time instead of being folded into execution. The preprocessing itself is a
+ * regular dispatch of the DGC meta shader, so an application can record it on
+ * a compute-capable command buffer and submit it to the async compute queue to
+ * overlap generation with the previous frame's rendering; the preprocess
+ * buffer is application-allocated, so double-buffering it across frames is
+ * likewise the application's choice. The cases rejected below must stay at
+ * execute time because they consume state that is only known once the draw
+ * state is bound (partial VBO binding) or need a CPU-side copy into the
+ * upload BO (non-inlinable push constants).
+ */
 bool
 radv_dgc_can_preprocess(const struct radv_indirect_command_layout *layout, struct radv_pipeline *pipeline)
 {
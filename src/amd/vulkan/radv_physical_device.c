@@ -969,6 +969,13 @@ radv_physical_device_get_features(const struct radv_physical_device *pdev, struc
       .accelerationStructure = true,
       .accelerationStructureCaptureReplay = true,
       .accelerationStructureIndirectBuild = false,
+      /* Host commands would need a CPU implementation of the whole BVH
+       * pipeline (morton sort, LBVH/PLOC, encode into the HW node layout
+       * from bvh/bvh.h), which only exists as compute shaders today. A
+       * host builder would also have to produce bit-identical BVHs
+       * regardless of thread count to stay compatible with capture/replay
+       * and trace caching, so the GPU path is used unconditionally.
+       */
       .accelerationStructureHostCommands = false,
       .descriptorBindingAccelerationStructureUpdateAfterBind = true,
 
@@ -878,6 +878,34 @@ radv_GetPipelineExecutableStatisticsKHR(VkDevice _device, const VkPipelineExecut
    }
    ++s;
 
+   if (pipeline->type == RADV_PIPELINE_GRAPHICS) {
+      const struct radv_graphics_pipeline *graphics_pipeline = radv_pipeline_to_graphics(pipeline);
+
+      if (s < end) {
+         desc_copy(s->name, "Fast-linked");
+         desc_copy(s->description, "Whether the pipeline was fast-linked from graphics pipeline libraries");
+         s->format = VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_BOOL32_KHR;
+         s->value.b32 = graphics_pipeline->link.fast_linked;
+      }
+      ++s;
+
+      if (s < end) {
+         desc_copy(s->name, "Link duration");
+         desc_copy(s->description, "Time spent linking/compiling the pipeline in nanoseconds");
+         s->format = VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_UINT64_KHR;
+         s->value.u64 = graphics_pipeline->link.duration;
+      }
+      ++s;
+
+      if (s < end) {
+         desc_copy(s->name, "Retained shader stages");
+         desc_copy(s->description, "Number of shader stages reused from graphics pipeline libraries");
+         s->format = VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_UINT64_KHR;
+         s->value.u64 = util_bitcount(graphics_pipeline->link.retained_stages);
+      }
+      ++s;
+   }
+
    if (s < end) {
       desc_copy(s->name, "SGPRs");
       desc_copy(s->description, "Number of SGPR registers allocated per subgroup");
@@ -321,6 +321,14 @@ radv_pipeline_cache_object_search(struct radv_device *device, struct vk_pipeline
    struct vk_pipeline_cache_object *object =
       vk_pipeline_cache_lookup_object(cache, pipeline->sha1, SHA1_DIGEST_LENGTH, &radv_pipeline_ops, found);
 
+   /* Fall back to the precompiled bundle; entries deserialize lazily on first
+    * use, so an untouched bundle costs nothing beyond its raw data.
+    */
+   if (!object && device->bundle_cache) {
+      object = vk_pipeline_cache_lookup_object(device->bundle_cache, pipeline->sha1, SHA1_DIGEST_LENGTH,
+                                               &radv_pipeline_ops, NULL);
+   }
+
    radv_report_pso_cache_stats(device, pipeline, !!object);
 
    if (!object)
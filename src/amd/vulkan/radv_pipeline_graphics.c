@@ -3055,6 +3055,7 @@ radv_graphics_pipeline_init(struct radv_graphics_pipeline *pipeline, struct radv
    bool fast_linking_enabled = radv_is_fast_linking_enabled(pipeline, pCreateInfo);
    struct vk_graphics_pipeline_state state = {0};
    VkResult result = VK_SUCCESS;
+   int64_t link_start = os_time_get_nano();
 
    pipeline->last_vgt_api_stage = MESA_SHADER_NONE;
 
@@ -3083,6 +3084,14 @@ radv_graphics_pipeline_init(struct radv_graphics_pipeline *pipeline, struct radv
 
          needed_lib_flags &= ~gfx_pipeline_lib->lib_flags;
       }
+
+      /* Shaders that are referenced at this point were retained from the
+       * libraries; anything compiled below is a link-time (re)compile.
+       */
+      for (unsigned s = 0; s < MESA_VULKAN_SHADER_STAGES; s++) {
+         if (pipeline->base.shaders[s])
+            pipeline->link.retained_stages |= mesa_to_vk_shader_stage(s);
+      }
    }
 
    /* Import graphics pipeline info that was not included in the libraries. */
@@ -3147,6 +3156,9 @@ radv_graphics_pipeline_init(struct radv_graphics_pipeline *pipeline, struct radv
       radv_pipeline_init_extra(pipeline, extra, &state);
    }
 
+   pipeline->link.fast_linked = fast_linking_enabled;
+   pipeline->link.duration = os_time_get_nano() - link_start;
+
    return result;
 }
 
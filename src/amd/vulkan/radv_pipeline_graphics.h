@@ -111,6 +111,15 @@ struct radv_graphics_pipeline {
    /* For vk_graphics_pipeline_state */
    void *state_data;
 
+   /* Link instrumentation for VK_EXT_graphics_pipeline_library, exposed
+    * through VK_KHR_pipeline_executable_properties.
+    */
+   struct {
+      uint64_t duration; /* nanoseconds spent linking/compiling */
+      VkShaderStageFlags retained_stages; /* stages imported from libraries */
+      bool fast_linked;
+   } link;
+
    /* Custom blend mode for internal operations. */
    unsigned custom_blend_mode;
 
@@ -46,73 +46,71 @@ radv_get_queue_global_priority(const VkDeviceQueueGlobalPriorityCreateInfoKHR *p
    }
 }
 
+/* Apply an array of VkSparseMemoryBind ranges, merging runs of consecutive
+ * binds that are contiguous in both the resource and the backing memory
+ * (or contiguously unbound) into one VA operation each.  Virtual-texturing
+ * engines bind thousands of adjacent 64KB pages at once, so the merge
+ * regularly turns them into a handful of amdgpu VA ioctls.
+ */
 static VkResult
-radv_sparse_buffer_bind_memory(struct radv_device *device, const VkSparseBufferMemoryBindInfo *bind)
+radv_sparse_bind_ranges(struct radv_device *device, struct vk_object_base *object, struct radeon_winsys_bo *bo,
+                        const VkSparseMemoryBind *binds, uint32_t bind_count)
 {
-   VK_FROM_HANDLE(radv_buffer, buffer, bind->buffer);
    VkResult result = VK_SUCCESS;
 
    struct radv_device_memory *mem = NULL;
    VkDeviceSize resourceOffset = 0;
    VkDeviceSize size = 0;
    VkDeviceSize memoryOffset = 0;
-   for (uint32_t i = 0; i < bind->bindCount; ++i) {
+   for (uint32_t i = 0; i < bind_count; ++i) {
       struct radv_device_memory *cur_mem = NULL;
 
-      if (bind->pBinds[i].memory != VK_NULL_HANDLE)
-         cur_mem = radv_device_memory_from_handle(bind->pBinds[i].memory);
+      if (binds[i].memory != VK_NULL_HANDLE)
+         cur_mem = radv_device_memory_from_handle(binds[i].memory);
       if (i && mem == cur_mem) {
          if (mem) {
-            if (bind->pBinds[i].resourceOffset == resourceOffset + size &&
-                bind->pBinds[i].memoryOffset == memoryOffset + size) {
-               size += bind->pBinds[i].size;
+            if (binds[i].resourceOffset == resourceOffset + size && binds[i].memoryOffset == memoryOffset + size) {
+               size += binds[i].size;
                continue;
             }
          } else {
-            if (bind->pBinds[i].resourceOffset == resourceOffset + size) {
-               size += bind->pBinds[i].size;
+            if (binds[i].resourceOffset == resourceOffset + size) {
+               size += binds[i].size;
                continue;
             }
          }
       }
       if (size) {
-         result = radv_bo_virtual_bind(device, &buffer->vk.base, buffer->bo, resourceOffset, size, mem ? mem->bo : NULL,
-                                       memoryOffset);
+         result = radv_bo_virtual_bind(device, object, bo, resourceOffset, size, mem ? mem->bo : NULL, memoryOffset);
          if (result != VK_SUCCESS)
             return result;
       }
       mem = cur_mem;
-      resourceOffset = bind->pBinds[i].resourceOffset;
-      size = bind->pBinds[i].size;
-      memoryOffset = bind->pBinds[i].memoryOffset;
+      resourceOffset = binds[i].resourceOffset;
+      size = binds[i].size;
+      memoryOffset = binds[i].memoryOffset;
    }
    if (size) {
-      result = radv_bo_virtual_bind(device, &buffer->vk.base, buffer->bo, resourceOffset, size, mem ? mem->bo : NULL,
-                                    memoryOffset);
+      result = radv_bo_virtual_bind(device, object, bo, resourceOffset, size, mem ? mem->bo : NULL, memoryOffset);
    }
 
    return result;
 }
 
 static VkResult
-radv_sparse_image_opaque_bind_memory(struct radv_device *device, const VkSparseImageOpaqueMemoryBindInfo *bind)
+radv_sparse_buffer_bind_memory(struct radv_device *device, const VkSparseBufferMemoryBindInfo *bind)
 {
-   VK_FROM_HANDLE(radv_image, image, bind->image);
-   VkResult result;
-
-   for (uint32_t i = 0; i < bind->bindCount; ++i) {
-      struct radv_device_memory *mem = NULL;
+   VK_FROM_HANDLE(radv_buffer, buffer, bind->buffer);
 
-      if (bind->pBinds[i].memory != VK_NULL_HANDLE)
-         mem = radv_device_memory_from_handle(bind->pBinds[i].memory);
+   return radv_sparse_bind_ranges(device, &buffer->vk.base, buffer->bo, bind->pBinds, bind->bindCount);
+}
 
-      result = radv_bo_virtual_bind(device, &image->vk.base, image->bindings[0].bo, bind->pBinds[i].resourceOffset,
-                                    bind->pBinds[i].size, mem ? mem->bo : NULL, bind->pBinds[i].memoryOffset);
-      if (result != VK_SUCCESS)
-         return result;
-   }
+static VkResult
+radv_sparse_image_opaque_bind_memory(struct radv_device *device, const VkSparseImageOpaqueMemoryBindInfo *bind)
+{
+   VK_FROM_HANDLE(radv_image, image, bind->image);
 
-   return VK_SUCCESS;
+   return radv_sparse_bind_ranges(device, &image->vk.base, image->bindings[0].bo, bind->pBinds, bind->bindCount);
 }
 
 static VkResult
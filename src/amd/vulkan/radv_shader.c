@@ -159,7 +159,7 @@ radv_optimize_nir(struct nir_shader *shader, bool optimize_conservatively)
       }
       NIR_LOOP_PASS_NOT_IDEMPOTENT(progress, skip, shader, nir_opt_if, nir_opt_if_optimize_phi_true_false);
       NIR_LOOP_PASS(progress, skip, shader, nir_opt_cse);
-      NIR_LOOP_PASS(progress, skip, shader, nir_opt_peephole_select, 8, true, true);
+      NIR_LOOP_PASS(progress, skip, shader, nir_opt_peephole_select, 8, 16, true, true);
       NIR_LOOP_PASS(progress, skip, shader, nir_opt_constant_folding);
       NIR_LOOP_PASS(progress, skip, shader, nir_opt_intrinsics);
       NIR_LOOP_PASS_NOT_IDEMPOTENT(progress, skip, shader, nir_opt_algebraic);
@@ -1003,6 +1003,13 @@ insert_block(struct radv_device *device, union radv_shader_arena_block *hole, ui
  * Typically, shaders are allocated and only free'd when the device is destroyed. For this pattern,
  * this should allocate blocks for shaders fast and with no fragmentation, while still allowing
  * free'd memory to be re-used.
+ *
+ * Placement is creation order and stays that way: re-packing hot shaders into contiguous pages
+ * from execution-frequency feedback is not possible after the fact, because a shader's VA is
+ * baked into bound pipelines, prolog/epilog links, RT shader group handles and capture/replay
+ * addresses, so moving code would require stopping all queues and patching every reference.
+ * Applications effectively opt into hot/cold locality already: pipelines created together (e.g.
+ * per level/material batch) land adjacently here.
  */
 union radv_shader_arena_block *
 radv_alloc_shader_memory(struct radv_device *device, uint32_t size, bool replayable, void *ptr)
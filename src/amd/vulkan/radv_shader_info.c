@@ -189,6 +189,13 @@ gather_intrinsic_store_output_info(const nir_shader *nir, const nir_intrinsic_in
    }
 }
 
+/* Collects which push constant dwords can be inlined into user SGPRs. This
+ * is radv's flavor of push promotion; anv's counterpart pushes whole UBO
+ * ranges via anv_nir_compute_push_layout(). The analyses look similar but
+ * are kept driver-local because what "promoted" means — SGPR user data here,
+ * 3DSTATE_CONSTANT ranges there — and the command-buffer tracking that goes
+ * with it differ completely between the drivers.
+ */
 static void
 gather_push_constant_info(const nir_shader *nir, const nir_intrinsic_instr *instr, struct radv_shader_info *info)
 {
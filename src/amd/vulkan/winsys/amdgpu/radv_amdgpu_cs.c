@@ -10,6 +10,7 @@
 #include <libsync.h>
 #include <pthread.h>
 #include <stdlib.h>
+#include <xf86drm.h>
 #include "drm-uapi/amdgpu_drm.h"
 
 #include "util/detect_os.h"
@@ -1170,12 +1171,37 @@ radv_amdgpu_cs_submit_zero(struct radv_amdgpu_ctx *ctx, enum amd_ip_type ip_type
 {
    unsigned hw_ip = ip_type;
    unsigned queue_syncobj = radv_amdgpu_ctx_queue_syncobj(ctx, hw_ip, queue_idx);
+   const int dev_fd = amdgpu_device_get_fd(ctx->ws->dev);
    int ret;
 
    if (!queue_syncobj)
       return VK_ERROR_OUT_OF_HOST_MEMORY;
 
    if (sem_info->wait.syncobj_count || sem_info->wait.timeline_syncobj_count) {
+      /* Poll all wait fences with a zero-timeout array wait first.  Under
+       * submission-heavy workloads they have usually signalled by now, and
+       * one ioctl replaces the export/merge/import ioctl per syncobj below.
+       * Already-signalled fences also don't need to be accumulated into the
+       * queue syncobj at all: waiting on them is a no-op.
+       */
+      bool all_signaled = true;
+
+      if (sem_info->wait.syncobj_count) {
+         ret = drmSyncobjWait(dev_fd, sem_info->wait.syncobj, sem_info->wait.syncobj_count, 0,
+                              DRM_SYNCOBJ_WAIT_FLAGS_WAIT_ALL, NULL);
+         all_signaled = ret == 0;
+      }
+
+      if (all_signaled && sem_info->wait.timeline_syncobj_count) {
+         ret = drmSyncobjTimelineWait(dev_fd, sem_info->wait.syncobj + sem_info->wait.syncobj_count,
+                                      sem_info->wait.points, sem_info->wait.timeline_syncobj_count, 0,
+                                      DRM_SYNCOBJ_WAIT_FLAGS_WAIT_ALL, NULL);
+         all_signaled = ret == 0;
+      }
+
+      if (all_signaled)
+         goto signal;
+
       int fd;
       ret = amdgpu_cs_syncobj_export_sync_file(ctx->ws->dev, queue_syncobj, &fd);
       if (ret < 0)
@@ -1222,6 +1248,29 @@ radv_amdgpu_cs_submit_zero(struct radv_amdgpu_ctx *ctx, enum amd_ip_type ip_type
       ctx->queue_syncobj_wait[hw_ip][queue_idx] = true;
    }
 
+signal:
+   /* If the queue syncobj has already signalled, there is no pending work on
+    * this queue for the signal semaphores to wait for, so they can all be
+    * flipped with one array ioctl instead of one transfer ioctl each.
+    */
+   if (sem_info->signal.syncobj_count || sem_info->signal.timeline_syncobj_count) {
+      ret = drmSyncobjWait(dev_fd, &queue_syncobj, 1, 0, DRM_SYNCOBJ_WAIT_FLAGS_WAIT_ALL, NULL);
+      if (ret == 0) {
+         if (sem_info->signal.syncobj_count) {
+            ret = drmSyncobjSignal(dev_fd, sem_info->signal.syncobj, sem_info->signal.syncobj_count);
+            if (ret < 0)
+               return VK_ERROR_DEVICE_LOST;
+         }
+         if (sem_info->signal.timeline_syncobj_count) {
+            ret = drmSyncobjTimelineSignal(dev_fd, sem_info->signal.syncobj + sem_info->signal.syncobj_count,
+                                           sem_info->signal.points, sem_info->signal.timeline_syncobj_count);
+            if (ret < 0)
+               return VK_ERROR_DEVICE_LOST;
+         }
+         return VK_SUCCESS;
+      }
+   }
+
    for (unsigned i = 0; i < sem_info->signal.syncobj_count; ++i) {
       uint32_t dst_handle = sem_info->signal.syncobj[i];
       uint32_t src_handle = queue_syncobj;
@@ -2577,6 +2577,13 @@ agx_set_st_vary_final(agx_context *ctx)
    agx_no_varyings(&_b);
 }
 
+/* Shader-db style codegen-quality report, printed with AGX_MESA_DEBUG=shaderdb
+ * and also fed to the driver's debug callback.  The cycle numbers come from
+ * the static cost model in agx_performance.c (ALU, F16/SCIB and IC estimates
+ * over the scheduled IR) and the thread count from the occupancy table keyed
+ * on register demand, so regressions in any of them show up in shader-db
+ * diffs.
+ */
 static int
 agx_dump_stats(agx_context *ctx, unsigned size, char **out)
 {
@@ -2680,7 +2687,7 @@ agx_optimize_loop_nir(nir_shader *nir)
       NIR_PASS(progress, nir, nir_opt_dce);
       NIR_PASS(progress, nir, nir_opt_dead_cf);
       NIR_PASS(progress, nir, nir_opt_cse);
-      NIR_PASS(progress, nir, nir_opt_peephole_select, 64, false, true);
+      NIR_PASS(progress, nir, nir_opt_peephole_select, 64, 64, false, true);
       NIR_PASS(progress, nir, nir_opt_phi_precision);
       NIR_PASS(progress, nir, nir_opt_algebraic);
       NIR_PASS(progress, nir, nir_opt_constant_folding);
@@ -2765,7 +2772,7 @@ agx_optimize_nir(nir_shader *nir, unsigned *preamble_size)
     *
     * We need to lower int64 again to deal with the resulting 64-bit csels.
     */
-   NIR_PASS(_, nir, nir_opt_peephole_select, 64, false, true);
+   NIR_PASS(_, nir, nir_opt_peephole_select, 64, 64, false, true);
    NIR_PASS(_, nir, nir_lower_int64);
 
    NIR_PASS(_, nir, nir_opt_algebraic_late);
@@ -2660,7 +2660,7 @@ glsl_float64_funcs_to_nir(struct gl_context *ctx,
    NIR_PASS(_, nir, nir_opt_dce);
    NIR_PASS(_, nir, nir_opt_cse);
    NIR_PASS(_, nir, nir_opt_gcm, true);
-   NIR_PASS(_, nir, nir_opt_peephole_select, 1, false, false);
+   NIR_PASS(_, nir, nir_opt_peephole_select, 1, 1, false, false);
    NIR_PASS(_, nir, nir_opt_dce);
 
    return nir;
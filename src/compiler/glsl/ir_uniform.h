@@ -66,6 +66,13 @@ struct gl_uniform_driver_storage {
     * Pointer to the base of the data.
     */
    void *data;
+
+   /**
+    * Parameter list that \c data points into, if any.  Used to mark the
+    * written range dirty so the constant buffer upload can be skipped when
+    * nothing changed.
+    */
+   struct gl_program_parameter_list *params;
 };
 
 struct gl_opaque_uniform_index {
@@ -90,6 +90,8 @@ static const struct debug_named_value nir_debug_control[] = {
      "Print shaders even if they are marked as internal" },
    { "print_pass_flags", NIR_DEBUG_PRINT_PASS_FLAGS,
      "Print pass_flags for every instruction when pass_flags are non-zero" },
+   { "unroll", NIR_DEBUG_UNROLL,
+     "Print loop unrolling decisions (trip count, estimated cost, limit)" },
    DEBUG_NAMED_VALUE_END
 };
 
@@ -91,6 +91,7 @@ extern bool nir_debug_print_shader[MESA_SHADER_KERNEL + 1];
 #define NIR_DEBUG_PRINT_NO_INLINE_CONSTS (1u << 20)
 #define NIR_DEBUG_PRINT_INTERNAL         (1u << 21)
 #define NIR_DEBUG_PRINT_PASS_FLAGS       (1u << 22)
+#define NIR_DEBUG_UNROLL                 (1u << 23)
 
 #define NIR_DEBUG_PRINT (NIR_DEBUG_PRINT_VS |  \
                          NIR_DEBUG_PRINT_TCS | \
@@ -4236,6 +4237,16 @@ typedef struct nir_shader_compiler_options {
     * varying_expression_max_cost(), the instruction is moved.
     */
    unsigned (*varying_estimate_instr_cost)(struct nir_instr *instr);
+
+   /**
+    * Return the estimated cost of an instruction for the loop unrolling
+    * heuristic, in units of one cheap 32-bit ALU instruction, typically
+    * derived from the backend's latency/size tables. When set, this
+    * replaces the generic per-op estimate in nir_loop_analyze.c; the
+    * induction-variable analysis that discounts instructions eliminated by
+    * unrolling still applies. Leave NULL to use the generic estimate.
+    */
+   unsigned (*unroll_estimate_instr_cost)(struct nir_instr *instr);
 } nir_shader_compiler_options;
 
 typedef struct nir_shader {
@@ -6622,6 +6633,7 @@ typedef struct {
 bool nir_opt_offsets(nir_shader *shader, const nir_opt_offsets_options *options);
 
 bool nir_opt_peephole_select(nir_shader *shader, unsigned limit,
+                             unsigned divergent_limit,
                              bool indirect_load_ok, bool expensive_alu_ok);
 
 bool nir_opt_reassociate_bfi(nir_shader *shader);
@@ -6643,6 +6655,8 @@ bool nir_lower_undef_to_zero(nir_shader *shader);
 
 bool nir_opt_uniform_atomics(nir_shader *shader);
 
+bool nir_opt_uniform_loads(nir_shader *shader);
+
 bool nir_opt_uniform_subgroup(nir_shader *shader,
                               const nir_lower_subgroups_options *);
 
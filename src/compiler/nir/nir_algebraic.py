@@ -1163,6 +1163,7 @@ static const uint16_t ${pass_name}_transform_offsets[] = {
 static const nir_algebraic_table ${pass_name}_table = {
    .transforms = ${pass_name}_transforms,
    .transform_offsets = ${pass_name}_transform_offsets,
+   .num_automaton_states = ARRAY_SIZE(${pass_name}_transform_offsets),
    .pass_op_table = ${pass_name}_pass_op_table,
    .values = ${pass_name}_values,
    .expression_cond = ${ pass_name + "_expression_cond" if expression_cond else "NULL" },
@@ -751,7 +751,8 @@ nir_instr_set_destroy(struct set *instr_set)
 bool
 nir_instr_set_add_or_rewrite(struct set *instr_set, nir_instr *instr,
                              bool (*cond_function)(const nir_instr *a,
-                                                   const nir_instr *b))
+                                                   const nir_instr *b),
+                             struct exec_list *dead_instrs)
 {
    if (!instr_can_rewrite(instr))
       return false;
@@ -779,6 +780,8 @@ nir_instr_set_add_or_rewrite(struct set *instr_set, nir_instr *instr,
       nir_def_rewrite_uses(def, new_def);
 
       nir_instr_remove(instr);
+      if (dead_instrs)
+         exec_list_push_tail(dead_instrs, &instr->node);
 
       return true;
    } else {
@@ -54,10 +54,16 @@ void nir_instr_set_destroy(struct set *instr_set);
  *
  * If cond_function() is given, only rewrites uses if
  * cond_function(old_instr, new_instr) returns true.
+ *
+ * If dead_instrs is given, rewritten instructions are appended to it instead
+ * of being left for a later DCE, so the caller can bulk-free them with
+ * nir_instr_free_list() and return their storage to the shader's instruction
+ * arena while the pass is still running.
  */
 bool nir_instr_set_add_or_rewrite(struct set *instr_set, nir_instr *instr,
                                   bool (*cond_function)(const nir_instr *a,
-                                                        const nir_instr *b));
+                                                        const nir_instr *b),
+                                  struct exec_list *dead_instrs);
 
 /**
  * Removes an instruction from an instruction set, so that other instructions
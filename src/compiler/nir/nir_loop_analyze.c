@@ -142,8 +142,11 @@ instr_cost(loop_info_state *state, nir_instr *instr,
            const nir_shader_compiler_options *options)
 {
    if (instr->type == nir_instr_type_intrinsic ||
-       instr->type == nir_instr_type_tex)
+       instr->type == nir_instr_type_tex) {
+      if (options->unroll_estimate_instr_cost)
+         return options->unroll_estimate_instr_cost(instr);
       return 1;
+   }
 
    if (instr->type != nir_instr_type_alu)
       return 0;
@@ -182,6 +185,29 @@ instr_cost(loop_info_state *state, nir_instr *instr,
       }
    }
 
+   /* A backend estimate replaces the generic flrp/64-bit heuristics below,
+    * but not the induction-variable special case above: instructions that
+    * unrolling eliminates are free no matter what the target charges.
+    */
+   if (options->unroll_estimate_instr_cost) {
+      if (options->lower_doubles_options & nir_lower_fp64_full_software) {
+         /* Keep the soft-fp64 detection so max_unroll_iterations_fp64
+          * still kicks in.
+          */
+         bool is_fp64 = alu->def.bit_size == 64 &&
+                        nir_alu_type_get_base_type(info->output_type) == nir_type_float;
+         for (unsigned i = 0; i < info->num_inputs; i++) {
+            if (nir_src_bit_size(alu->src[i].src) == 64 &&
+                nir_alu_type_get_base_type(info->input_types[i]) == nir_type_float)
+               is_fp64 = true;
+         }
+         if (is_fp64)
+            state->loop->info->has_soft_fp64 = true;
+      }
+
+      return options->unroll_estimate_instr_cost(instr);
+   }
+
    if (alu->op == nir_op_flrp) {
       if ((options->lower_flrp16 && alu->def.bit_size == 16) ||
           (options->lower_flrp32 && alu->def.bit_size == 32) ||
@@ -40,6 +40,11 @@ struct lower_io_state {
    nir_variable_mode modes;
    nir_lower_io_options options;
    struct set variable_names;
+   /* Maps nir_deref_instr to the offset chain already built for it, so
+    * repeated accesses through the same deref don't regenerate identical
+    * address math.
+    */
+   struct hash_table *offset_cache;
 };
 
 static const char *
@@ -734,9 +739,31 @@ nir_lower_io_block(nir_block *block,
          continue;
       }
 
-      offset = get_io_offset(b, deref, is_arrayed ? &array_index : NULL,
-                             state->type_size, &component_offset,
-                             bindless_type_size);
+      /* Accesses through the same deref produce the same offset chain, so
+       * reuse the one we already built as long as it is in the current block
+       * and therefore dominates the cursor.  Compact vars are excluded
+       * because their constant-indexed path also adjusts component_offset,
+       * and arrayed I/O because the vertex index has to be popped off the
+       * path for every access.
+       */
+      const bool cache_offset = !is_arrayed && !var->data.compact;
+      struct hash_entry *cache_entry = cache_offset ?
+         _mesa_hash_table_search(state->offset_cache, deref) : NULL;
+
+      if (cache_entry &&
+          ((nir_def *)cache_entry->data)->parent_instr->block == block) {
+         offset = cache_entry->data;
+      } else {
+         offset = get_io_offset(b, deref, is_arrayed ? &array_index : NULL,
+                                state->type_size, &component_offset,
+                                bindless_type_size);
+         if (cache_offset) {
+            if (cache_entry)
+               cache_entry->data = offset;
+            else
+               _mesa_hash_table_insert(state->offset_cache, deref, offset);
+         }
+      }
 
       nir_def *replacement = NULL;
 
@@ -791,6 +818,7 @@ nir_lower_io_impl(nir_function_impl *impl,
    state.options = options;
    _mesa_set_init(&state.variable_names, state.dead_ctx,
                   _mesa_hash_string, _mesa_key_string_equal);
+   state.offset_cache = _mesa_pointer_hash_table_create(state.dead_ctx);
 
    ASSERTED nir_variable_mode supported_modes =
       nir_var_shader_in | nir_var_shader_out | nir_var_uniform;
@@ -133,7 +133,7 @@ shader_only_position_uses_view_index(nir_shader *shader)
       /* Peephole select will drop if-blocks that have then and else empty,
        * which will remove the usage of an SSA in the condition.
        */
-      progress |= nir_opt_peephole_select(shader_no_position, 0, false, false);
+      progress |= nir_opt_peephole_select(shader_no_position, 0, 0, false, false);
 
       progress |= nir_opt_dce(shader_no_position);
    } while (progress);
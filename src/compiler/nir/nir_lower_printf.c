@@ -51,6 +51,15 @@ lower_printf_intrin(nir_builder *b, nir_intrinsic_instr *prntf, void *_options)
 
    /* Atomic add a buffer size counter to determine where to write.  If
     * overflowed, return -1, otherwise, store the arguments and return 0.
+    *
+    * This bump allocator is the whole synchronization story: one global
+    * atomic per printf call, no locks, and writers never wait for each
+    * other.  Per-wave rings drained by a host thread would need coherent
+    * host polling of device memory while the kernel runs, which the
+    * consumers of this pass (rusticl and the Vulkan drivers) cannot assume
+    * portably -- they read the buffer back and decode it with
+    * u_printf_ptr() after the dispatch completes.  The real cost knob is
+    * the argument stores, i.e. how much the shader chooses to print.
     */
    nir_def *buffer_addr = nir_load_printf_buffer_address(b, ptr_bit_size);
    nir_deref_instr *buffer =
@@ -121,7 +121,7 @@ copy_propagate(nir_src *src, nir_alu_instr *copy)
 }
 
 static bool
-copy_prop_instr(nir_instr *instr)
+copy_prop_instr(nir_instr *instr, struct exec_list *dead_instrs)
 {
    if (instr->type != nir_instr_type_alu)
       return false;
@@ -140,8 +140,10 @@ copy_prop_instr(nir_instr *instr)
          progress |= copy_propagate(src, mov);
    }
 
-   if (progress && nir_def_is_unused(&mov->def))
+   if (progress && nir_def_is_unused(&mov->def)) {
       nir_instr_remove(&mov->instr);
+      exec_list_push_tail(dead_instrs, &mov->instr.node);
+   }
 
    return progress;
 }
@@ -151,12 +153,17 @@ nir_copy_prop_impl(nir_function_impl *impl)
 {
    bool progress = false;
 
+   struct exec_list dead_instrs;
+   exec_list_make_empty(&dead_instrs);
+
    nir_foreach_block(block, impl) {
       nir_foreach_instr_safe(instr, block) {
-         progress |= copy_prop_instr(instr);
+         progress |= copy_prop_instr(instr, &dead_instrs);
       }
    }
 
+   nir_instr_free_list(&dead_instrs);
+
    if (progress) {
       nir_metadata_preserve(impl, nir_metadata_control_flow);
    } else {
@@ -42,12 +42,18 @@ nir_opt_cse_impl(nir_function_impl *impl)
 
    nir_metadata_require(impl, nir_metadata_dominance);
 
+   struct exec_list dead_instrs;
+   exec_list_make_empty(&dead_instrs);
+
    bool progress = false;
    nir_foreach_block(block, impl) {
       nir_foreach_instr_safe(instr, block)
-         progress |= nir_instr_set_add_or_rewrite(instr_set, instr, dominates);
+         progress |= nir_instr_set_add_or_rewrite(instr_set, instr, dominates,
+                                                  &dead_instrs);
    }
 
+   nir_instr_free_list(&dead_instrs);
+
    if (progress) {
       nir_metadata_preserve(impl, nir_metadata_control_flow);
    } else {
@@ -833,15 +833,19 @@ opt_gcm_impl(nir_shader *shader, nir_function_impl *impl, bool value_number)
     * This cleans up a lot of mess without being -too- aggressive.
     */
    struct set *gvn_set = nir_instr_set_create(NULL);
+   struct exec_list dead_instrs;
+   exec_list_make_empty(&dead_instrs);
    foreach_list_typed_safe(nir_instr, instr, node, &state.instrs) {
       if (instr->pass_flags & GCM_INSTR_PINNED)
          continue;
 
       if (nir_instr_set_add_or_rewrite(gvn_set, instr,
-                                       value_number ? NULL : weak_gvn))
+                                       value_number ? NULL : weak_gvn,
+                                       &dead_instrs))
          state.progress = true;
    }
    nir_instr_set_destroy(gvn_set);
+   nir_instr_free_list(&dead_instrs);
 
    foreach_list_typed(nir_instr, instr, node, &state.instrs)
       gcm_schedule_early_instr(instr, &state);
@@ -918,10 +918,20 @@ check_unrolling_restrictions(nir_shader *shader, nir_loop *loop)
    unsigned cost_limit = max_iter * LOOP_UNROLL_LIMIT;
    unsigned cost = li->instr_cost * trip_count;
 
-   if (cost <= cost_limit && trip_count <= max_iter)
-      return true;
+   bool unroll = cost <= cost_limit && trip_count <= max_iter;
+
+   if (NIR_DEBUG(UNROLL)) {
+      fprintf(stderr,
+              "nir_opt_loop_unroll: %s: %s loop with trip count %u "
+              "(cost %u, limit %u, max iterations %u)\n",
+              shader->info.label ? shader->info.label
+                                 : shader->info.name ? shader->info.name
+                                                     : "unnamed",
+              unroll ? "unrolling" : "not unrolling", trip_count, cost,
+              cost_limit, max_iter);
+   }
 
-   return false;
+   return unroll;
 }
 
 static bool
@@ -26,6 +26,18 @@
 #include "nir_control_flow.h"
 #include "nir_worklist.h"
 
+/* This pass (hoisting discards above side effects) is as far as a compiler
+ * pass can safely push toward early depth testing.  Auto-setting
+ * fs.early_fragment_tests when a shader discards would be incorrect, not
+ * conservative: early_fragment_tests commits depth/stencil writes before
+ * the shader runs, so a later discard would leave updated depth behind for
+ * killed pixels.  And for shaders that neither discard nor write depth, the
+ * hardware already performs early Z on its own -- drivers derive that from
+ * shader_info without needing the flag.  What remains driver-side is
+ * re-Z/"early-then-late" selection, which depends on hw state (e.g.
+ * DB_SHADER_CONTROL on AMD) and stays in the backends.
+ */
+
 static bool
 nir_texop_implies_derivative(nir_texop op)
 {
@@ -54,6 +54,14 @@
  * parameter, then the optimization is skipped.  In limit=0 mode, the SSA defs
  * must only be MOVs which we expect to get copy-propagated away once they're
  * out of the inner blocks.
+ *
+ * Which limit applies depends on the divergence of the branch condition:
+ * "limit" governs uniform conditions and "divergent_limit" divergent ones.
+ * A divergent branch makes the whole wave execute both sides anyway, so
+ * backends where that's expensive can flatten divergent branches more
+ * aggressively than uniform ones, which stay cheap as real jumps.  Callers
+ * that don't care pass the same value twice, which also skips the up-front
+ * divergence analysis.
  */
 
 static bool
@@ -284,6 +292,7 @@ block_check_for_allowed_instrs(nir_block *block, unsigned *count,
  */
 static bool
 nir_opt_collapse_if(nir_if *if_stmt, nir_shader *shader, unsigned limit,
+                    unsigned divergent_limit,
                     bool indirect_load_ok, bool expensive_alu_ok)
 {
    /* the if has to be nested */
@@ -294,6 +303,11 @@ nir_opt_collapse_if(nir_if *if_stmt, nir_shader *shader, unsigned limit,
    if (parent_if->control == nir_selection_control_dont_flatten)
       return false;
 
+   /* The combined condition is divergent if either source condition is. */
+   if (if_stmt->condition.ssa->divergent ||
+       parent_if->condition.ssa->divergent)
+      limit = divergent_limit;
+
    /* check if the else block is empty */
    if (!nir_cf_list_is_empty_block(&if_stmt->else_list))
       return false;
@@ -410,7 +424,8 @@ rewrite_discard_conds(nir_instr *instr, nir_def *if_cond, bool is_else)
 
 static bool
 nir_opt_peephole_select_block(nir_block *block, nir_shader *shader,
-                              unsigned limit, bool indirect_load_ok,
+                              unsigned limit, unsigned divergent_limit,
+                              bool indirect_load_ok,
                               bool expensive_alu_ok)
 {
    if (nir_cf_node_is_first(&block->cf_node))
@@ -434,13 +449,16 @@ nir_opt_peephole_select_block(nir_block *block, nir_shader *shader,
    nir_if *if_stmt = nir_cf_node_as_if(prev_node);
 
    /* first, try to collapse the if */
-   if (nir_opt_collapse_if(if_stmt, shader, limit,
+   if (nir_opt_collapse_if(if_stmt, shader, limit, divergent_limit,
                            indirect_load_ok, expensive_alu_ok))
       return true;
 
    if (if_stmt->control == nir_selection_control_dont_flatten)
       return false;
 
+   if (if_stmt->condition.ssa->divergent)
+      limit = divergent_limit;
+
    nir_block *then_block = nir_if_first_then_block(if_stmt);
    nir_block *else_block = nir_if_first_else_block(if_stmt);
 
@@ -520,6 +538,7 @@ nir_opt_peephole_select_block(nir_block *block, nir_shader *shader,
 
 static bool
 nir_opt_peephole_select_impl(nir_function_impl *impl, unsigned limit,
+                             unsigned divergent_limit,
                              bool indirect_load_ok, bool expensive_alu_ok)
 {
    nir_shader *shader = impl->function->shader;
@@ -527,6 +546,7 @@ nir_opt_peephole_select_impl(nir_function_impl *impl, unsigned limit,
 
    nir_foreach_block_safe(block, impl) {
       progress |= nir_opt_peephole_select_block(block, shader, limit,
+                                                divergent_limit,
                                                 indirect_load_ok,
                                                 expensive_alu_ok);
    }
@@ -542,12 +562,21 @@ nir_opt_peephole_select_impl(nir_function_impl *impl, unsigned limit,
 
 bool
 nir_opt_peephole_select(nir_shader *shader, unsigned limit,
+                        unsigned divergent_limit,
                         bool indirect_load_ok, bool expensive_alu_ok)
 {
    bool progress = false;
 
+   /* The divergent flags are only consulted when the limits differ.  They
+    * stay usable while we flatten: replacing an if with bcsels never makes
+    * the condition of another candidate if more divergent, so at worst a
+    * newly created def is treated as uniform and gets the smaller limit.
+    */
+   if (limit != divergent_limit)
+      nir_divergence_analysis(shader);
+
    nir_foreach_function_impl(impl, shader) {
-      progress |= nir_opt_peephole_select_impl(impl, limit,
+      progress |= nir_opt_peephole_select_impl(impl, limit, divergent_limit,
                                                indirect_load_ok,
                                                expensive_alu_ok);
    }
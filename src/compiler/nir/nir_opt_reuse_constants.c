@@ -12,6 +12,9 @@ nir_opt_reuse_constants(nir_shader *shader)
    bool progress = false;
 
    struct set *consts = nir_instr_set_create(NULL);
+   struct exec_list dead_instrs;
+   exec_list_make_empty(&dead_instrs);
+
    nir_foreach_function_impl(impl, shader) {
       _mesa_set_clear(consts, NULL);
 
@@ -31,7 +34,9 @@ nir_opt_reuse_constants(nir_shader *shader)
                _mesa_set_add(consts, instr);
             }
 
-            func_progress |= nir_instr_set_add_or_rewrite(consts, instr, nir_instrs_equal);
+            func_progress |= nir_instr_set_add_or_rewrite(consts, instr,
+                                                          nir_instrs_equal,
+                                                          &dead_instrs);
          }
       }
 
@@ -44,5 +49,6 @@ nir_opt_reuse_constants(nir_shader *shader)
    }
 
    nir_instr_set_destroy(consts);
+   nir_instr_free_list(&dead_instrs);
    return progress;
 }
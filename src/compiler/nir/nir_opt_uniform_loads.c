@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Mesa3D contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * \file
+ * Promote loads with subgroup-uniform sources to uniform values.
+ *
+ * A load whose address is uniform can still be considered divergent by
+ * nir_divergence_analysis when another invocation may write the memory
+ * concurrently (nir_divergence_uniform_load_tears): per-lane loads of a
+ * racing location are not guaranteed to observe the same value.  That
+ * conservatism keeps such loads and everything computed from them in vector
+ * registers even though the address is scalar.
+ *
+ * This pass rewrites those loads by broadcasting the value observed by the
+ * first invocation, which makes the result genuinely uniform.  Picking one
+ * invocation's view of a racing non-volatile load is a legal outcome of the
+ * race, so this does not change defined behavior; what it buys is that
+ * backends can place the result and all dependent address computations and
+ * branch conditions in scalar registers.
+ *
+ * nir_divergence_analysis must have been run.  The broadcast results are
+ * marked uniform, but divergence of values derived from them is not
+ * recomputed here, so callers that keep optimizing on divergence information
+ * should rerun the analysis after this pass reports progress.
+ */
+
+#include "nir/nir.h"
+#include "nir/nir_builder.h"
+
+static bool
+opt_uniform_load(nir_builder *b, nir_intrinsic_instr *intrin, void *_state)
+{
+   switch (intrin->intrinsic) {
+   case nir_intrinsic_load_ssbo:
+   case nir_intrinsic_load_shared:
+   case nir_intrinsic_load_global:
+   case nir_intrinsic_load_global_2x32:
+      break;
+   default:
+      return false;
+   }
+
+   /* Already uniform: nothing to promote. */
+   if (!intrin->def.divergent)
+      return false;
+
+   /* A volatile load must observe its own memory access. */
+   if (nir_intrinsic_has_access(intrin) &&
+       (nir_intrinsic_access(intrin) & ACCESS_VOLATILE))
+      return false;
+
+   /* With uniform sources, the only reason these loads are divergent is the
+    * possibility of tearing, which the broadcast below resolves.
+    */
+   for (unsigned i = 0; i < nir_intrinsic_infos[intrin->intrinsic].num_srcs; i++) {
+      if (nir_src_is_divergent(intrin->src[i]))
+         return false;
+   }
+
+   b->cursor = nir_after_instr(&intrin->instr);
+
+   nir_def *uniform = nir_read_first_invocation(b, &intrin->def);
+   uniform->divergent = false;
+   nir_def_rewrite_uses_after(&intrin->def, uniform, uniform->parent_instr);
+
+   return true;
+}
+
+bool
+nir_opt_uniform_loads(nir_shader *shader)
+{
+   return nir_shader_intrinsics_pass(shader, opt_uniform_load,
+                                     nir_metadata_control_flow, NULL);
+}
@@ -842,6 +842,7 @@ nir_algebraic_instr(nir_builder *build, nir_instr *instr,
                     const bool *condition_flags,
                     const nir_algebraic_table *table,
                     struct util_dynarray *states,
+                    const bool *state_enabled,
                     nir_instr_worklist *worklist,
                     struct exec_list *dead_instrs)
 {
@@ -860,6 +861,9 @@ nir_algebraic_instr(nir_builder *build, nir_instr *instr,
 
    int xform_idx = *util_dynarray_element(states, uint16_t,
                                           alu->def.index);
+   if (state_enabled && !state_enabled[xform_idx])
+      return false;
+
    for (const struct transform *xform = &table->transforms[table->transform_offsets[xform_idx]];
         xform->condition_offset != ~0;
         xform++) {
@@ -900,6 +904,26 @@ nir_algebraic_impl(nir_function_impl *impl,
 
    nir_instr_worklist *worklist = nir_instr_worklist_create();
 
+   /* Precompute which automaton states still have a transform enabled under
+    * this shader's condition flags.  Most instructions end up in states
+    * whose transforms are all compiled out by the conditions, so one byte
+    * per state lets us keep them off the worklist instead of walking their
+    * transform lists every time they come up.
+    */
+   bool *state_enabled = calloc(table->num_automaton_states, sizeof(bool));
+   if (state_enabled) {
+      for (unsigned i = 0; i < table->num_automaton_states; i++) {
+         for (const struct transform *xform =
+                 &table->transforms[table->transform_offsets[i]];
+              xform->condition_offset != ~0; xform++) {
+            if (condition_flags[xform->condition_offset]) {
+               state_enabled[i] = true;
+               break;
+            }
+         }
+      }
+   }
+
    /* Walk top-to-bottom setting up the automaton state. */
    nir_foreach_block(block, impl) {
       nir_foreach_instr(instr, block) {
@@ -914,8 +938,19 @@ nir_algebraic_impl(nir_function_impl *impl,
    nir_foreach_block_reverse(block, impl) {
       nir_foreach_instr_reverse(instr, block) {
          instr->pass_flags = 0;
-         if (instr->type == nir_instr_type_alu)
-            nir_instr_worklist_push_tail(worklist, instr);
+         if (instr->type != nir_instr_type_alu)
+            continue;
+
+         /* Instructions whose state has no enabled transform can only
+          * become interesting through an automaton state change, which
+          * re-adds them to the worklist in add_uses_to_worklist().
+          */
+         if (state_enabled &&
+             !state_enabled[*util_dynarray_element(&states, uint16_t,
+                                                   nir_instr_as_alu(instr)->def.index)])
+            continue;
+
+         nir_instr_worklist_push_tail(worklist, instr);
       }
    }
 
@@ -933,11 +968,13 @@ nir_algebraic_impl(nir_function_impl *impl,
 
       progress |= nir_algebraic_instr(&build, instr,
                                       range_ht, condition_flags,
-                                      table, &states, worklist, &dead_instrs);
+                                      table, &states, state_enabled,
+                                      worklist, &dead_instrs);
    }
 
    nir_instr_free_list(&dead_instrs);
 
+   free(state_enabled);
    nir_instr_worklist_destroy(worklist);
    ralloc_free(range_ht);
    util_dynarray_fini(&states);
@@ -207,6 +207,8 @@ typedef struct {
    const struct transform *transforms;
    /** Mapping from automaton state index to location in *transforms. */
    const uint16_t *transform_offsets;
+   /** Number of automaton states (entries in transform_offsets). */
+   unsigned num_automaton_states;
    const struct per_op_table *pass_op_table;
    const nir_search_value_union *values;
 
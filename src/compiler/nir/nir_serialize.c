@@ -524,7 +524,10 @@ union packed_instr {
       unsigned exact : 1;
       unsigned no_signed_wrap : 1;
       unsigned no_unsigned_wrap : 1;
-      unsigned padding : 1;
+      /* The fp_fast_math dword is only present when this is set; it is
+       * almost always 0 without SPV_KHR_float_controls2.
+       */
+      unsigned has_fp_fast_math : 1;
       /* Reg: writemask; SSA: swizzles for 2 srcs */
       unsigned writemask_or_two_swizzles : 4;
       unsigned op : 9;
@@ -712,6 +715,7 @@ write_alu(write_ctx *ctx, const nir_alu_instr *alu)
    header.alu.no_signed_wrap = alu->no_signed_wrap;
    header.alu.no_unsigned_wrap = alu->no_unsigned_wrap;
    header.alu.op = alu->op;
+   header.alu.has_fp_fast_math = alu->fp_fast_math != 0;
    header.alu.packed_src_ssa_16bit = is_alu_src_ssa_16bit(ctx, alu);
 
    if (header.alu.packed_src_ssa_16bit) {
@@ -722,7 +726,8 @@ write_alu(write_ctx *ctx, const nir_alu_instr *alu)
    }
 
    write_def(ctx, &alu->def, header, alu->instr.type);
-   blob_write_uint32(ctx->blob, alu->fp_fast_math);
+   if (alu->fp_fast_math)
+      blob_write_uint32(ctx->blob, alu->fp_fast_math);
 
    if (header.alu.packed_src_ssa_16bit) {
       for (unsigned i = 0; i < num_srcs; i++) {
@@ -774,7 +779,8 @@ read_alu(read_ctx *ctx, union packed_instr header)
    alu->no_unsigned_wrap = header.alu.no_unsigned_wrap;
 
    read_def(ctx, &alu->def, &alu->instr, header);
-   alu->fp_fast_math = blob_read_uint32(ctx->blob);
+   if (header.alu.has_fp_fast_math)
+      alu->fp_fast_math = blob_read_uint32(ctx->blob);
 
    if (header.alu.packed_src_ssa_16bit) {
       for (unsigned i = 0; i < num_srcs; i++) {
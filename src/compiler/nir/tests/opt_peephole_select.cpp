@@ -94,7 +94,7 @@ TEST_F(nir_opt_peephole_select_test, opt_load_ubo_no_speculate)
    nir_index_blocks(main->impl);
    EXPECT_EQ(main->impl->num_blocks, 4);
 
-   ASSERT_FALSE(nir_opt_peephole_select(bld.shader, 16, true, true));
+   ASSERT_FALSE(nir_opt_peephole_select(bld.shader, 16, 16, true, true));
    nir_validate_shader(bld.shader, NULL);
 
    nir_index_blocks(main->impl);
@@ -145,7 +145,7 @@ TEST_F(nir_opt_peephole_select_test, opt_load_ubo_speculate)
    nir_index_blocks(main->impl);
    EXPECT_EQ(main->impl->num_blocks, 4);
 
-   ASSERT_TRUE(nir_opt_peephole_select(bld.shader, 16, true, true));
+   ASSERT_TRUE(nir_opt_peephole_select(bld.shader, 16, 16, true, true));
    nir_validate_shader(bld.shader, NULL);
 
    nir_index_blocks(main->impl);
@@ -6914,6 +6914,17 @@ spirv_to_nir(const uint32_t *words, size_t word_count,
       b->entry_point->func->referenced = true;
    }
 
+   /* Emit function bodies on demand: only functions reachable from the
+    * selected entry point are materialized, so multi-entry-point modules
+    * don't pay for the bodies of the other entry points. The preamble and
+    * type/constant/variable walks above do run per entry point, but they are
+    * linear scans with no NIR emission; sharing them across calls would mean
+    * an immutable module representation and a new API for every caller.
+    * Note that translation can't be skipped when only specialization
+    * constant values differ either, because spec constants feed types, array
+    * sizes, the workgroup size and OpSpecConstantOp control flow; callers
+    * cache the translated NIR keyed on the spec values instead.
+    */
    bool progress;
    do {
       progress = false;
@@ -2577,6 +2577,19 @@ dri2_wl_swrast_get_image(__DRIdrawable *read, int x, int y, int w, int h,
    }
 }
 
+/* This copy from the driver's internal color buffer into the wl_shm mmap is
+ * the price of the drisw architecture and cannot simply be skipped by
+ * pointing the driver at the wl_shm pool: the softpipe/llvmpipe display
+ * target is a single persistent allocation, while wl_shm buffers cycle with
+ * compositor release events.  Unlike XShm (where the server copies during
+ * XShmPutImage), a Wayland compositor samples the client's buffer until it
+ * sends wl_buffer.release, so rendering the next frame into an attached
+ * buffer would tear.  Rendering directly into per-frame shm buffers with
+ * release tracking is exactly what the kopper path above does (lavapipe
+ * draws into WSI-allocated host memory that is exported as the wl_shm
+ * pool), so clients that need the zero-copy path should let EGL select
+ * kopper rather than plain drisw.
+ */
 static void
 dri2_wl_swrast_put_image2(__DRIdrawable *draw, int op, int x, int y, int w,
                           int h, int stride, char *data, void *loaderPrivate)
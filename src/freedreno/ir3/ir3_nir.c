@@ -193,7 +193,7 @@ ir3_optimize_loop(struct ir3_compiler *compiler, nir_shader *s)
          progress |= OPT(s, nir_opt_gcm, true);
       else if (gcm == 2)
          progress |= OPT(s, nir_opt_gcm, false);
-      progress |= OPT(s, nir_opt_peephole_select, 16, true, true);
+      progress |= OPT(s, nir_opt_peephole_select, 16, 16, true, true);
       progress |= OPT(s, nir_opt_intrinsics);
       /* NOTE: GS lowering inserts an output var with varying slot that
        * is larger than VARYING_SLOT_MAX (ie. GS_VERTEX_FLAGS_IR3),
@@ -360,6 +360,16 @@ create_variant(struct ir3_shader *shader, const struct ir3_shader_key *key,
    if (!compile_variant(shader, v))
       goto fail;
 
+   /* The binning variant must be compiled after (not concurrently with) the
+    * draw variant: it shares the draw variant's const_state so that both
+    * passes can use the same constlen/const-emit cmdstream, and on a6xx+ it
+    * reads the draw variant's input table to keep the shared VBO state
+    * consistent.  Its outputs are pruned to the position-only subset before
+    * scheduling/RA, which is what gives it better register pressure than the
+    * draw shader -- reusing the draw variant's RA result would forfeit that.
+    * Parallelism across variants already comes from the callers' compile
+    * worker threads.
+    */
    if (needs_binning_variant(v) && !compile_variant(shader, v->binning))
       goto fail;
 
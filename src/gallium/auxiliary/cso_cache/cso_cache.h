@@ -104,6 +104,18 @@ typedef void (*cso_sanitize_callback)(struct cso_hash *hash,
                                       int max_size,
                                       void *user_data);
 
+/* The cache is deliberately per-context, not per-screen.  Every CSO it holds
+ * was returned by a pipe_context create_*_state hook, and the gallium
+ * contract ties those objects to the creating context: drivers are free to
+ * embed context-private allocations or suballocations in them, and the
+ * threaded context wraps the hooks per context.  The only CSO type with a
+ * cross-context sharing guarantee is shaders, opted into by drivers through
+ * PIPE_CAP_SHAREABLE_SHADERS and exploited by the GL state tracker for
+ * share groups.  Extending that to blend/DSA/rasterizer objects would need
+ * an equivalent cap plus a per-driver audit, and the objects themselves are
+ * small packed-register blobs that are cheap to create, so deduplication
+ * within a context is where the win is.
+ */
 struct cso_cache {
    struct cso_hash hashes[CSO_CACHE_MAX];
    int max_size;
@@ -1303,7 +1303,15 @@ cso_set_vertex_buffers(struct cso_context *cso,
 
 
 /**
- * Set vertex buffers and vertex elements. Skip u_vbuf if it's only needed
+ * Set vertex buffers and vertex elements atomically in one call. This is
+ * the fast path st_update_array uses on every draw that changes vertex
+ * state: vertex elements go through the CSO cache, so re-binding the same
+ * layout costs one hash lookup and no driver call, and u_vbuf sees both
+ * updates before it revalidates anything at draw time. When the VAO is
+ * unchanged, the GL state tracker doesn't call this at all. Display lists
+ * bypass this entirely via pipe_vertex_state (draw_vertex_state).
+ *
+ * Skip u_vbuf if it's only needed
  * for user vertex buffers and user vertex buffers are not set by this call.
  * u_vbuf will be disabled. To re-enable u_vbuf, call this function again.
  *
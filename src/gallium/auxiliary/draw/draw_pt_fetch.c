@@ -43,9 +43,128 @@ struct pt_fetch {
    unsigned vertex_size;
 
    struct translate_cache *cache;
+
+   /* Batched fast path for the common case where every input is a plain
+    * float32 attribute with no instancing: the per-element indirect calls
+    * translate_generic makes per vertex dominate vertex-bound profiles, and
+    * a direct attribute-major copy loop over the whole fetch run both drops
+    * those calls and walks each vertex stream sequentially, which the
+    * compiler can vectorize.
+    */
+   bool use_batched;
+   unsigned nr_batched_attrs;
+   struct {
+      unsigned buffer;
+      unsigned input_offset;
+      unsigned output_offset;
+      unsigned nr_comps;
+   } batched_attr[TRANSLATE_MAX_ATTRIBS];
 };
 
 
+/**
+ * Checks whether the prepared translate key is the simple case the batched
+ * loop handles: nothing but float32 inputs, no instance divisors and no
+ * instance ID element, each expanding to R32G32B32A32_FLOAT.  Records the
+ * per-attribute copy parameters when it is.
+ */
+static bool
+fetch_prepare_batched(struct pt_fetch *fetch, const struct translate_key *key)
+{
+   for (unsigned i = 0; i < key->nr_elements; i++) {
+      const struct translate_element *el = &key->element[i];
+      unsigned nr_comps;
+
+      if (el->type != TRANSLATE_ELEMENT_NORMAL ||
+          el->instance_divisor != 0 ||
+          el->output_format != PIPE_FORMAT_R32G32B32A32_FLOAT)
+         return false;
+
+      switch (el->input_format) {
+      case PIPE_FORMAT_R32_FLOAT:
+         nr_comps = 1;
+         break;
+      case PIPE_FORMAT_R32G32_FLOAT:
+         nr_comps = 2;
+         break;
+      case PIPE_FORMAT_R32G32B32_FLOAT:
+         nr_comps = 3;
+         break;
+      case PIPE_FORMAT_R32G32B32A32_FLOAT:
+         nr_comps = 4;
+         break;
+      default:
+         return false;
+      }
+
+      fetch->batched_attr[i].buffer = el->input_buffer;
+      fetch->batched_attr[i].input_offset = el->input_offset;
+      fetch->batched_attr[i].output_offset = el->output_offset;
+      fetch->batched_attr[i].nr_comps = nr_comps;
+   }
+
+   fetch->nr_batched_attrs = key->nr_elements;
+   return true;
+}
+
+
+/**
+ * Attribute-major fetch: one pass over the run per attribute, so each pass
+ * reads a single vertex stream sequentially.  'elts' may be NULL for a
+ * linear run starting at 'start'.
+ */
+static void
+fetch_run_batched(struct pt_fetch *fetch,
+                  const unsigned *elts,
+                  unsigned start,
+                  unsigned count,
+                  char *verts)
+{
+   struct draw_context *draw = fetch->draw;
+   const unsigned vertex_size = fetch->vertex_size;
+   const unsigned max_index = draw->pt.max_index;
+
+   for (unsigned a = 0; a < fetch->nr_batched_attrs; a++) {
+      const unsigned buffer = fetch->batched_attr[a].buffer;
+      const char *src_base =
+         (const char *)draw->pt.user.vbuffer[buffer].map +
+         draw->pt.vertex_buffer[buffer].buffer_offset +
+         fetch->batched_attr[a].input_offset;
+      const unsigned stride = draw->pt.vertex_strides[buffer];
+      const unsigned nr_comps = fetch->batched_attr[a].nr_comps;
+      char *dst_base = verts + fetch->batched_attr[a].output_offset;
+
+      for (unsigned i = 0; i < count; i++) {
+         /* Clamp to avoid going out of bounds, like translate does. */
+         const unsigned index = MIN2(elts ? elts[i] : start + i, max_index);
+         const float *src = (const float *)(src_base + (size_t)index * stride);
+         float *dst = (float *)(dst_base + (size_t)i * vertex_size);
+
+         switch (nr_comps) {
+         case 1:
+            dst[0] = src[0];
+            dst[1] = 0.0f;
+            dst[2] = 0.0f;
+            dst[3] = 1.0f;
+            break;
+         case 2:
+            memcpy(dst, src, 2 * sizeof(float));
+            dst[2] = 0.0f;
+            dst[3] = 1.0f;
+            break;
+         case 3:
+            memcpy(dst, src, 3 * sizeof(float));
+            dst[3] = 1.0f;
+            break;
+         case 4:
+            memcpy(dst, src, 4 * sizeof(float));
+            break;
+         }
+      }
+   }
+}
+
+
 /**
  * Perform the fetch from API vertex elements & vertex buffers, to a
  * contiguous set of float[4] attributes as required for the
@@ -130,6 +249,10 @@ draw_pt_fetch_prepare(struct pt_fetch *fetch,
    key.nr_elements = nr;
    key.output_stride = vertex_size;
 
+   fetch->use_batched = fetch_prepare_batched(fetch, &key);
+   if (fetch->use_batched)
+      return;
+
    if (!fetch->translate ||
        translate_key_compare(&fetch->translate->key, &key) != 0) {
       translate_key_sanitize(&key);
@@ -146,6 +269,11 @@ draw_pt_fetch_run(struct pt_fetch *fetch,
    struct draw_context *draw = fetch->draw;
    struct translate *translate = fetch->translate;
 
+   if (fetch->use_batched) {
+      fetch_run_batched(fetch, elts, 0, count, verts);
+      return;
+   }
+
    for (unsigned i = 0; i < draw->pt.nr_vertex_buffers; i++) {
       translate->set_buffer(translate,
                             i,
@@ -173,6 +301,11 @@ draw_pt_fetch_run_linear(struct pt_fetch *fetch,
    struct draw_context *draw = fetch->draw;
    struct translate *translate = fetch->translate;
 
+   if (fetch->use_batched) {
+      fetch_run_batched(fetch, NULL, start, count, verts);
+      return;
+   }
+
    for (unsigned i = 0; i < draw->pt.nr_vertex_buffers; i++) {
       translate->set_buffer(translate,
                             i,
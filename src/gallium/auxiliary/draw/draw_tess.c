@@ -353,10 +353,13 @@ int draw_tess_eval_shader_run(struct draw_tess_eval_shader *shader,
 #if DRAW_LLVM_AVAILABLE
    struct pipe_tessellation_factors factors;
    struct pipe_tessellator_data data = { 0 };
-   struct pipe_tessellator *ptess = p_tess_init(shader->prim_mode,
-                                                shader->spacing,
-                                                !shader->vertex_order_cw,
-                                                shader->point_mode);
+   if (!shader->ptess)
+      shader->ptess = p_tess_init(shader->prim_mode,
+                                  shader->spacing,
+                                  !shader->vertex_order_cw,
+                                  shader->point_mode);
+   struct pipe_tessellator *ptess = shader->ptess;
+   uint32_t vert_capacity = 0, elt_capacity = 0, len_capacity = 0;
    for (unsigned i = 0; i < input_prim->primitive_count; i++) {
       uint32_t vert_start = output_verts->count;
       uint32_t prim_start = output_prims->primitive_count;
@@ -370,17 +373,27 @@ int draw_tess_eval_shader_run(struct draw_tess_eval_shader *shader,
       if (data.num_domain_points == 0)
          continue;
 
-      uint32_t old_verts = vert_start;
+      /* Grow the output buffers geometrically: one realloc+copy per patch
+       * turns tess-factor-heavy draws quadratic.
+       */
       uint32_t new_verts = vert_start + util_align_npot(data.num_domain_points, 4);
-      uint32_t old_size = output_verts->vertex_size * old_verts;
-      uint32_t new_size = output_verts->vertex_size * new_verts;
-      output_verts->verts = REALLOC(output_verts->verts, old_size, new_size);
+      if (new_verts > vert_capacity) {
+         uint32_t new_capacity = MAX2(new_verts, vert_capacity * 2);
+         output_verts->verts = REALLOC(output_verts->verts,
+                                       output_verts->vertex_size * vert_capacity,
+                                       output_verts->vertex_size * new_capacity);
+         vert_capacity = new_capacity;
+      }
 
       output_verts->count += data.num_domain_points;
 
       output_prims->count += data.num_indices;
-      elts = REALLOC(elts, elt_start * sizeof(uint16_t),
-                     output_prims->count * sizeof(uint16_t));
+      if (output_prims->count > elt_capacity) {
+         uint32_t new_capacity = MAX2(output_prims->count, elt_capacity * 2);
+         elts = REALLOC(elts, elt_capacity * sizeof(uint16_t),
+                        new_capacity * sizeof(uint16_t));
+         elt_capacity = new_capacity;
+      }
 
       for (unsigned i = 0; i < data.num_indices; i++)
          elts[elt_start + i] = vert_start + data.indices[i];
@@ -397,13 +410,17 @@ int draw_tess_eval_shader_run(struct draw_tess_eval_shader *shader,
 
       uint32_t prim_len = u_prim_vertex_count(output_prims->prim)->min;
       output_prims->primitive_count += data.num_indices / prim_len;
-      output_prims->primitive_lengths = REALLOC(output_prims->primitive_lengths, prim_start * sizeof(uint32_t),
-                                                output_prims->primitive_count * sizeof(uint32_t));
+      if (output_prims->primitive_count > len_capacity) {
+         uint32_t new_capacity = MAX2(output_prims->primitive_count, len_capacity * 2);
+         output_prims->primitive_lengths = REALLOC(output_prims->primitive_lengths,
+                                                   len_capacity * sizeof(uint32_t),
+                                                   new_capacity * sizeof(uint32_t));
+         len_capacity = new_capacity;
+      }
       for (unsigned i = prim_start; i < output_prims->primitive_count; i++) {
          output_prims->primitive_lengths[i] = prim_len;
       }
    }
-   p_tess_destroy(ptess);
 #endif
 
    *elts_out = elts;
@@ -624,6 +641,8 @@ void draw_delete_tess_eval_shader(struct draw_context *draw,
       assert(shader->variants_cached == 0);
       align_free(dtes->tes_input);
    }
+   if (dtes->ptess)
+      p_tess_destroy(dtes->ptess);
 #endif
    if (dtes->state.type == PIPE_SHADER_IR_NIR && dtes->state.ir.nir)
       ralloc_free(dtes->state.ir.nir);
@@ -98,6 +98,11 @@ struct draw_tess_eval_shader {
    struct draw_tes_inputs *tes_input;
    struct lp_jit_resources *jit_resources;
    struct draw_tes_llvm_variant *current_variant;
+
+   /* Lazily created and reused across runs; the tessellator configuration
+    * only depends on shader state.
+    */
+   struct pipe_tessellator *ptess;
 #endif
 };
 
@@ -40,6 +40,7 @@
 
 #include "util/detect.h"
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -56,6 +57,7 @@
 #include "util/u_memory.h"
 #include "util/u_string.h"
 #include "util/u_math.h"
+#include "util/hash_table.h"
 #include "util/format/u_format.h"
 #include "compiler/nir/nir.h"
 
@@ -74,6 +76,32 @@ static long nir_count = 0;
 static bool trigger_active = true;
 static char *trigger_filename = NULL;
 
+/* Aggregated call statistics (GALLIUM_TRACE_STATS).
+ *
+ * Each traced call is counted and timed per method, and the serialized
+ * arguments are hashed so that re-setting exactly the same state can be
+ * flagged as redundant. flush_frontbuffer delimits frames; a one-line
+ * summary is emitted per frame and a ranked report at exit, so large
+ * traces don't need to be post-processed just to see what an application
+ * does too often.
+ */
+struct trace_call_stats {
+   char *name;
+   uint64_t count;
+   uint64_t redundant;
+   int64_t total_time;
+   uint32_t last_hash;
+};
+
+static bool stats_enabled = false;
+static struct hash_table *stats_table = NULL;
+static struct trace_call_stats *cur_stats = NULL;
+static uint32_t cur_call_hash;
+static bool hashing_args = false;
+static uint64_t frame_no = 0;
+static uint64_t frame_calls = 0;
+static uint64_t frame_redundant = 0;
+
 void
 trace_dump_trigger_active(bool active)
 {
@@ -111,6 +139,11 @@ trace_dump_is_triggered(void)
 static inline void
 trace_dump_write(const char *buf, size_t size)
 {
+   if (hashing_args) {
+      /* FNV-1a over the serialized arguments of the current call. */
+      for (size_t i = 0; i < size; i++)
+         cur_call_hash = (cur_call_hash ^ (unsigned char)buf[i]) * 0x01000193u;
+   }
    if (stream && trigger_active) {
       fwrite(buf, size, 1, stream);
    }
@@ -215,9 +248,61 @@ trace_dump_trace_flush(void)
    }
 }
 
+static int
+compare_stats_entries(const void *a, const void *b)
+{
+   const struct trace_call_stats *sa = *(const struct trace_call_stats **)a;
+   const struct trace_call_stats *sb = *(const struct trace_call_stats **)b;
+
+   if (sa->total_time != sb->total_time)
+      return sb->total_time > sa->total_time ? 1 : -1;
+   return (sb->count > sa->count) - (sb->count < sa->count);
+}
+
+static void
+trace_dump_stats_report(void)
+{
+   if (!stats_table)
+      return;
+
+   unsigned num = _mesa_hash_table_num_entries(stats_table);
+   struct trace_call_stats **entries = MALLOC(num * sizeof(*entries));
+   if (entries) {
+      unsigned i = 0;
+      hash_table_foreach(stats_table, entry)
+         entries[i++] = entry->data;
+      qsort(entries, num, sizeof(*entries), compare_stats_entries);
+
+      double frames = (double)MAX2(frame_no, 1);
+      fprintf(stderr, "trace: call statistics over %" PRIu64 " frame(s), "
+              "ranked by self-time:\n", frame_no);
+      fprintf(stderr, "trace: %-48s %10s %10s %10s %12s\n",
+              "method", "calls", "calls/frm", "redundant", "time(us)");
+      for (i = 0; i < num; i++) {
+         fprintf(stderr, "trace: %-48s %10" PRIu64 " %10.1f %10" PRIu64
+                 " %12" PRIi64 "\n",
+                 entries[i]->name, entries[i]->count,
+                 entries[i]->count / frames, entries[i]->redundant,
+                 entries[i]->total_time);
+      }
+      FREE(entries);
+   }
+
+   hash_table_foreach(stats_table, entry) {
+      struct trace_call_stats *cs = entry->data;
+      free(cs->name);
+      FREE(cs);
+   }
+   _mesa_hash_table_destroy(stats_table, NULL);
+   stats_table = NULL;
+   stats_enabled = false;
+}
+
 static void
 trace_dump_trace_close(void)
 {
+   trace_dump_stats_report();
+
    if (stream) {
       trigger_active = true;
       trace_dump_writes("</trace>\n");
@@ -256,6 +341,11 @@ trace_dump_trace_begin(void)
 
    nir_count = debug_get_num_option("GALLIUM_TRACE_NIR", 32);
 
+   stats_enabled = debug_get_bool_option("GALLIUM_TRACE_STATS", false);
+   if (stats_enabled && !stats_table)
+      stats_table = _mesa_hash_table_create(NULL, _mesa_hash_string,
+                                            _mesa_key_string_equal);
+
    if (!stream) {
 
       if (strcmp(filename, "stderr") == 0) {
@@ -377,6 +467,35 @@ void trace_dump_call_begin_locked(const char *klass, const char *method)
    trace_dump_writes("\'>");
    trace_dump_newline();
 
+   if (stats_enabled && stats_table) {
+      if (strcmp(method, "flush_frontbuffer") == 0) {
+         fprintf(stderr, "trace: frame %" PRIu64 ": %" PRIu64 " calls, "
+                 "%" PRIu64 " redundant\n",
+                 frame_no, frame_calls, frame_redundant);
+         frame_no++;
+         frame_calls = 0;
+         frame_redundant = 0;
+      }
+
+      char name[256];
+      snprintf(name, sizeof(name), "%s::%s", klass, method);
+      uint32_t hash = _mesa_hash_string(name);
+      struct hash_entry *entry =
+         _mesa_hash_table_search_pre_hashed(stats_table, hash, name);
+      if (entry) {
+         cur_stats = entry->data;
+      } else {
+         cur_stats = CALLOC_STRUCT(trace_call_stats);
+         if (cur_stats) {
+            cur_stats->name = strdup(name);
+            _mesa_hash_table_insert_pre_hashed(stats_table, hash,
+                                               cur_stats->name, cur_stats);
+         }
+      }
+      cur_call_hash = 0x811c9dc5u;
+      hashing_args = true;
+   }
+
    call_start_time = os_time_get();
 }
 
@@ -389,6 +508,21 @@ void trace_dump_call_end_locked(void)
 
    call_end_time = os_time_get();
 
+   if (stats_enabled) {
+      hashing_args = false;
+   }
+   if (stats_enabled && cur_stats) {
+      cur_stats->count++;
+      cur_stats->total_time += call_end_time - call_start_time;
+      frame_calls++;
+      if (cur_stats->count > 1 && cur_call_hash == cur_stats->last_hash) {
+         cur_stats->redundant++;
+         frame_redundant++;
+      }
+      cur_stats->last_hash = cur_call_hash;
+      cur_stats = NULL;
+   }
+
    trace_dump_call_time(call_end_time - call_start_time);
    trace_dump_indent(1);
    trace_dump_tag_end("call");
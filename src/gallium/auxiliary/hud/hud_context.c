@@ -1000,6 +1000,13 @@ void
 hud_graph_add_value(struct hud_graph *gr, double value)
 {
    gr->current_value = value;
+
+   /* Publish the raw value before the ceiling clamp; scrapers want the
+    * real measurement, not what fits in the graph.
+    */
+   if (gr->export_metric)
+      hud_export_add_value(gr->export_metric, value);
+
    value = value > gr->pane->ceiling ? gr->pane->ceiling : value;
 
    if (gr->fd) {
@@ -1577,6 +1584,16 @@ hud_parse_env_var(struct hud_context *hud, struct pipe_screen *screen,
          }
       }
    }
+
+   /* Independent of the on-screen/file output: publish values into the
+    * GALLIUM_HUD_EXPORT_DIR shared-memory file for external scrapers.
+    */
+   LIST_FOR_EACH_ENTRY(pane, &hud->pane_list, head) {
+      struct hud_graph *gr;
+
+      LIST_FOR_EACH_ENTRY(gr, &pane->graph_list, head)
+         gr->export_metric = hud_export_add_metric(gr->name);
+   }
 }
 
 static void
@@ -0,0 +1,181 @@
+/**************************************************************************
+ *
+ * Copyright 2026 Mesa3D contributors
+ * All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ **************************************************************************/
+
+/* Shared-memory export of HUD metric values for external telemetry agents.
+ *
+ * If GALLIUM_HUD_EXPORT_DIR is set to a writable directory, every HUD graph
+ * also publishes its raw values into a file named gallium_hud.<pid> in that
+ * directory.  The file is plain mmap-able shared memory with the fixed
+ * layout below, so a scraper can poll it without any GPU or GL involvement;
+ * put the directory on a tmpfs (e.g. /dev/shm or $XDG_RUNTIME_DIR) to keep
+ * it off disk.
+ *
+ * Each metric slot carries a seqlock: the sequence count is odd while the
+ * writer is updating the slot, so a reader retries when it observes an odd
+ * or changing value.  The file is not unlinked on exit; agents are expected
+ * to drop files whose pid is gone.
+ */
+
+#include "hud/hud_private.h"
+#include "util/detect_os.h"
+#include "util/simple_mtx.h"
+#include "util/u_debug.h"
+#include "util/u_memory.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if DETECT_OS_POSIX
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct hud_export_file {
+   struct hud_export_header *header;
+   unsigned size;
+   simple_mtx_t mutex;
+};
+
+static struct hud_export_file hud_export_file = {
+   .mutex = SIMPLE_MTX_INITIALIZER,
+};
+
+static bool
+hud_export_map_file(struct hud_export_file *file, const char *dir)
+{
+   char path[1024];
+   unsigned size = sizeof(struct hud_export_header) +
+                   HUD_EXPORT_MAX_METRICS * sizeof(struct hud_export_metric);
+
+   if (snprintf(path, sizeof(path), "%s/gallium_hud.%d", dir, getpid()) >=
+       (int)sizeof(path))
+      return false;
+
+   int fd = open(path, O_CREAT | O_RDWR, 0644);
+   if (fd < 0)
+      return false;
+
+   if (ftruncate(fd, size) < 0) {
+      close(fd);
+      return false;
+   }
+
+   void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED)
+      return false;
+
+   struct hud_export_header *header = map;
+   memset(header, 0, size);
+   header->version = HUD_EXPORT_VERSION;
+   header->size = size;
+   header->max_metrics = HUD_EXPORT_MAX_METRICS;
+   header->ring_size = HUD_EXPORT_RING_SIZE;
+   header->pid = getpid();
+   /* The magic is release-stored last so a scraper that races with us never
+    * sees a valid magic with uninitialized fields.
+    */
+   __atomic_store_n(&header->magic, HUD_EXPORT_MAGIC, __ATOMIC_RELEASE);
+
+   file->header = header;
+   file->size = size;
+   return true;
+}
+
+/**
+ * Reserve a metric slot for "name" in the shared-memory file, creating and
+ * mapping the file on first use.  Returns NULL if the export is disabled or
+ * all slots are taken.
+ */
+struct hud_export_metric *
+hud_export_add_metric(const char *name)
+{
+   struct hud_export_file *file = &hud_export_file;
+   struct hud_export_metric *metric = NULL;
+
+   const char *dir = debug_get_option("GALLIUM_HUD_EXPORT_DIR", NULL);
+   if (!dir)
+      return NULL;
+
+   simple_mtx_lock(&file->mutex);
+
+   if (!file->header && !hud_export_map_file(file, dir)) {
+      simple_mtx_unlock(&file->mutex);
+      return NULL;
+   }
+
+   struct hud_export_header *header = file->header;
+   if (header->num_metrics < header->max_metrics) {
+      metric = (struct hud_export_metric *)(header + 1) + header->num_metrics;
+      strncpy(metric->name, name, sizeof(metric->name) - 1);
+      /* Publish the slot only after the name is in place. */
+      __atomic_store_n(&header->num_metrics, header->num_metrics + 1,
+                       __ATOMIC_RELEASE);
+   }
+
+   simple_mtx_unlock(&file->mutex);
+   return metric;
+}
+
+/**
+ * Publish one sample.  Called from the thread that owns the graph; each
+ * metric has a single writer, so only readers need the seqlock.
+ */
+void
+hud_export_add_value(struct hud_export_metric *metric, double value)
+{
+   uint32_t seq = metric->seq;
+
+   /* Seqlock write side.  p_atomic_set is a plain store on some
+    * configurations, so use explicit ordering: the release fence keeps the
+    * odd sequence store ahead of the payload writes, and the release store
+    * of the even value keeps the payload writes ahead of it.  Readers must
+    * acquire-load seq on both sides of their copy (see hud_private.h).
+    */
+   __atomic_store_n(&metric->seq, seq + 1, __ATOMIC_RELAXED);
+   __atomic_thread_fence(__ATOMIC_RELEASE);
+   metric->samples[metric->num_samples % HUD_EXPORT_RING_SIZE] = value;
+   metric->num_samples++;
+   __atomic_store_n(&metric->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+#else /* !DETECT_OS_POSIX */
+
+struct hud_export_metric *
+hud_export_add_metric(const char *name)
+{
+   return NULL;
+}
+
+void
+hud_export_add_value(struct hud_export_metric *metric, double value)
+{
+}
+
+#endif
@@ -124,6 +124,38 @@ struct hud_graph {
    double current_value;
    FILE *fd;
    const char *separator;
+   struct hud_export_metric *export_metric;
+};
+
+/* Layout of the GALLIUM_HUD_EXPORT_DIR shared-memory file: the header is
+ * followed by max_metrics metric slots.  Shared with external scrapers,
+ * so changes require bumping HUD_EXPORT_VERSION.
+ */
+#define HUD_EXPORT_MAGIC       0x4855445a /* "HUDZ" */
+#define HUD_EXPORT_VERSION     1
+#define HUD_EXPORT_MAX_METRICS 64
+#define HUD_EXPORT_RING_SIZE   64
+
+struct hud_export_header {
+   uint32_t magic;
+   uint32_t version;
+   uint32_t size;        /* of the whole mapping, in bytes */
+   uint32_t max_metrics;
+   uint32_t num_metrics; /* slots in use */
+   uint32_t ring_size;
+   uint32_t pid;
+   uint32_t pad;
+};
+
+struct hud_export_metric {
+   char name[128];
+   uint32_t seq;          /* odd while the writer updates the slot; readers
+                           * must acquire-load it before and after copying
+                           * the slot and retry on odd or changed values */
+   uint32_t pad;
+   uint64_t num_samples;  /* monotonic; newest sample is at
+                           * (num_samples - 1) % ring_size */
+   double samples[HUD_EXPORT_RING_SIZE];
 };
 
 struct hud_pane {
@@ -159,6 +191,10 @@ void hud_pane_add_graph(struct hud_pane *pane, struct hud_graph *gr);
 void hud_pane_set_max_value(struct hud_pane *pane, uint64_t value);
 void hud_graph_add_value(struct hud_graph *gr, double value);
 
+/* shared-memory metric export */
+struct hud_export_metric *hud_export_add_metric(const char *name);
+void hud_export_add_value(struct hud_export_metric *metric, double value);
+
 /* graphs/queries */
 struct hud_batch_query_context;
 
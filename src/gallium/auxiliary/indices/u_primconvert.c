@@ -38,6 +38,15 @@
  *       return;
  *    }
  *
+ * Converted indices are re-generated on every draw into transient
+ * stream_uploader memory.  Memoizing them across draws sounds attractive
+ * for static meshes, but nothing at this level can tell whether the source
+ * index buffer changed -- apps may map and rewrite it between draws, there
+ * is no content generation counter on pipe_resources, and hashing the
+ * source range would read as much data as the conversion itself.  Apps
+ * that draw the same quad mesh every frame get the cached behaviour by
+ * converting once themselves, or by using a primitive type the hardware
+ * supports.
  */
 
 #include "pipe/p_state.h"
@@ -34,6 +34,10 @@
 #include "tgsi/tgsi_parse.h"
 #include "tgsi/tgsi_ureg.h"
 #include "tgsi/tgsi_util.h"
+#include "compiler/nir/nir_serialize.h"
+#include "util/blob.h"
+#include "util/disk_cache.h"
+#include "util/os_time.h"
 #include "util/u_debug.h"
 #include "util/u_math.h"
 #include "util/u_memory.h"
@@ -3333,6 +3337,7 @@ ntt_optimize_nir(struct nir_shader *s, struct pipe_screen *screen,
 
       NIR_PASS(progress, s, nir_opt_if, nir_opt_if_optimize_phi_true_false);
       NIR_PASS(progress, s, nir_opt_peephole_select,
+               control_flow_depth == 0 ? ~0 : 8,
                control_flow_depth == 0 ? ~0 : 8, true, true);
       NIR_PASS(progress, s, nir_opt_algebraic);
       NIR_PASS(progress, s, nir_opt_constant_folding);
@@ -3864,6 +3869,37 @@ ntt_vec_to_mov_writemask_cb(const nir_instr *instr, unsigned writemask, UNUSED c
    return true;
 }
 
+/* NTT_DEBUG_PERF=true prints the translation time and token size per shader,
+ * and whether it came from the disk cache, for tracking what the extra IR
+ * translation costs drivers that haven't moved to consuming NIR directly.
+ */
+DEBUG_GET_ONCE_BOOL_OPTION(ntt_perf, "NTT_DEBUG_PERF", false)
+
+/* Computes a disk cache key for the translation result.  The key only needs
+ * to cover the inputs that vary within one cache instance: the NIR and the
+ * NTT options.  Screen caps also steer the lowering, but they are constant
+ * for a given device and driver build, which is what scopes the cache
+ * instance itself (virgl additionally hashes the host caps into it).
+ */
+static void
+ntt_compute_cache_key(struct disk_cache *cache, nir_shader *s,
+                      const struct nir_to_tgsi_options *options,
+                      cache_key key)
+{
+   struct blob blob;
+
+   blob_init(&blob);
+   blob_write_uint32(&blob, options->lower_cmp);
+   blob_write_uint32(&blob, options->lower_fabs);
+   blob_write_uint32(&blob, options->unoptimized_ra);
+   blob_write_uint32(&blob, options->lower_ssbo_bindings);
+   blob_write_uint32(&blob, options->non_compute_membar_needs_all_modes);
+   blob_write_uint32(&blob, options->ubo_vec4_max);
+   nir_serialize(&blob, s, true);
+   disk_cache_compute_key(cache, blob.data, blob.size, key);
+   blob_finish(&blob);
+}
+
 /**
  * Translates the NIR shader to TGSI.
  *
@@ -3882,6 +3918,36 @@ const void *nir_to_tgsi_options(struct nir_shader *s,
                                                    pipe_shader_type_from_mesa(s->info.stage),
                                                    PIPE_SHADER_CAP_INTEGERS);
    const struct nir_shader_compiler_options *original_options = s->options;
+   struct disk_cache *cache = screen->get_disk_shader_cache ?
+      screen->get_disk_shader_cache(screen) : NULL;
+   cache_key key;
+   int64_t start_time = os_time_get_nano();
+
+   /* Repeated translations of the same NIR are common across app runs, so
+    * the tokens are cached alongside the driver's compiled shaders.
+    */
+   if (cache) {
+      ntt_compute_cache_key(cache, s, options, key);
+
+      size_t size;
+      void *buffer = disk_cache_get(cache, key, &size);
+      if (buffer) {
+         void *tokens = MALLOC(size);
+         if (tokens) {
+            memcpy(tokens, buffer, size);
+            free(buffer);
+
+            if (debug_get_option_ntt_perf()) {
+               fprintf(stderr, "nir-to-tgsi: %s: cache hit (%u bytes)\n",
+                       s->info.name ? s->info.name : "unnamed", (unsigned)size);
+            }
+
+            ralloc_free(s);
+            return tokens;
+         }
+         free(buffer);
+      }
+   }
 
    ntt_fix_nir_options(screen, s, options);
 
@@ -4037,7 +4103,8 @@ const void *nir_to_tgsi_options(struct nir_shader *s,
    ntt_emit_impl(c, impl);
    ureg_END(c->ureg);
 
-   tgsi_tokens = ureg_get_tokens(c->ureg, NULL);
+   unsigned num_tokens;
+   tgsi_tokens = ureg_get_tokens(c->ureg, &num_tokens);
 
    if (NIR_DEBUG(TGSI)) {
       fprintf(stderr, "TGSI after translation from NIR:\n");
@@ -4046,6 +4113,17 @@ const void *nir_to_tgsi_options(struct nir_shader *s,
 
    ureg_destroy(c->ureg);
 
+   if (cache) {
+      disk_cache_put(cache, key, tgsi_tokens,
+                     num_tokens * sizeof(struct tgsi_token), NULL);
+   }
+
+   if (debug_get_option_ntt_perf()) {
+      fprintf(stderr, "nir-to-tgsi: %s: translated in %u us (%u tokens)\n",
+              s->info.name ? s->info.name : "unnamed",
+              (unsigned)((os_time_get_nano() - start_time) / 1000), num_tokens);
+   }
+
    ralloc_free(c);
    ralloc_free(s);
 
@@ -38,7 +38,9 @@ DRI_CONF_SECTION_DEBUG
    DRI_CONF_GLSL_CORRECT_DERIVATIVES_AFTER_DISCARD(false)
    DRI_CONF_GLSL_IGNORE_WRITE_TO_READONLY_VAR(false)
    DRI_CONF_ALLOW_DRAW_OUT_OF_ORDER(true)
+   DRI_CONF_ALLOW_DEFERRED_READPIXELS(false)
    DRI_CONF_GLTHREAD_NOP_CHECK_FRAMEBUFFER_STATUS(false)
+   DRI_CONF_GLTHREAD_ASYNC_GET_ERROR(false)
    DRI_CONF_FORCE_COMPAT_PROFILE(false)
    DRI_CONF_FORCE_COMPAT_SHADERS(false)
    DRI_CONF_FORCE_GL_NAMES_REUSE(false)
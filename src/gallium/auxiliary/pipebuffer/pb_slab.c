@@ -27,6 +27,7 @@
 
 #include "pb_slab.h"
 
+#include "util/u_atomic.h"
 #include "util/u_math.h"
 #include "util/u_memory.h"
 
@@ -71,12 +72,37 @@ pb_slab_reclaim(struct pb_slabs *slabs, struct pb_slab_entry *entry)
    }
 }
 
+/* Move entries pushed by pb_slab_free onto the tail of the reclaim list.
+ *
+ * Must be called with the mutex held. The stack pops most-recently freed
+ * first, so it is reversed while draining to keep the reclaim list ordered
+ * oldest-first.
+ */
+static void
+pb_slabs_drain_free_stack(struct pb_slabs *slabs)
+{
+   struct pb_slab_entry *entry = p_atomic_xchg(&slabs->free_stack, NULL);
+   struct list_head drained;
+
+   list_inithead(&drained);
+   while (entry) {
+      struct pb_slab_entry *next = entry->head.next ?
+         list_entry(entry->head.next, struct pb_slab_entry, head) : NULL;
+      list_add(&entry->head, &drained);
+      entry = next;
+   }
+
+   list_splicetail(&drained, &slabs->reclaim);
+}
+
 #define MAX_FAILED_RECLAIMS 2
 
 static unsigned
 pb_slabs_reclaim_locked(struct pb_slabs *slabs)
 {
    struct pb_slab_entry *entry, *next;
+
+   pb_slabs_drain_free_stack(slabs);
    unsigned num_failed_reclaims = 0;
    unsigned num_reclaims = 0;
    LIST_FOR_EACH_ENTRY_SAFE(entry, next, &slabs->reclaim, head) {
@@ -103,6 +129,9 @@ pb_slabs_reclaim_all_locked(struct pb_slabs *slabs)
 {
    struct pb_slab_entry *entry, *next;
    unsigned num_reclaims = 0;
+
+   pb_slabs_drain_free_stack(slabs);
+
    LIST_FOR_EACH_ENTRY_SAFE(entry, next, &slabs->reclaim, head) {
       if (slabs->can_reclaim(slabs->priv, entry)) {
          pb_slab_reclaim(slabs, entry);
@@ -210,9 +239,17 @@ pb_slab_alloc(struct pb_slabs *slabs, unsigned size, unsigned heap)
 void
 pb_slab_free(struct pb_slabs* slabs, struct pb_slab_entry *entry)
 {
-   simple_mtx_lock(&slabs->mutex);
-   list_addtail(&entry->head, &slabs->reclaim);
-   simple_mtx_unlock(&slabs->mutex);
+   struct pb_slab_entry *head;
+
+   /* Lock-free push; the entry is only linked into the reclaim list once
+    * some thread holds the mutex anyway (see pb_slabs_drain_free_stack).
+    * Popping is done exclusively by swapping out the whole stack, so the
+    * usual CAS ABA concerns don't apply.
+    */
+   do {
+      head = p_atomic_read(&slabs->free_stack);
+      entry->head.next = head ? &head->head : NULL;
+   } while (p_atomic_cmpxchg_ptr(&slabs->free_stack, head, entry) != head);
 }
 
 /* Check if any of the entries handed to pb_slab_free are ready to be re-used.
@@ -264,6 +301,7 @@ pb_slabs_init(struct pb_slabs *slabs,
    slabs->slab_free = slab_free;
 
    list_inithead(&slabs->reclaim);
+   slabs->free_stack = NULL;
 
    num_groups = slabs->num_orders * slabs->num_heaps *
                 (1 + allow_three_fourth_allocations);
@@ -290,6 +328,9 @@ pb_slabs_init(struct pb_slabs *slabs,
 void
 pb_slabs_deinit(struct pb_slabs *slabs)
 {
+   /* No other thread may free entries concurrently at this point. */
+   pb_slabs_drain_free_stack(slabs);
+
    /* Reclaim all slab entries (even those that are still in flight). This
     * implicitly calls slab_free for everything.
     */
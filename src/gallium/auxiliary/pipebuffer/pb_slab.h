@@ -128,6 +128,14 @@ struct pb_slabs
     */
    struct list_head reclaim;
 
+   /* Lock-free LIFO stack of freshly freed entries, linked through
+    * pb_slab_entry::head.next. pb_slab_free pushes here without taking the
+    * mutex; the stack is drained onto the tail of the reclaim list whenever
+    * the mutex is held anyway. This keeps the hottest call (freeing a buffer)
+    * off the mutex that all threads of a screen share.
+    */
+   struct pb_slab_entry *free_stack;
+
    void *priv;
    slab_can_reclaim_fn *can_reclaim;
    slab_alloc_fn *slab_alloc;
@@ -26,6 +26,18 @@
  *
  **************************************************************************/
 
+/* Scope note: this file only carries compute helpers that have in-tree
+ * pipe-level users (clears, mipgen).  Generic data-parallel primitives --
+ * prefix sums, reductions, histograms, sorting -- deliberately do not live
+ * here: the reusable building blocks for those are the NIR subgroup
+ * reduce/scan intrinsics, which every backend already lowers optimally, and
+ * drivers that need a full primitive build it with nir_builder next to its
+ * user (see radv's radix sort or asahi's geometry-shader prefix sum).  A
+ * pipe-level library would have to target the least capable driver and
+ * would ship untested until it gained a caller; add helpers here together
+ * with the frontend or aux code that uses them.
+ */
+
 #include "pipe/p_context.h"
 #include "pipe/p_state.h"
 
@@ -35,6 +47,7 @@
 #include "nir/nir_builder.h"
 #include "u_inlines.h"
 #include "u_compute.h"
+#include "u_math.h"
 
 static void *blit_compute_shader(struct pipe_context *ctx)
 {
@@ -217,3 +230,149 @@ void util_compute_blit(struct pipe_context *ctx, struct pipe_blit_info *blit_inf
    ctx->delete_sampler_state(ctx, sampler_state_p);
    ctx->bind_compute_state(ctx, NULL);
 }
+
+/* Fills a 2D range of an image with a constant color.  One thread per texel;
+ * the grid is trimmed with last_block, so no bounds check is needed.
+ *
+ *    #version 450
+ *
+ *    layout (local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+ *    layout (binding = 0, rgba32f) uniform writeonly image2DArray image;
+ *
+ *    layout (std140, binding = 0) uniform ubo
+ *    {
+ *       ivec4 dst;   // xy = clear box offset
+ *       vec4 color;
+ *    };
+ *
+ *    void main()
+ *    {
+ *       ivec3 pos = ivec3(gl_GlobalInvocationID.xyz);
+ *       imageStore(image, ivec3(pos.xy + dst.xy, pos.z), color);
+ *    }
+ */
+static void *clear_compute_shader(struct pipe_context *ctx)
+{
+   const struct glsl_type *image_type =
+      glsl_image_type(GLSL_SAMPLER_DIM_2D, /*is_array*/ true, GLSL_TYPE_FLOAT);
+   const nir_shader_compiler_options *options =
+      ctx->screen->get_compiler_options(ctx->screen, PIPE_SHADER_IR_NIR, PIPE_SHADER_COMPUTE);
+
+   nir_builder b = nir_builder_init_simple_shader(MESA_SHADER_COMPUTE, options, "clear_cs");
+   b.shader->info.workgroup_size[0] = 64;
+   b.shader->info.workgroup_size[1] = 1;
+   b.shader->info.workgroup_size[2] = 1;
+   b.shader->info.num_ubos = 1;
+
+   nir_def *zero = nir_imm_int(&b, 0);
+   nir_def *undef32 = nir_undef(&b, 1, 32);
+
+   nir_def *params[2];
+   b.shader->num_uniforms = ARRAY_SIZE(params);
+   for (unsigned i = 0; i < b.shader->num_uniforms; ++i)
+      params[i] = nir_load_ubo(&b, 4, 32, zero, nir_imm_int(&b, i * 16), .align_mul = 4, .range = ~0);
+
+   nir_variable *image = nir_variable_create(b.shader, nir_var_image, image_type, "image");
+   image->data.binding = 0;
+   image->data.image.format = PIPE_FORMAT_R32G32B32A32_FLOAT;
+   BITSET_SET(b.shader->info.images_used, 0);
+
+   nir_def *block_ids = nir_load_workgroup_id(&b);
+   nir_def *local_ids = nir_load_local_invocation_id(&b);
+   nir_def *ids = nir_iadd(&b, nir_imul(&b, block_ids, nir_imm_ivec3(&b, 64, 1, 1)), local_ids);
+
+   /* dst.zw are zero, so the layer passes through unchanged. */
+   nir_def *image_pos = nir_pad_vector_imm_int(&b, ids, 0, 4);
+   image_pos = nir_iadd(&b, image_pos, params[0]);
+   nir_image_deref_store(&b, &nir_build_deref_var(&b, image)->def, image_pos,
+                         undef32, params[1], zero);
+
+   ctx->screen->finalize_nir(ctx->screen, b.shader);
+
+   struct pipe_compute_state state = {0};
+   state.ir_type = PIPE_SHADER_IR_NIR;
+   state.prog = b.shader;
+
+   return ctx->create_compute_state(ctx, &state);
+}
+
+bool
+util_compute_clear_render_target(struct pipe_context *ctx,
+                                 struct pipe_surface *dst,
+                                 const union pipe_color_union *color,
+                                 unsigned dstx, unsigned dsty,
+                                 unsigned width, unsigned height,
+                                 void **compute_state)
+{
+   struct pipe_screen *screen = ctx->screen;
+   struct pipe_resource *res = dst->texture;
+   enum pipe_format format = util_format_linear(dst->format);
+
+   if (width == 0 || height == 0)
+      return true;
+
+   /* Image stores bypass sRGB encoding; pure-integer colors would need an
+    * integer image type.
+    */
+   if (res->nr_samples > 1 ||
+       util_format_is_depth_or_stencil(format) ||
+       util_format_is_pure_integer(format) ||
+       util_format_is_srgb(dst->format))
+      return false;
+
+   if (!screen->get_param(screen, PIPE_CAP_COMPUTE) ||
+       !(screen->get_shader_param(screen, PIPE_SHADER_COMPUTE,
+                                  PIPE_SHADER_CAP_SUPPORTED_IRS) &
+         (1 << PIPE_SHADER_IR_NIR)))
+      return false;
+
+   if (!screen->is_format_supported(screen, format, res->target,
+                                    res->nr_samples, res->nr_storage_samples,
+                                    PIPE_BIND_SHADER_IMAGE))
+      return false;
+
+   if (!*compute_state)
+      *compute_state = clear_compute_shader(ctx);
+   if (!*compute_state)
+      return false;
+
+   uint32_t data[] = {dstx, dsty, 0, 0,
+                      color->ui[0], color->ui[1], color->ui[2], color->ui[3]};
+
+   struct pipe_constant_buffer cb = {0};
+   cb.buffer_size = sizeof(data);
+   cb.user_buffer = data;
+   ctx->set_constant_buffer(ctx, PIPE_SHADER_COMPUTE, 0, false, &cb);
+
+   struct pipe_image_view image = {0};
+   image.resource = res;
+   image.shader_access = image.access = PIPE_IMAGE_ACCESS_WRITE;
+   image.format = format;
+   image.u.tex.level = dst->u.tex.level;
+   image.u.tex.first_layer = dst->u.tex.first_layer;
+   image.u.tex.last_layer = dst->u.tex.last_layer;
+
+   ctx->set_shader_images(ctx, PIPE_SHADER_COMPUTE, 0, 1, 0, &image);
+
+   ctx->bind_compute_state(ctx, *compute_state);
+
+   struct pipe_grid_info grid_info = {0};
+   grid_info.block[0] = 64;
+   grid_info.last_block[0] = width % 64;
+   grid_info.block[1] = 1;
+   grid_info.block[2] = 1;
+   grid_info.grid[0] = DIV_ROUND_UP(width, 64);
+   grid_info.grid[1] = height;
+   grid_info.grid[2] = dst->u.tex.last_layer - dst->u.tex.first_layer + 1;
+
+   ctx->launch_grid(ctx, &grid_info);
+
+   ctx->memory_barrier(ctx, PIPE_BARRIER_ALL);
+
+   ctx->set_shader_images(ctx, PIPE_SHADER_COMPUTE, 0, 0, 1, NULL);
+   ctx->set_constant_buffer(ctx, PIPE_SHADER_COMPUTE, 0, false, NULL);
+   ctx->bind_compute_state(ctx, NULL);
+
+   return true;
+}
+
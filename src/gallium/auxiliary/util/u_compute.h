@@ -38,6 +38,22 @@ extern "C" {
 void util_compute_blit(struct pipe_context *ctx, struct pipe_blit_info *blit_info,
                        void **compute_state);
 
+/* Compute-based render target clear writing the color with image stores, one
+ * thread per texel, avoiding the full-screen quad and the framebuffer state
+ * churn of util_blitter_clear_render_target().  Returns false if the surface
+ * format isn't storable (sRGB, pure integer, depth/stencil, MSAA), in which
+ * case the caller should fall back to the quad path.  Clobbers the compute
+ * shader, image and constant buffer bindings, so the caller must own the
+ * context state.  *compute_state caches the shader across calls; delete it
+ * with delete_compute_state at context teardown.
+ */
+bool util_compute_clear_render_target(struct pipe_context *ctx,
+                                      struct pipe_surface *dst,
+                                      const union pipe_color_union *color,
+                                      unsigned dstx, unsigned dsty,
+                                      unsigned width, unsigned height,
+                                      void **compute_state);
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,15 @@
  *   vs, tcs, tes, gs, fs. Instead, get the shader type from the IR.
  *
  * - Call util_live_shader_cache_deinit when you destroy your screen or context.
+ *
+ * Note that this cache cannot reduce shader memory usage by compressing or
+ * evicting "cold" entries. It doesn't own any shader memory: it only holds
+ * a reference and a SHA1 per CSO, and an entry exists exactly as long as
+ * some context holds a reference to it, so the pointer handed out by
+ * util_live_shader_cache_get must stay valid. Shrinking live shaders (e.g.
+ * keeping binaries compressed until first bind) has to happen inside the
+ * driver's create_shader/destroy_shader callbacks, which are the only code
+ * that knows the CSO layout.
  */
 
 #ifndef U_LIVE_SHADER_CACHE_H
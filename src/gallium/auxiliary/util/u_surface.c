@@ -74,6 +74,25 @@ util_copy_box(uint8_t * dst,
    unsigned z;
    dst += dst_z * dst_slice_stride;
    src += src_z * src_slice_stride;
+
+   /* A fully-linear box collapses into a single large memcpy, which reaches
+    * full memory bandwidth where a slice/row loop of small copies does not.
+    * util_copy_rect() catches this per slice; handle the multi-slice case
+    * here when the slices themselves are contiguous too.
+    */
+   if (depth > 1 && dst_x == 0 && dst_y == 0 && src_x == 0 && src_y == 0 &&
+       src_stride >= 0) {
+      uint64_t row_bytes = (uint64_t)util_format_get_stride(format, width);
+      uint64_t slice_bytes = (uint64_t)dst_stride *
+                             util_format_get_nblocksy(format, height);
+
+      if (row_bytes == dst_stride && row_bytes == (unsigned)src_stride &&
+          slice_bytes == dst_slice_stride && slice_bytes == src_slice_stride) {
+         memcpy(dst, src, slice_bytes * depth);
+         return;
+      }
+   }
+
    for (z = 0; z < depth; ++z) {
       util_copy_rect(dst,
                      format,
@@ -430,6 +430,20 @@ incr_rp_info(struct tc_renderpass_info *tc_info)
    return &info[1].info;
 }
 
+/* How far (in 8-byte slots) the prefetch walker in batch_execute stays ahead
+ * of call execution: 32 slots = 4 cache lines, typically a handful of calls.
+ */
+#define TC_PREFETCH_SLOTS 32
+
+/* All bind_*_state calls are generated by TC_FUNC1 with a single void *
+ * payload. Mirror that layout here so the prefetch walker can reach the CSO
+ * without a per-call table.
+ */
+struct tc_call_cso_bind {
+   struct tc_call_base base;
+   void *state;
+};
+
 ALWAYS_INLINE static void
 batch_execute(struct tc_batch *batch, struct pipe_context *pipe, uint64_t *last, bool parsing)
 {
@@ -438,12 +452,30 @@ batch_execute(struct tc_batch *batch, struct pipe_context *pipe, uint64_t *last,
     */
    bool first = !batch->first_set_fb;
    const tc_execute *execute_func = batch->tc->execute_func;
+   uint64_t *pf_iter = batch->slots;
 
    for (uint64_t *iter = batch->slots; iter != last;) {
       struct tc_call_base *call = (struct tc_call_base *)iter;
 
       tc_assert(call->sentinel == TC_SENTINEL);
 
+      /* Walk ahead of execution and start pulling in the memory upcoming
+       * calls will touch: the call slots themselves and, for CSO binds, the
+       * state object the driver is about to dereference. CSOs were written
+       * by the application thread, possibly long ago, so they are the main
+       * source of cold misses on the driver thread.
+       */
+      while (pf_iter != last && pf_iter < iter + TC_PREFETCH_SLOTS) {
+         struct tc_call_base *pf_call = (struct tc_call_base *)pf_iter;
+
+         if (pf_call->call_id >= TC_CALL_bind_blend_state &&
+             pf_call->call_id <= TC_CALL_bind_vertex_elements_state)
+            util_prefetch_read(((struct tc_call_cso_bind *)pf_call)->state);
+
+         pf_iter += pf_call->num_slots;
+         util_prefetch_read(pf_iter);
+      }
+
 #if TC_DEBUG >= 3
       tc_printf("CALL: %s", tc_call_names[call->call_id]);
 #endif
@@ -632,6 +664,7 @@ tc_add_sized_call(struct threaded_context *tc, enum tc_call_id id,
 
    struct tc_call_base *call = (struct tc_call_base*)&next->slots[next->num_total_slots];
    next->num_total_slots += num_slots;
+   tc->any_call_since_flush = true;
 
 #if !defined(NDEBUG) && TC_DEBUG >= 1
    call->sentinel = TC_SENTINEL;
@@ -1043,6 +1076,21 @@ tc_is_buffer_bound_for_write(struct threaded_context *tc, uint32_t id)
    return false;
 }
 
+/* Busyness is resolved at two levels.  The buffer lists below answer "is the
+ * buffer referenced by a batch this context hasn't flushed yet", which is the
+ * only question tc can answer by itself.  Once the buffer is clear of
+ * unflushed batches, the screen-level is_resource_busy callback answers for
+ * everything that has already reached the kernel, including work submitted by
+ * *other* contexts sharing the resource.  That second level is what makes
+ * shared buffers work without any cross-context flushing here: a consumer
+ * context mapping a buffer last written by a producer context gets a
+ * per-buffer answer from the winsys (GEM busy ioctl or equivalent) rather
+ * than having to fence or flush the producer wholesale.  Per-resource
+ * generation fences would only duplicate what the kernel already tracks.
+ * tres->is_shared only disables the optimizations that assume this context
+ * knows the full write history (valid-range-based unsynchronized maps,
+ * storage reallocation); it never forces a flush.
+ */
 static bool
 tc_is_buffer_busy(struct threaded_context *tc, struct threaded_resource *tbuf,
                   unsigned map_usage)
@@ -1796,6 +1844,18 @@ tc_set_scissor_states(struct pipe_context *_pipe,
                       const struct pipe_scissor_state *states)
 {
    struct threaded_context *tc = threaded_context(_pipe);
+   uint16_t mask = BITFIELD_RANGE(start, count);
+
+   /* Drop the call if all slots in the range are already set to these
+    * values. State-thrashy GL apps re-set the scissor constantly.
+    */
+   if ((tc->scissor_valid_mask & mask) == mask &&
+       !memcmp(&tc->shadow_scissors[start], states, count * sizeof(states[0])))
+      return;
+
+   memcpy(&tc->shadow_scissors[start], states, count * sizeof(states[0]));
+   tc->scissor_valid_mask |= mask;
+
    struct tc_scissors *p =
       tc_add_slot_based_call(tc, TC_CALL_set_scissor_states, tc_scissors, count);
 
@@ -1828,6 +1888,19 @@ tc_set_viewport_states(struct pipe_context *_pipe,
       return;
 
    struct threaded_context *tc = threaded_context(_pipe);
+   uint16_t mask = BITFIELD_RANGE(start, count);
+
+   /* Drop the call if all slots in the range are already set to these
+    * values. Comparing the raw bits is conservative: a float that changed
+    * representation is treated as a new state, which is always correct.
+    */
+   if ((tc->viewport_valid_mask & mask) == mask &&
+       !memcmp(&tc->shadow_viewports[start], states, count * sizeof(states[0])))
+      return;
+
+   memcpy(&tc->shadow_viewports[start], states, count * sizeof(states[0]));
+   tc->viewport_valid_mask |= mask;
+
    struct tc_viewports *p =
       tc_add_slot_based_call(tc, TC_CALL_set_viewport_states, tc_viewports, count);
 
@@ -2598,7 +2671,18 @@ tc_improve_map_buffer_flags(struct threaded_context *tc,
    }
 
    /* See if the buffer range being mapped has never been initialized or
-    * the buffer is idle, in which case it can be mapped unsynchronized. */
+    * the buffer is idle, in which case it can be mapped unsynchronized.
+    *
+    * This is the finest range granularity tc can offer. Tracking which
+    * ranges pending GPU work actually *reads* (to let non-overlapping
+    * writes through unsynchronized even on a busy, fully-valid buffer)
+    * isn't possible here: draws and dispatches reference whole buffers,
+    * and shader loads can hit any offset, so no per-range read set exists
+    * to check against. Writes that miss this fast path don't stall,
+    * though: small ones are enqueued as subdata calls below and larger
+    * ones take DISCARD_RANGE, which drivers service from a staging
+    * buffer (or an inline CP write) without waiting for the GPU.
+    */
    if (!(usage & PIPE_MAP_UNSYNCHRONIZED) &&
        ((!tres->is_shared &&
          !util_ranges_intersect(&tres->valid_buffer_range, offset, offset + size)) ||
@@ -2677,6 +2761,8 @@ tc_buffer_map(struct pipe_context *_pipe,
             tc_sync_msg(tc, "cpu storage GPU -> CPU copy");
             tc_set_driver_thread(tc);
 
+            /* Direct driver call, see the comment at the map call below. */
+            tc->any_call_since_flush = true;
             void *ret = pipe->buffer_map(pipe, tres->latest ? tres->latest : resource,
                                          0, PIPE_MAP_READ, &box2, &transfer2);
             memcpy(&((uint8_t*)tres->cpu_storage)[tres->valid_buffer_range.start],
@@ -2758,6 +2844,11 @@ tc_buffer_map(struct pipe_context *_pipe,
 
    tc->bytes_mapped_estimate += box->width;
 
+   /* Direct driver call: the flush coalescing check must not treat the
+    * last queued flush as still covering everything.
+    */
+   tc->any_call_since_flush = true;
+
    void *ret = pipe->buffer_map(pipe, tres->latest ? tres->latest : resource,
                                 level, usage, box, transfer);
    threaded_transfer(*transfer)->valid_buffer_range = &tres->valid_buffer_range;
@@ -2786,6 +2877,9 @@ tc_texture_map(struct pipe_context *_pipe,
 
    tc->bytes_mapped_estimate += box->width;
 
+   /* Direct driver call, see tc_buffer_map. */
+   tc->any_call_since_flush = true;
+
    void *ret = pipe->texture_map(pipe, tres->latest ? tres->latest : resource,
                                  level, usage, box, transfer);
 
@@ -3241,6 +3335,8 @@ tc_texture_subdata(struct pipe_context *_pipe,
          assert(fmt_layer_stride * box->depth <= UINT32_MAX);
 
          struct pipe_resource *pres = pipe_buffer_create(pipe->screen, 0, PIPE_USAGE_STREAM, layer_stride * box->depth);
+         /* Direct driver call, see tc_buffer_map. */
+         tc->any_call_since_flush = true;
          pipe->buffer_subdata(pipe, pres, unsync_usage, 0, layer_stride * box->depth, data);
          struct pipe_box src_box = *box;
          src_box.x = src_box.y = src_box.z = 0;
@@ -3292,6 +3388,8 @@ tc_texture_subdata(struct pipe_context *_pipe,
             tc_sync(tc);
             tc_set_driver_thread(tc);
          }
+         /* Direct driver call, see tc_buffer_map. */
+         tc->any_call_since_flush = true;
          pipe->texture_subdata(pipe, resource, level, usage, box, data,
                               stride, layer_stride);
          if (!can_unsync)
@@ -3616,6 +3714,16 @@ tc_flush(struct pipe_context *_pipe, struct pipe_fence_handle **fence,
       tc->in_renderpass = false;
 
    if (async && tc->options.create_fence) {
+      /* Coalesce back-to-back flushes: if no call has been recorded since
+       * the last queued non-deferred flush with the same flags, that flush
+       * already covers everything this one would submit, so don't push an
+       * empty batch through the worker queue and into another kernel
+       * submission.
+       */
+      if (!deferred && !fence && !tc->any_call_since_flush &&
+          tc->last_flush_flags == flags)
+         return;
+
       if (fence) {
          struct tc_batch *next = &tc->batch_slots[tc->next];
 
@@ -3650,6 +3758,8 @@ tc_flush(struct pipe_context *_pipe, struct pipe_fence_handle **fence,
          tc_signal_renderpass_info_ready(tc);
          tc_batch_flush(tc, false);
          tc->seen_fb_state = false;
+         tc->any_call_since_flush = false;
+         tc->last_flush_flags = flags;
       }
 
       return;
@@ -629,6 +629,12 @@ struct threaded_context {
    bool query_ended;
    /* whether pipe_context::flush has been called */
    bool flushing;
+   /* whether any call has been recorded since the last queued async flush;
+    * used to drop empty back-to-back flush submissions
+    */
+   bool any_call_since_flush;
+   /* flags of the last queued non-deferred async flush */
+   unsigned last_flush_flags;
 
    bool seen_streamout_buffers;
    bool seen_shader_buffers[PIPE_SHADER_TYPES];
@@ -664,6 +670,16 @@ struct threaded_context {
    uint64_t image_buffers_writeable_mask[PIPE_SHADER_TYPES];
    uint32_t sampler_buffers[PIPE_SHADER_TYPES][PIPE_MAX_SHADER_SAMPLER_VIEWS];
 
+   /* Shadow of the last viewport/scissor state recorded by the frontend
+    * thread, used to drop redundant state calls at enqueue time before they
+    * consume batch space. The valid masks track which slots have been
+    * recorded at least once because the initial driver state is unknown.
+    */
+   uint16_t viewport_valid_mask;
+   uint16_t scissor_valid_mask;
+   struct pipe_viewport_state shadow_viewports[PIPE_MAX_VIEWPORTS];
+   struct pipe_scissor_state shadow_scissors[PIPE_MAX_VIEWPORTS];
+
    struct tc_batch batch_slots[TC_MAX_BATCHES];
    struct tc_buffer_list buffer_lists[TC_MAX_BUFFER_LISTS];
    /* the current framebuffer attachments; [PIPE_MAX_COLOR_BUFS] is the zsbuf */
@@ -42,6 +42,8 @@ struct u_upload_mgr {
    struct pipe_context *pipe;
 
    unsigned default_size;  /* Minimum size of the upload buffer, in bytes. */
+   unsigned current_size;  /* Size to use for the next buffer; grows while
+                            * buffers keep getting exhausted. */
    unsigned bind;          /* Bitmask of PIPE_BIND_* flags. */
    enum pipe_resource_usage usage;
    unsigned flags;
@@ -68,6 +70,7 @@ u_upload_create(struct pipe_context *pipe, unsigned default_size,
 
    upload->pipe = pipe;
    upload->default_size = default_size;
+   upload->current_size = default_size;
    upload->bind = bind;
    upload->usage = usage;
    upload->flags = flags;
@@ -181,13 +184,24 @@ u_upload_alloc_buffer(struct u_upload_mgr *upload, unsigned min_size)
    struct pipe_resource buffer;
    unsigned size;
 
+   /* If we're here because the previous buffer filled up (rather than this
+    * being the first allocation), streaming is outpacing the buffer size.
+    * Double the size for the next buffer, so steady-state workloads converge
+    * on a handful of long-lived persistently-mapped buffers per frame
+    * instead of allocating and mapping a fresh one every time the ring
+    * wraps.
+    */
+   if (upload->buffer_size &&
+       upload->current_size < 16 * 1024 * 1024)
+      upload->current_size = MIN2(upload->current_size * 2, 16 * 1024 * 1024);
+
    /* Release the old buffer, if present:
     */
    u_upload_release_buffer(upload);
 
    /* Allocate a new one:
     */
-   size = align(MAX2(upload->default_size, min_size), 4096);
+   size = align(MAX2(upload->current_size, min_size), 4096);
 
    memset(&buffer, 0, sizeof buffer);
    buffer.target = PIPE_BUFFER;
@@ -83,6 +83,16 @@
  *
  * If there is nothing to do, it forwards every command to the driver.
  * The module also has its own CSO cache of vertex element states.
+ *
+ * Note that translation only kicks in when the layout is *incompatible*
+ * with the hardware.  Layouts the driver accepts are passed through even
+ * when they fetch inefficiently (e.g. a large stride with few used bytes):
+ * repacking those would cost a CPU translate pass over the vertex range on
+ * every draw, and nothing at this level tells us the app won't rewrite the
+ * buffer contents between draws, so there is no safe point to cache the
+ * repacked copy.  Apps that care should tighten their layouts; drivers that
+ * care can reject wasteful layouts via the format/stride CAPs and let the
+ * existing translate fallback do the packing.
  */
 
 #include "util/u_vbuf.h"
@@ -95,6 +105,7 @@
 #include "util/u_prim_restart.h"
 #include "util/u_screen.h"
 #include "util/u_upload_mgr.h"
+#include "util/xxhash.h"
 #include "indices/u_primconvert.h"
 #include "translate/translate.h"
 #include "translate/translate_cache.h"
@@ -157,6 +168,23 @@ enum {
    VB_NUM = 3
 };
 
+/* Direct-mapped cache of min/max index scan results for user index arrays.
+ * Client memory can be rewritten behind our back, so the content hash of the
+ * index data is both the key and the invalidation: a stale entry simply
+ * stops matching. Must be a power of two. */
+#define MINMAX_CACHE_SIZE 64
+/* Don't bother hashing tiny draws; the scan itself is cheaper. */
+#define MINMAX_CACHE_MIN_COUNT 64
+
+struct u_vbuf_minmax_cache_entry {
+   uint64_t hash; /* XXH64 of the index data, 0 = unused */
+   unsigned count;
+   unsigned restart_index;
+   uint8_t index_size;
+   bool primitive_restart;
+   unsigned min_index, max_index;
+};
+
 struct u_vbuf {
    struct u_vbuf_caps caps;
    bool has_signed_vb_offset;
@@ -201,6 +229,9 @@ struct u_vbuf {
    uint32_t incompatible_vb_mask; /* each bit describes a corresp. buffer */
    /* Which buffers are allowed (supported by hardware). */
    uint32_t allowed_vb_mask;
+
+   /* Min/max index scan results for repeated draws from client arrays. */
+   struct u_vbuf_minmax_cache_entry minmax_cache[MINMAX_CACHE_SIZE];
 };
 
 static void *
@@ -1390,6 +1421,50 @@ void u_vbuf_get_minmax_index(struct pipe_context *pipe,
    }
 }
 
+/* Like u_vbuf_get_minmax_index, but for user index arrays the result is
+ * cached under a content hash of the index data, so repeated draws of the
+ * same static client arrays skip the scan. */
+static void
+u_vbuf_get_minmax_index_cached(struct u_vbuf *mgr,
+                               const struct pipe_draw_info *info,
+                               const struct pipe_draw_start_count_bias *draw,
+                               unsigned *out_min_index, unsigned *out_max_index)
+{
+   if (!info->has_user_indices || draw->count < MINMAX_CACHE_MIN_COUNT) {
+      u_vbuf_get_minmax_index(mgr->pipe, info, draw,
+                              out_min_index, out_max_index);
+      return;
+   }
+
+   const void *indices = (const uint8_t*)info->index.user +
+                         draw->start * info->index_size;
+   uint64_t hash = XXH64(indices, (size_t)draw->count * info->index_size, 0);
+   struct u_vbuf_minmax_cache_entry *entry =
+      &mgr->minmax_cache[hash & (MINMAX_CACHE_SIZE - 1)];
+
+   if (entry->hash == hash &&
+       entry->count == draw->count &&
+       entry->index_size == info->index_size &&
+       entry->primitive_restart == info->primitive_restart &&
+       (!info->primitive_restart ||
+        entry->restart_index == info->restart_index)) {
+      *out_min_index = entry->min_index;
+      *out_max_index = entry->max_index;
+      return;
+   }
+
+   u_vbuf_get_minmax_index_mapped(info, draw->count, indices,
+                                  out_min_index, out_max_index);
+
+   entry->hash = hash;
+   entry->count = draw->count;
+   entry->index_size = info->index_size;
+   entry->primitive_restart = info->primitive_restart;
+   entry->restart_index = info->restart_index;
+   entry->min_index = *out_min_index;
+   entry->max_index = *out_max_index;
+}
+
 static void u_vbuf_set_driver_vertex_buffers(struct u_vbuf *mgr)
 {
    struct pipe_context *pipe = mgr->pipe;
@@ -1674,8 +1749,8 @@ void u_vbuf_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *inf
                min_index = new_info.min_index;
                max_index = new_info.max_index;
             } else {
-               u_vbuf_get_minmax_index(mgr->pipe, &new_info, &new_draw,
-                                       &min_index, &max_index);
+               u_vbuf_get_minmax_index_cached(mgr, &new_info, &new_draw,
+                                              &min_index, &max_index);
             }
 
             assert(min_index <= max_index);
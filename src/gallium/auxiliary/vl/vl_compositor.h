@@ -140,6 +140,7 @@ struct vl_compositor
    void *cs_video_buffer;
    void *cs_weave_rgb;
    void *cs_rgba;
+   void *cs_clear_rt;
 
    bool pipe_cs_composit_supported;
    bool pipe_gfx_supported;
@@ -224,6 +225,10 @@ vl_compositor_get_clear_color(struct vl_compositor_state *settings, union pipe_c
 
 /**
  * set the destination clipping
+ *
+ * This doubles as damage propagation: rendering is scissored to the clip, so
+ * a frontend that knows which output region changed can restrict
+ * re-compositing to it instead of paying full-frame fill rate per compose.
  */
 void
 vl_compositor_set_dst_clip(struct vl_compositor_state *settings, struct u_rect *dst_clip);
@@ -30,6 +30,7 @@
 #include <assert.h>
 
 #include "nir/nir_builder.h"
+#include "util/u_compute.h"
 #include "vl_compositor_cs.h"
 
 struct cs_viewport {
@@ -802,9 +803,27 @@ vl_compositor_cs_render(struct vl_compositor_state *s,
 
    if (clear_dirty && dirty_area &&
        (dirty_area->x0 < dirty_area->x1 || dirty_area->y0 < dirty_area->y1)) {
-
-      c->pipe->clear_render_target(c->pipe, dst_surface, &s->clear_color,
-                       0, 0, dst_surface->width, dst_surface->height, false);
+      /* Only the dirty area contains stale pixels, see
+       * vl_compositor_gfx_render().
+       */
+      unsigned x0 = MAX2(dirty_area->x0, 0);
+      unsigned y0 = MAX2(dirty_area->y0, 0);
+      unsigned x1 = MIN2((unsigned)dirty_area->x1, dst_surface->width);
+      unsigned y1 = MIN2((unsigned)dirty_area->y1, dst_surface->height);
+
+      if (x0 < x1 && y0 < y1) {
+         /* The compositor owns all compute bindings and rebinds them for
+          * every draw, so it can use the image-store clear and skip the
+          * framebuffer churn of the driver's quad-based path.  Falls back
+          * for formats the compute clear can't store.
+          */
+         if (!util_compute_clear_render_target(c->pipe, dst_surface,
+                                               &s->clear_color, x0, y0,
+                                               x1 - x0, y1 - y0,
+                                               &c->cs_clear_rt))
+            c->pipe->clear_render_target(c->pipe, dst_surface, &s->clear_color,
+                                         x0, y0, x1 - x0, y1 - y0, false);
+      }
       dirty_area->x0 = dirty_area->y0 = VL_COMPOSITOR_MAX_DIRTY;
       dirty_area->x1 = dirty_area->y1 = VL_COMPOSITOR_MIN_DIRTY;
    }
@@ -873,4 +892,6 @@ void vl_compositor_cs_cleanup_shaders(struct vl_compositor *c)
                 c->pipe->delete_compute_state(c->pipe, c->cs_rgb_yuv.y);
         if (c->cs_rgb_yuv.uv)
                 c->pipe->delete_compute_state(c->pipe, c->cs_rgb_yuv.uv);
+        if (c->cs_clear_rt)
+                c->pipe->delete_compute_state(c->pipe, c->cs_clear_rt);
 }
@@ -730,9 +730,18 @@ vl_compositor_gfx_render(struct vl_compositor_state *s,
 
    if (clear_dirty && dirty_area &&
        (dirty_area->x0 < dirty_area->x1 || dirty_area->y0 < dirty_area->y1)) {
-
-      c->pipe->clear_render_target(c->pipe, dst_surface, &s->clear_color,
-                                   0, 0, dst_surface->width, dst_surface->height, false);
+      /* Only the dirty area contains stale pixels; clearing the whole target
+       * wastes fill rate when it's a small rect. The dirty rect can extend to
+       * the VL_COMPOSITOR_*_DIRTY sentinels, so clamp it to the surface.
+       */
+      unsigned x0 = MAX2(dirty_area->x0, 0);
+      unsigned y0 = MAX2(dirty_area->y0, 0);
+      unsigned x1 = MIN2((unsigned)dirty_area->x1, dst_surface->width);
+      unsigned y1 = MIN2((unsigned)dirty_area->y1, dst_surface->height);
+
+      if (x0 < x1 && y0 < y1)
+         c->pipe->clear_render_target(c->pipe, dst_surface, &s->clear_color,
+                                      x0, y0, x1 - x0, y1 - y0, false);
       dirty_area->x0 = dirty_area->y0 = VL_COMPOSITOR_MAX_DIRTY;
       dirty_area->x1 = dirty_area->y1 = VL_COMPOSITOR_MIN_DIRTY;
    }
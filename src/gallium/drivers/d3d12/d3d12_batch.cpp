@@ -33,6 +33,7 @@
 
 #include "util/hash_table.h"
 #include "util/set.h"
+#include "util/u_atomic.h"
 #include "util/u_inlines.h"
 
 #include <dxguids/dxguids.h>
@@ -395,6 +396,9 @@ d3d12_batch_reference_resource(struct d3d12_batch *batch,
    uint8_t new_data = write ? batch_bo_reference_written : batch_bo_reference_read;
    uint8_t old_data = (uint8_t)*state;
    *state = (old_data | new_data);
+
+   if (write)
+      p_atomic_inc(&res->content_generation_id);
 }
 
 void
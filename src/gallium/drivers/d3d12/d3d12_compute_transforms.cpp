@@ -387,6 +387,56 @@ get_query_resolve(const nir_shader_compiler_options *options, const d3d12_comput
    return b.shader;
 }
 
+static struct nir_shader *
+get_prim_restart_rewrite(const nir_shader_compiler_options *options, const d3d12_compute_transform_key *key)
+{
+   nir_builder b = nir_builder_init_simple_shader(MESA_SHADER_COMPUTE, options, "PrimRestartRewrite");
+   b.shader->info.workgroup_size[0] = 64;
+   b.shader->info.workgroup_size[1] = 1;
+   b.shader->info.workgroup_size[2] = 1;
+
+   nir_variable *input_ssbo = nir_variable_create(b.shader, nir_var_mem_ssbo,
+      glsl_array_type(glsl_uint_type(), 0, 0), "input");
+   nir_variable *output_ssbo = nir_variable_create(b.shader, nir_var_mem_ssbo,
+      input_ssbo->type, "output");
+   input_ssbo->data.driver_location = 0;
+   output_ssbo->data.driver_location = 1;
+
+   nir_variable *state_var = nullptr;
+   nir_def *num_words_and_restart = d3d12_get_state_var(&b, D3D12_STATE_VAR_TRANSFORM_GENERIC0,
+      "d3d12_NumWordsRestart", glsl_uvec4_type(), &state_var);
+   nir_def *num_words = nir_channel(&b, num_words_and_restart, 0);
+   nir_def *restart_index = nir_channel(&b, num_words_and_restart, 1);
+
+   nir_def *word_id = nir_channel(&b, nir_load_global_invocation_id(&b, 32), 0);
+   nir_push_if(&b, nir_ult(&b, word_id, num_words));
+
+   nir_def *offset = nir_imul_imm(&b, word_id, sizeof(uint32_t));
+   nir_def *word = nir_load_ssbo(&b, 1, 32, nir_imm_int(&b, 0), offset, (gl_access_qualifier)0, 4, 0);
+
+   nir_def *rewritten;
+   if (key->prim_restart_rewrite.half_index_words) {
+      /* Two 16-bit indices per dword; rewrite each half on its own */
+      nir_def *lo = nir_iand_imm(&b, word, 0xffff);
+      nir_def *hi = nir_ushr_imm(&b, word, 16);
+      lo = nir_bcsel(&b, nir_ieq(&b, lo, restart_index), nir_imm_int(&b, 0xffff), lo);
+      hi = nir_bcsel(&b, nir_ieq(&b, hi, restart_index), nir_imm_int(&b, 0xffff), hi);
+      rewritten = nir_ior(&b, lo, nir_ishl_imm(&b, hi, 16));
+   } else {
+      rewritten = nir_bcsel(&b, nir_ieq(&b, word, restart_index),
+         nir_imm_int(&b, 0xffffffff), word);
+   }
+   nir_store_ssbo(&b, rewritten, nir_imm_int(&b, 1), offset, 1, (gl_access_qualifier)0, 4, 0);
+
+   nir_pop_if(&b, NULL);
+
+   nir_validate_shader(b.shader, "creation");
+   b.shader->info.num_ssbos = 2;
+   b.shader->info.num_ubos = 0;
+
+   return b.shader;
+}
+
 static struct nir_shader *
 create_compute_transform(const nir_shader_compiler_options *options, const d3d12_compute_transform_key *key)
 {
@@ -401,6 +451,8 @@ create_compute_transform(const nir_shader_compiler_options *options, const d3d12
       return get_draw_auto(options);
    case d3d12_compute_transform_type::query_resolve:
       return get_query_resolve(options, key);
+   case d3d12_compute_transform_type::prim_restart_rewrite:
+      return get_prim_restart_rewrite(options, key);
    default:
       unreachable("Invalid transform");
    }
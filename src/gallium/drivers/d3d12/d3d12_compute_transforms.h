@@ -47,6 +47,11 @@ enum class d3d12_compute_transform_type
    draw_auto,
    /* Accumulate queries together and write a 32-bit or 64-bit result */
    query_resolve,
+   /* Copy an index buffer, replacing an app-provided primitive restart index
+    * with the fixed 0xffff/0xffffffff strip-cut value so the draw can use the
+    * native restart path instead of being split on the CPU
+    */
+   prim_restart_rewrite,
    max,
 };
 
@@ -86,6 +91,11 @@ struct d3d12_compute_transform_key
          uint8_t is_signed : 1;
          float timestamp_multiplier;
       } query_resolve;
+
+      struct {
+         /* true for 16-bit indices (two per dword), else 32-bit */
+         unsigned half_index_words : 1;
+      } prim_restart_rewrite;
    };
 };
 
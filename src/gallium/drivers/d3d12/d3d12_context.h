@@ -288,6 +288,16 @@ struct d3d12_context {
    uint32_t transform_state_vars[8];
    struct pipe_query *timestamp_query;
 
+   /* Last primitive-restart index rewrite, so repeated draws with an
+    * unchanged index buffer reuse the rewritten copy */
+   struct {
+      struct pipe_resource *src;
+      struct pipe_resource *rewritten;
+      unsigned content_generation_id;
+      unsigned index_size;
+      uint32_t restart_index;
+   } restart_rewrite_cache;
+
    /* used by d3d12_blit.cpp */
    void *stencil_resolve_vs, *stencil_resolve_fs, *stencil_resolve_fs_no_flip, *sampler_state;
 #endif // HAVE_GALLIUM_D3D12_GRAPHICS
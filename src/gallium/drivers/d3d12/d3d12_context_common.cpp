@@ -115,6 +115,8 @@ d3d12_context_destroy(struct pipe_context *pctx)
       d3d12_tcs_variant_cache_destroy(ctx);
       d3d12_gfx_pipeline_state_cache_destroy(ctx);
       util_primconvert_destroy(ctx->primconvert);
+      pipe_resource_reference(&ctx->restart_rewrite_cache.src, nullptr);
+      pipe_resource_reference(&ctx->restart_rewrite_cache.rewritten, nullptr);
       pipe_resource_reference(&ctx->pstipple.texture, nullptr);
       pipe_sampler_view_reference(&ctx->pstipple.sampler_view, nullptr);
       util_dynarray_fini(&ctx->recently_destroyed_bos);
@@ -220,6 +222,7 @@ d3d12_replace_buffer_storage(struct pipe_context *pctx,
    d3d12_bo_reference(src->bo);
    dst->bo = src->bo;
    p_atomic_inc(&dst->generation_id);
+   p_atomic_inc(&dst->content_generation_id);
 #ifdef HAVE_GALLIUM_D3D12_GRAPHICS
    struct d3d12_context *ctx = d3d12_context(pctx);
    if ((d3d12_screen(pctx->screen)->max_feature_level >= D3D_FEATURE_LEVEL_11_0)
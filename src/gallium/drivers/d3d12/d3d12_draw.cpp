@@ -33,6 +33,7 @@
 #include "d3d12_surface.h"
 
 #include "indices/u_primconvert.h"
+#include "util/u_atomic.h"
 #include "util/u_debug.h"
 #include "util/u_draw.h"
 #include "util/u_helpers.h"
@@ -751,6 +752,15 @@ d3d12_last_vertex_stage(struct d3d12_context *ctx)
    return sel;
 }
 
+/* Rewrite an indirect argument buffer on the GPU so that draw parameter
+ * sysvals (base vertex/instance, draw ID) can be sourced per-draw. The
+ * transform is a small compute dispatch reading the app's argument buffer
+ * as an SSBO; when a count buffer is present it is bound as a cbuf and the
+ * shader skips draws past the dynamic count. Nothing here reads the
+ * arguments back on the CPU, and the subsequent ExecuteIndirect still
+ * consumes the count buffer natively, so culling-driven multi-draw batches
+ * never stall the queue.
+ */
 static bool
 update_draw_indirect_with_sysvals(struct d3d12_context *ctx,
    const struct pipe_draw_info *dinfo,
@@ -880,6 +890,81 @@ update_draw_auto(struct d3d12_context *ctx,
    return true;
 }
 
+/* Copy the index buffer on the GPU, replacing an app-provided primitive
+ * restart index with the fixed strip-cut value, so the draw can use the
+ * native restart path instead of mapping the index buffer and splitting the
+ * draw on the CPU.  The rewritten copy is cached on the context and reused
+ * until the source buffer contents change.
+ */
+static struct pipe_resource *
+update_restart_index_buffer(struct d3d12_context *ctx,
+                            const struct pipe_draw_info *dinfo)
+{
+   struct d3d12_resource *src = d3d12_resource(dinfo->index.resource);
+   unsigned generation = p_atomic_read(&src->content_generation_id);
+   /* Out-of-bounds words of a partial tail dword read as zero and have their
+    * stores dropped, so rounding up is safe.
+    */
+   unsigned num_words = DIV_ROUND_UP(src->base.b.width0, sizeof(uint32_t));
+
+   if (ctx->restart_rewrite_cache.src == &src->base.b &&
+       ctx->restart_rewrite_cache.content_generation_id == generation &&
+       ctx->restart_rewrite_cache.index_size == dinfo->index_size &&
+       ctx->restart_rewrite_cache.restart_index == dinfo->restart_index)
+      return ctx->restart_rewrite_cache.rewritten;
+
+   pipe_resource output_buf_templ = {};
+   output_buf_templ.target = PIPE_BUFFER;
+   output_buf_templ.bind = PIPE_BIND_INDEX_BUFFER;
+   output_buf_templ.width0 = src->base.b.width0;
+   output_buf_templ.height0 = output_buf_templ.depth0 = output_buf_templ.array_size =
+      output_buf_templ.last_level = 1;
+   output_buf_templ.usage = PIPE_USAGE_DEFAULT;
+
+   struct pipe_resource *rewritten =
+      ctx->base.screen->resource_create(ctx->base.screen, &output_buf_templ);
+   if (!rewritten)
+      return NULL;
+
+   d3d12_compute_transform_save_restore save;
+   d3d12_save_compute_transform_state(ctx, &save);
+
+   d3d12_compute_transform_key key;
+   memset(&key, 0, sizeof(key));
+   key.type = d3d12_compute_transform_type::prim_restart_rewrite;
+   key.prim_restart_rewrite.half_index_words = dinfo->index_size == 2;
+   ctx->base.bind_compute_state(&ctx->base, d3d12_get_compute_transform(ctx, &key));
+
+   ctx->transform_state_vars[0] = num_words;
+   ctx->transform_state_vars[1] = dinfo->restart_index;
+
+   pipe_shader_buffer new_cs_ssbos[2];
+   new_cs_ssbos[0].buffer = &src->base.b;
+   new_cs_ssbos[0].buffer_offset = 0;
+   new_cs_ssbos[0].buffer_size = src->base.b.width0;
+   new_cs_ssbos[1].buffer = rewritten;
+   new_cs_ssbos[1].buffer_offset = 0;
+   new_cs_ssbos[1].buffer_size = rewritten->width0;
+   ctx->base.set_shader_buffers(&ctx->base, PIPE_SHADER_COMPUTE, 0, 2, new_cs_ssbos, 2);
+
+   pipe_grid_info grid = {};
+   grid.block[0] = 64;
+   grid.block[1] = grid.block[2] = 1;
+   grid.grid[0] = DIV_ROUND_UP(num_words, 64);
+   grid.grid[1] = grid.grid[2] = 1;
+   ctx->base.launch_grid(&ctx->base, &grid);
+
+   d3d12_restore_compute_transform_state(ctx, &save);
+
+   pipe_resource_reference(&ctx->restart_rewrite_cache.src, &src->base.b);
+   pipe_resource_reference(&ctx->restart_rewrite_cache.rewritten, NULL);
+   ctx->restart_rewrite_cache.rewritten = rewritten;
+   ctx->restart_rewrite_cache.content_generation_id = generation;
+   ctx->restart_rewrite_cache.index_size = dinfo->index_size;
+   ctx->restart_rewrite_cache.restart_index = dinfo->restart_index;
+   return rewritten;
+}
+
 void
 d3d12_draw_vbo(struct pipe_context *pctx,
                const struct pipe_draw_info *dinfo,
@@ -904,10 +989,21 @@ d3d12_draw_vbo(struct pipe_context *pctx,
    enum d3d12_surface_conversion_mode conversion_modes[PIPE_MAX_COLOR_BUFS] = {};
    struct pipe_draw_indirect_info patched_indirect = {};
 
+   /* A restart index other than the fixed strip-cut values can be rewritten
+    * on the GPU; fall back to the CPU path only when that isn't possible.
+    */
+   struct pipe_resource *restart_index_buffer = NULL;
+   bool needs_restart_rewrite = dinfo->primitive_restart &&
+      dinfo->restart_index != 0xffff && dinfo->restart_index != 0xffffffff;
+   if (needs_restart_rewrite &&
+       prim_supported((enum mesa_prim)dinfo->mode) &&
+       dinfo->index_size != 1 &&
+       !dinfo->has_user_indices)
+      restart_index_buffer = update_restart_index_buffer(ctx, dinfo);
+
    if (!prim_supported((enum mesa_prim)dinfo->mode) ||
        dinfo->index_size == 1 ||
-       (dinfo->primitive_restart && dinfo->restart_index != 0xffff &&
-        dinfo->restart_index != 0xffffffff)) {
+       (needs_restart_rewrite && !restart_index_buffer)) {
 
       if (!dinfo->primitive_restart &&
           !indirect &&
@@ -1008,13 +1104,17 @@ d3d12_draw_vbo(struct pipe_context *pctx,
             return;
          }
       } else {
-         index_buffer = dinfo->index.resource;
+         index_buffer = restart_index_buffer ?
+            restart_index_buffer : dinfo->index.resource;
       }
 
       if (dinfo->primitive_restart) {
-         assert(dinfo->restart_index == 0xffff ||
-                dinfo->restart_index == 0xffffffff);
-         ib_strip_cut_value = dinfo->restart_index == 0xffff ?
+         unsigned restart_index = restart_index_buffer ?
+            util_prim_restart_index_from_size(dinfo->index_size) :
+            dinfo->restart_index;
+         assert(restart_index == 0xffff ||
+                restart_index == 0xffffffff);
+         ib_strip_cut_value = restart_index == 0xffff ?
             D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF :
             D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFFFFFF;
       }
@@ -32,6 +32,7 @@
 #include "pipebuffer/pb_bufmgr.h"
 #include "util/slab.h"
 #include "util/format/u_format.h"
+#include "util/u_atomic.h"
 #include "util/u_inlines.h"
 #include "util/u_memory.h"
 #include "util/format/u_format_zs.h"
@@ -1425,9 +1426,11 @@ synchronize(struct d3d12_context *ctx,
       d3d12_resource_wait_idle(ctx, res, usage & PIPE_MAP_WRITE);
    }
 
-   if (usage & PIPE_MAP_WRITE)
+   if (usage & PIPE_MAP_WRITE) {
       util_range_add(&res->base.b, &res->valid_buffer_range,
                      range->Begin, range->End);
+      p_atomic_inc(&res->content_generation_id);
+   }
 
    return true;
 }
@@ -57,6 +57,10 @@ struct d3d12_resource {
    struct util_range valid_buffer_range;
    uint32_t bind_counts[PIPE_SHADER_TYPES][D3D12_RESOURCE_BINDING_TYPES];
    unsigned generation_id;
+   /* Bumped whenever the resource contents may have changed (CPU write maps,
+    * GPU writes, storage replacement), to key caches of data derived from
+    * those contents. */
+   unsigned content_generation_id;
 };
 
 struct d3d12_memory_object {
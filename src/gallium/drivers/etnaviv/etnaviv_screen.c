@@ -36,6 +36,7 @@
 #include "etnaviv_format.h"
 #include "etnaviv_query.h"
 #include "etnaviv_resource.h"
+#include "etnaviv_transfer.h"
 #include "etnaviv_translate.h"
 
 #include "util/hash_table.h"
@@ -101,6 +102,7 @@ etna_screen_destroy(struct pipe_screen *pscreen)
 
    util_dynarray_fini(&screen->supported_pm_queries);
 
+   etna_transfer_screen_fini(pscreen);
    etna_shader_screen_fini(pscreen);
 
    if (screen->pipe_nn)
@@ -1153,6 +1155,9 @@ etna_screen_create(struct etna_device *dev, struct etna_gpu *gpu,
    if (!etna_shader_screen_init(pscreen))
       goto fail;
 
+   if (!etna_transfer_screen_init(pscreen))
+      goto fail;
+
    etna_fence_screen_init(pscreen);
    etna_query_screen_init(pscreen);
    etna_resource_screen_init(pscreen);
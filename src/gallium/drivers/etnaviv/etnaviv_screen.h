@@ -66,6 +66,8 @@ struct etna_screen {
 
    struct etna_compiler *compiler;
    struct util_queue shader_compiler_queue;
+   /* workers for software tile/untile of large transfers */
+   struct util_queue tile_queue;
 
    /* dummy render target for GPUs that can't fully disable the color pipe */
    struct etna_reloc dummy_rt_reloc;
@@ -36,8 +36,10 @@
 #include "pipe/p_screen.h"
 #include "pipe/p_state.h"
 #include "util/format/u_format.h"
+#include "util/u_cpu_detect.h"
 #include "util/u_inlines.h"
 #include "util/u_memory.h"
+#include "util/u_queue.h"
 #include "util/u_surface.h"
 #include "util/u_transfer.h"
 
@@ -60,6 +62,122 @@ etna_compute_offset(enum pipe_format format, const struct pipe_box *box,
              util_format_get_blocksize(format);
 }
 
+/* Linear data size above which tile/untile conversions are split across the
+ * screen's tiling queue. Small transfers aren't worth the synchronization
+ * overhead.
+ */
+#define ETNA_PARALLEL_TILE_THRESHOLD (256 * 1024)
+
+/* Chunk heights are aligned to the 4x4 tile layout of
+ * etna_texture_(un)tile, so each worker owns whole rows of tiles. Workers
+ * never write the same word even with unaligned boxes, since every source
+ * row maps to a distinct set of words within a tile.
+ */
+#define ETNA_TILE_CHUNK_ALIGN 4
+#define ETNA_MAX_TILE_CHUNKS 8
+
+struct etna_tile_job {
+   struct util_queue_fence fence;
+   bool untile;
+   void *dest, *src;
+   unsigned basex, basey;
+   unsigned surf_stride; /* stride of the tiled surface */
+   unsigned lin_stride;  /* stride of the linear buffer */
+   unsigned width, height;
+   unsigned elmtsize;
+};
+
+static void
+etna_tile_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct etna_tile_job *job = data;
+
+   if (job->untile)
+      etna_texture_untile(job->dest, job->src, job->basex, job->basey,
+                          job->surf_stride, job->width, job->height,
+                          job->lin_stride, job->elmtsize);
+   else
+      etna_texture_tile(job->dest, job->src, job->basex, job->basey,
+                        job->surf_stride, job->width, job->height,
+                        job->lin_stride, job->elmtsize);
+}
+
+/* Tile or untile a box, splitting large conversions into row chunks that
+ * are processed in parallel on the screen's tiling queue. The last chunk
+ * always runs on the calling thread. dest/src and the stride arguments
+ * follow the same convention as etna_texture_(un)tile: the tiled surface
+ * side uses surf_stride, the linear side lin_stride.
+ */
+static void
+etna_texture_tile_box(struct etna_screen *screen, bool untile, void *dest,
+                      void *src, unsigned basex, unsigned basey,
+                      unsigned surf_stride, unsigned width, unsigned height,
+                      unsigned lin_stride, unsigned elmtsize)
+{
+   struct etna_tile_job jobs[ETNA_MAX_TILE_CHUNKS];
+   unsigned num_chunks = 1;
+
+   if ((size_t)lin_stride * height >= ETNA_PARALLEL_TILE_THRESHOLD) {
+      num_chunks = MIN3(screen->tile_queue.num_threads + 1,
+                        ETNA_MAX_TILE_CHUNKS,
+                        DIV_ROUND_UP(height, ETNA_TILE_CHUNK_ALIGN));
+   }
+
+   unsigned chunk_height =
+      align(DIV_ROUND_UP(height, num_chunks), ETNA_TILE_CHUNK_ALIGN);
+   num_chunks = DIV_ROUND_UP(height, chunk_height);
+
+   for (unsigned i = 0; i < num_chunks; i++) {
+      struct etna_tile_job *job = &jobs[i];
+      unsigned y = i * chunk_height;
+
+      job->untile = untile;
+      /* Only the linear side advances with the chunk; the tiled side is
+       * addressed through basey.
+       */
+      job->dest = untile ? dest + y * lin_stride : dest;
+      job->src = untile ? src : src + y * lin_stride;
+      job->basex = basex;
+      job->basey = basey + y;
+      job->surf_stride = surf_stride;
+      job->lin_stride = lin_stride;
+      job->width = width;
+      job->height = MIN2(chunk_height, height - y);
+      job->elmtsize = elmtsize;
+
+      if (i < num_chunks - 1) {
+         util_queue_fence_init(&job->fence);
+         util_queue_add_job(&screen->tile_queue, job, &job->fence,
+                            etna_tile_job_execute, NULL, 0);
+      } else {
+         etna_tile_job_execute(job, NULL, 0);
+      }
+   }
+
+   for (unsigned i = 0; i < num_chunks - 1; i++) {
+      util_queue_fence_wait(&jobs[i].fence);
+      util_queue_fence_destroy(&jobs[i].fence);
+   }
+}
+
+bool
+etna_transfer_screen_init(struct pipe_screen *pscreen)
+{
+   struct etna_screen *screen = etna_screen(pscreen);
+   unsigned num_threads = util_get_cpu_caps()->nr_cpus - 1;
+
+   num_threads = MIN2(MAX2(1, num_threads), ETNA_MAX_TILE_CHUNKS - 1);
+
+   return util_queue_init(&screen->tile_queue, "etna_tile",
+                          ETNA_MAX_TILE_CHUNKS, num_threads, 0, NULL);
+}
+
+void
+etna_transfer_screen_fini(struct pipe_screen *pscreen)
+{
+   util_queue_destroy(&etna_screen(pscreen)->tile_queue);
+}
+
 static void etna_patch_data(void *buffer, const struct pipe_transfer *ptrans)
 {
    struct pipe_resource *prsc = ptrans->resource;
@@ -136,7 +254,8 @@ etna_transfer_unmap(struct pipe_context *pctx, struct pipe_transfer *ptrans)
          /* map buffer object */
          if (rsc->layout == ETNA_LAYOUT_TILED) {
             for (unsigned z = 0; z < ptrans->box.depth; z++) {
-               etna_texture_tile(
+               etna_texture_tile_box(
+                  ctx->screen, false,
                   trans->mapped + (ptrans->box.z + z) * res_level->layer_stride,
                   trans->staging + z * ptrans->layer_stride,
                   ptrans->box.x, ptrans->box.y,
@@ -409,11 +528,12 @@ etna_transfer_map(struct pipe_context *pctx, struct pipe_resource *prsc,
       if (usage & PIPE_MAP_READ) {
          if (rsc->layout == ETNA_LAYOUT_TILED) {
             for (unsigned z = 0; z < ptrans->box.depth; z++) {
-               etna_texture_untile(trans->staging + z * ptrans->layer_stride,
-                                   trans->mapped + (ptrans->box.z + z) * res_level->layer_stride,
-                                   ptrans->box.x, ptrans->box.y, res_level->stride,
-                                   ptrans->box.width, ptrans->box.height, ptrans->stride,
-                                   util_format_get_blocksize(rsc->base.format));
+               etna_texture_tile_box(ctx->screen, true,
+                                     trans->staging + z * ptrans->layer_stride,
+                                     trans->mapped + (ptrans->box.z + z) * res_level->layer_stride,
+                                     ptrans->box.x, ptrans->box.y, res_level->stride,
+                                     ptrans->box.width, ptrans->box.height, ptrans->stride,
+                                     util_format_get_blocksize(rsc->base.format));
             }
          } else if (rsc->layout == ETNA_LAYOUT_LINEAR) {
             util_copy_box(trans->staging, rsc->base.format, ptrans->stride,
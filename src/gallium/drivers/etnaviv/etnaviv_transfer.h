@@ -32,4 +32,10 @@
 void
 etna_transfer_init(struct pipe_context *pctx);
 
+bool
+etna_transfer_screen_init(struct pipe_screen *pscreen);
+
+void
+etna_transfer_screen_fini(struct pipe_screen *pscreen);
+
 #endif
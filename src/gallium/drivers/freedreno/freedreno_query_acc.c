@@ -24,6 +24,7 @@
  *    Rob Clark <robclark@freedesktop.org>
  */
 
+#include "util/u_atomic.h"
 #include "util/u_inlines.h"
 #include "util/u_memory.h"
 
@@ -134,15 +135,42 @@ fd_acc_end_query(struct fd_context *ctx, struct fd_query *q) assert_dt
 
    /* mark the result available: */
    struct fd_batch *batch = fd_context_batch(ctx);
-   struct fd_ringbuffer *ring = batch->draw;
    struct fd_resource *rsc = fd_resource(aq->prsc);
 
-   if (ctx->screen->gen < 5) {
+   /* Make sure the batch writing the availability flag is tracked as a
+    * writer, so fd_bc_flush_writer() in get_query_result() flushes it.
+    */
+   fd_screen_lock(ctx->screen);
+   fd_batch_resource_write(batch, rsc);
+   fd_screen_unlock(ctx->screen);
+
+   if (ctx->screen->gen >= 6) {
+      /* On a6xx+ the tile epilogues accumulate the per-tile results, so the
+       * result is only complete once the batch epilogue (run after all
+       * tiles) has executed. Write the availability flag there, ordered
+       * after any outstanding memory writes, which also allows
+       * get_query_result() to poll it on the CPU without waiting for the
+       * bo to go idle.
+       */
+      struct fd_ringbuffer *ring = fd_batch_get_epilogue(batch);
+
+      fd_ringbuffer_attach_bo(ring, rsc->bo);
+
+      OUT_PKT7(ring, CP_WAIT_MEM_WRITES, 0);
+      OUT_PKT7(ring, CP_MEM_WRITE, 4);
+      OUT_RELOC(ring, rsc->bo, 0, 0, 0);
+      OUT_RING(ring, 1);     /* low 32b */
+      OUT_RING(ring, 0);     /* high 32b */
+   } else if (ctx->screen->gen < 5) {
+      struct fd_ringbuffer *ring = batch->draw;
+
       OUT_PKT3(ring, CP_MEM_WRITE, 3);
       OUT_RELOC(ring, rsc->bo, 0, 0, 0);
       OUT_RING(ring, 1);     /* low 32b */
       OUT_RING(ring, 0);     /* high 32b */
    } else {
+      struct fd_ringbuffer *ring = batch->draw;
+
       OUT_PKT7(ring, CP_MEM_WRITE, 4);
       OUT_RELOC(ring, rsc->bo, 0, 0, 0);
       OUT_RING(ring, 1);     /* low 32b */
@@ -179,16 +207,25 @@ fd_acc_get_query_result(struct fd_context *ctx, struct fd_query *q, bool wait,
       fd_context_access_end(ctx);
    }
 
-   if (!wait) {
-      int ret = fd_resource_wait(
-         ctx, rsc, FD_BO_PREP_READ | FD_BO_PREP_NOSYNC | FD_BO_PREP_FLUSH);
-      if (ret)
-         return false;
-   } else {
-      fd_resource_wait(ctx, rsc, FD_BO_PREP_READ);
+   struct fd_acc_query_sample *s = fd_bo_map(rsc->bo);
+
+   /* On a6xx+ the GPU writes the availability flag once the sample
+    * accumulation is complete, so if it is already set we can read the
+    * result straight from the mapped buffer without a kernel roundtrip.
+    */
+   bool avail = (ctx->screen->gen >= 6) && p_atomic_read(&s->avail);
+
+   if (!avail) {
+      if (!wait) {
+         int ret = fd_resource_wait(
+            ctx, rsc, FD_BO_PREP_READ | FD_BO_PREP_NOSYNC | FD_BO_PREP_FLUSH);
+         if (ret)
+            return false;
+      } else {
+         fd_resource_wait(ctx, rsc, FD_BO_PREP_READ);
+      }
    }
 
-   struct fd_acc_query_sample *s = fd_bo_map(rsc->bo);
    p->result(aq, s, result);
 
    return true;
@@ -35,6 +35,17 @@
  * The kernel will make sure these are resident and pinned at the correct
  * virtual memory address before executing our batch.  If a BO is not in
  * the validation list, it effectively does not exist, so take care.
+ *
+ * The multiple batches per context (render/compute/blitter) map work of
+ * *different kinds* onto different engines; they are not a vehicle for
+ * splitting one render pass across engine instances.  Consecutive draws
+ * in a GL context are ordered: blending, depth and primitive order must
+ * observe earlier draws, and our state tracking assumes each batch sees
+ * the full state stream.  Distributing alternate draws over two kernel
+ * contexts would need a cross-engine merge that serializes on exactly
+ * the ordering we tried to avoid.  CP-bound apps get parallelism the
+ * supported way: multiple API contexts/threads, which iris already runs
+ * on separate kernel contexts.
  */
 
 #include "iris_batch.h"
@@ -25,6 +25,7 @@
 #include "pipe/p_state.h"
 #include "pipe/p_context.h"
 #include "pipe/p_screen.h"
+#include "util/box.h"
 #include "util/format/u_format.h"
 #include "util/u_inlines.h"
 #include "util/u_surface.h"
@@ -552,9 +553,9 @@ iris_blit(struct pipe_context *ctx, const struct pipe_blit_info *info)
 
       tex_cache_flush_hack(batch, src_fmt.fmt, src_res->surf.format);
 
-      iris_resource_finish_render(ice, dst_res, info->dst.level,
-                                  info->dst.box.z, info->dst.box.depth,
-                                  dst_aux_usage);
+      iris_resource_finish_render_region(ice, dst_res, info->dst.level,
+                                         info->dst.box.z, info->dst.box.depth,
+                                         dst_aux_usage, &info->dst.box);
    }
 
    blorp_batch_finish(&blorp_batch);
@@ -732,8 +733,11 @@ iris_copy_region(struct blorp_context *blorp,
          iris_batch_sync_region_end(batch);
       }
 
-      iris_resource_finish_write(ice, dst_res, dst_level, dstz,
-                                 src_box->depth, dst_aux_usage);
+      struct pipe_box dst_box;
+      u_box_2d(dstx, dsty, src_box->width, src_box->height, &dst_box);
+      iris_resource_finish_write_region(ice, dst_res, dst_level, dstz,
+                                        src_box->depth, dst_aux_usage,
+                                        &dst_box);
    }
 
    blorp_batch_finish(&blorp_batch);
@@ -242,6 +242,16 @@ struct iris_bufmgr {
    struct iris_border_color_pool border_color_pool;
 
    struct iris_bo *dummy_aux_bo;
+
+   /**
+    * Cache of recycled drm_syncobj handles (one is consumed per batch
+    * flush).  "Dirty" handles may still carry the signalled fence from
+    * their previous life; they are batch-reset into the "clean" list with
+    * a single ioctl once the clean list runs empty.
+    */
+   simple_mtx_t syncobj_lock;
+   struct util_dynarray syncobj_clean;
+   struct util_dynarray syncobj_dirty;
 };
 
 static simple_mtx_t global_bufmgr_list_mutex = SIMPLE_MTX_INITIALIZER;
@@ -464,6 +474,87 @@ error_export:
    return NULL;
 }
 
+/* Cap on the number of recycled syncobj handles we keep around; handles
+ * beyond this are closed outright.  Steady state only needs one per batch
+ * per context, plus whatever fences the app holds on to.
+ */
+#define MAX_CACHED_SYNCOBJS 64
+
+/**
+ * Get a fresh (unsignalled) drm_syncobj handle, reusing a recycled one if
+ * possible.  At steady state this replaces the per-flush create/destroy
+ * ioctl pair with one amortized SYNCOBJ_RESET of the whole dirty list.
+ */
+uint32_t
+iris_bufmgr_create_syncobj_handle(struct iris_bufmgr *bufmgr)
+{
+   uint32_t handle = 0;
+
+   simple_mtx_lock(&bufmgr->syncobj_lock);
+
+   if (util_dynarray_num_elements(&bufmgr->syncobj_clean, uint32_t) == 0 &&
+       util_dynarray_num_elements(&bufmgr->syncobj_dirty, uint32_t) > 0) {
+      struct drm_syncobj_array args = {
+         .handles = (uintptr_t) util_dynarray_begin(&bufmgr->syncobj_dirty),
+         .count_handles =
+            util_dynarray_num_elements(&bufmgr->syncobj_dirty, uint32_t),
+      };
+
+      if (intel_ioctl(bufmgr->fd, DRM_IOCTL_SYNCOBJ_RESET, &args) == 0) {
+         util_dynarray_append_dynarray(&bufmgr->syncobj_clean,
+                                       &bufmgr->syncobj_dirty);
+      } else {
+         /* Shouldn't happen; just close them and fall back to creating. */
+         util_dynarray_foreach(&bufmgr->syncobj_dirty, uint32_t, h) {
+            struct drm_syncobj_destroy destroy = { .handle = *h };
+            intel_ioctl(bufmgr->fd, DRM_IOCTL_SYNCOBJ_DESTROY, &destroy);
+         }
+      }
+      util_dynarray_clear(&bufmgr->syncobj_dirty);
+   }
+
+   if (util_dynarray_num_elements(&bufmgr->syncobj_clean, uint32_t) > 0)
+      handle = util_dynarray_pop(&bufmgr->syncobj_clean, uint32_t);
+
+   simple_mtx_unlock(&bufmgr->syncobj_lock);
+
+   if (!handle) {
+      struct drm_syncobj_create args = { .flags = 0 };
+      intel_ioctl(bufmgr->fd, DRM_IOCTL_SYNCOBJ_CREATE, &args);
+      handle = args.handle;
+   }
+
+   return handle;
+}
+
+/**
+ * Return a no-longer-referenced syncobj handle to the cache (or close it
+ * if the cache is full).  The handle may still be signalled; it won't be
+ * handed out again until it has been reset.
+ */
+void
+iris_bufmgr_destroy_syncobj_handle(struct iris_bufmgr *bufmgr,
+                                   uint32_t handle)
+{
+   bool cached = false;
+
+   simple_mtx_lock(&bufmgr->syncobj_lock);
+
+   if (util_dynarray_num_elements(&bufmgr->syncobj_clean, uint32_t) +
+       util_dynarray_num_elements(&bufmgr->syncobj_dirty, uint32_t) <
+       MAX_CACHED_SYNCOBJS) {
+      util_dynarray_append(&bufmgr->syncobj_dirty, uint32_t, handle);
+      cached = true;
+   }
+
+   simple_mtx_unlock(&bufmgr->syncobj_lock);
+
+   if (!cached) {
+      struct drm_syncobj_destroy args = { .handle = handle };
+      intel_ioctl(bufmgr->fd, DRM_IOCTL_SYNCOBJ_DESTROY, &args);
+   }
+}
+
 /* Import the state of a sync_file_fd (which we should have gotten from
  * batch_syncobj_to_sync_file_fd) into a BO as its implicit synchronization
  * state.
@@ -515,6 +606,19 @@ iris_bo_wait_syncobj(struct iris_bo *bo, int64_t timeout_ns)
       for (int b = 0; b < IRIS_BATCH_COUNT; b++) {
          struct iris_syncobj *r = bo->deps[d].read_syncobjs[b];
          struct iris_syncobj *w = bo->deps[d].write_syncobjs[b];
+
+         /* Syncobjs already seen signalled can't go busy again; drop the
+          * dep instead of asking the kernel about it another time.
+          */
+         if (r && r->signaled) {
+            iris_syncobj_reference(bufmgr, &bo->deps[d].read_syncobjs[b], NULL);
+            r = NULL;
+         }
+         if (w && w->signaled) {
+            iris_syncobj_reference(bufmgr, &bo->deps[d].write_syncobjs[b], NULL);
+            w = NULL;
+         }
+
          if (r)
             handles[handle_count++] = r->handle;
          if (w)
@@ -543,9 +647,16 @@ iris_bo_wait_syncobj(struct iris_bo *bo, int64_t timeout_ns)
       goto out;
    }
 
-   /* We just waited everything, so clean all the deps. */
+   /* We just waited everything, so clean all the deps.  Mark the syncobjs
+    * signalled first: other BOs tracking the same submissions can then skip
+    * the kernel round trip entirely.
+    */
    for (int d = 0; d < bo->deps_size; d++) {
       for (int b = 0; b < IRIS_BATCH_COUNT; b++) {
+         if (bo->deps[d].write_syncobjs[b])
+            bo->deps[d].write_syncobjs[b]->signaled = true;
+         if (bo->deps[d].read_syncobjs[b])
+            bo->deps[d].read_syncobjs[b]->signaled = true;
          iris_syncobj_reference(bufmgr, &bo->deps[d].write_syncobjs[b], NULL);
          iris_syncobj_reference(bufmgr, &bo->deps[d].read_syncobjs[b], NULL);
       }
@@ -1871,6 +1982,18 @@ iris_bufmgr_destroy(struct iris_bufmgr *bufmgr)
       bo_close(bo);
    }
 
+   /* Close any recycled syncobj handles. */
+   util_dynarray_foreach(&bufmgr->syncobj_clean, uint32_t, h) {
+      struct drm_syncobj_destroy args = { .handle = *h };
+      intel_ioctl(bufmgr->fd, DRM_IOCTL_SYNCOBJ_DESTROY, &args);
+   }
+   util_dynarray_fini(&bufmgr->syncobj_clean);
+   util_dynarray_foreach(&bufmgr->syncobj_dirty, uint32_t, h) {
+      struct drm_syncobj_destroy args = { .handle = *h };
+      intel_ioctl(bufmgr->fd, DRM_IOCTL_SYNCOBJ_DESTROY, &args);
+   }
+   util_dynarray_fini(&bufmgr->syncobj_dirty);
+
    _mesa_hash_table_destroy(bufmgr->name_table, NULL);
    _mesa_hash_table_destroy(bufmgr->handle_table, NULL);
 
@@ -1885,6 +2008,7 @@ iris_bufmgr_destroy(struct iris_bufmgr *bufmgr)
 
    simple_mtx_destroy(&bufmgr->lock);
    simple_mtx_destroy(&bufmgr->bo_deps_lock);
+   simple_mtx_destroy(&bufmgr->syncobj_lock);
 
    free(bufmgr);
 }
@@ -2342,6 +2466,9 @@ iris_bufmgr_create(struct intel_device_info *devinfo, int fd, bool bo_reuse)
 
    simple_mtx_init(&bufmgr->lock, mtx_plain);
    simple_mtx_init(&bufmgr->bo_deps_lock, mtx_plain);
+   simple_mtx_init(&bufmgr->syncobj_lock, mtx_plain);
+   util_dynarray_init(&bufmgr->syncobj_clean, NULL);
+   util_dynarray_init(&bufmgr->syncobj_dirty, NULL);
 
    list_inithead(&bufmgr->zombie_list);
 
@@ -628,6 +628,10 @@ int iris_bufmgr_create_screen_id(struct iris_bufmgr *bufmgr);
 
 simple_mtx_t *iris_bufmgr_get_bo_deps_lock(struct iris_bufmgr *bufmgr);
 
+uint32_t iris_bufmgr_create_syncobj_handle(struct iris_bufmgr *bufmgr);
+void iris_bufmgr_destroy_syncobj_handle(struct iris_bufmgr *bufmgr,
+                                        uint32_t handle);
+
 /**
  * A pool containing SAMPLER_BORDER_COLOR_STATE entries.
  *
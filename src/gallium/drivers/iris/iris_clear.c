@@ -442,8 +442,8 @@ clear_color(struct iris_context *ice,
 
    iris_dirty_for_history(ice, res);
 
-   iris_resource_finish_render(ice, res, level,
-                               box->z, box->depth, aux_usage);
+   iris_resource_finish_render_region(ice, res, level,
+                                      box->z, box->depth, aux_usage, box);
 }
 
 static bool
@@ -65,15 +65,15 @@ gem_syncobj_destroy(int fd, uint32_t handle)
 struct iris_syncobj *
 iris_create_syncobj(struct iris_bufmgr *bufmgr)
 {
-   int fd = iris_bufmgr_get_fd(bufmgr);
    struct iris_syncobj *syncobj = malloc(sizeof(*syncobj));
 
    if (!syncobj)
       return NULL;
 
-   syncobj->handle = gem_syncobj_create(fd, 0);
+   syncobj->handle = iris_bufmgr_create_syncobj_handle(bufmgr);
    assert(syncobj->handle);
 
+   syncobj->signaled = false;
    pipe_reference_init(&syncobj->ref, 1);
 
    return syncobj;
@@ -82,8 +82,7 @@ iris_create_syncobj(struct iris_bufmgr *bufmgr)
 void
 iris_syncobj_destroy(struct iris_bufmgr *bufmgr, struct iris_syncobj *syncobj)
 {
-   int fd = iris_bufmgr_get_fd(bufmgr);
-   gem_syncobj_destroy(fd, syncobj->handle);
+   iris_bufmgr_destroy_syncobj_handle(bufmgr, syncobj->handle);
    free(syncobj);
 }
 
@@ -99,6 +98,8 @@ iris_syncobj_signal(struct iris_bufmgr *bufmgr, struct iris_syncobj *syncobj)
    if (intel_ioctl(fd, DRM_IOCTL_SYNCOBJ_SIGNAL, &args)) {
       fprintf(stderr, "failed to signal syncobj %"PRIu32"\n",
               syncobj->handle);
+   } else {
+      syncobj->signaled = true;
    }
 }
 
@@ -218,6 +219,9 @@ iris_wait_syncobj(struct iris_bufmgr *bufmgr,
    if (!syncobj)
       return false;
 
+   if (syncobj->signaled)
+      return true;
+
    int fd = iris_bufmgr_get_fd(bufmgr);
 
    struct drm_syncobj_wait args = {
@@ -225,7 +229,11 @@ iris_wait_syncobj(struct iris_bufmgr *bufmgr,
       .count_handles = 1,
       .timeout_nsec = timeout_nsec,
    };
-   return intel_ioctl(fd, DRM_IOCTL_SYNCOBJ_WAIT, &args) == 0;
+   if (intel_ioctl(fd, DRM_IOCTL_SYNCOBJ_WAIT, &args) != 0)
+      return false;
+
+   syncobj->signaled = true;
+   return true;
 }
 
 #define CSI "\e["
@@ -36,6 +36,12 @@ struct iris_bufmgr;
 struct iris_syncobj {
    struct pipe_reference ref;
    uint32_t handle;
+
+   /* Set once the syncobj has been observed (or made) signalled.  iris never
+    * resets syncobjs, so this is monotonic and lets busy-checks skip the
+    * kernel.  Races are benign: a stale false only costs an extra ioctl.
+    */
+   bool signaled;
 };
 
 struct iris_syncobj *iris_create_syncobj(struct iris_bufmgr *bufmgr);
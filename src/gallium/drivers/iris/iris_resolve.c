@@ -498,6 +498,83 @@ iris_predraw_flush_buffers(struct iris_context *ice,
    }
 }
 
+/**
+ * Whether dirty-region tracking applies to the given slice.
+ *
+ * Only simple 2D color surfaces with CCS are tracked; everything else keeps
+ * the conservative whole-slice resolve behavior.
+ */
+static bool
+aux_dirty_region_tracked(const struct iris_resource *res,
+                         uint32_t level, uint32_t layer)
+{
+   return isl_aux_usage_has_ccs(res->aux.usage) &&
+          !isl_aux_usage_has_mcs(res->aux.usage) &&
+          !(res->surf.usage & ISL_SURF_USAGE_DEPTH_BIT) &&
+          !(res->surf.usage & ISL_SURF_USAGE_STENCIL_BIT) &&
+          res->surf.levels == 1 &&
+          res->surf.logical_level0_px.array_len == 1 &&
+          res->surf.logical_level0_px.depth == 1 &&
+          res->surf.samples == 1 &&
+          level == 0 && layer == 0;
+}
+
+/**
+ * Accumulate a write into the dirty region.  A NULL box dirties the whole
+ * slice.
+ */
+static void
+aux_dirty_region_add(struct iris_resource *res, uint32_t level,
+                     uint32_t start_layer, uint32_t num_layers,
+                     const struct pipe_box *box)
+{
+   if (!aux_dirty_region_tracked(res, level, start_layer))
+      return;
+
+   if (res->aux.dirty.full)
+      return;
+
+   if (box == NULL || num_layers != 1) {
+      res->aux.dirty.full = true;
+      return;
+   }
+
+   /* Normalize the box; flipped blits may have negative dimensions. */
+   const uint32_t x0 = MAX2(MIN2(box->x, box->x + box->width), 0);
+   const uint32_t y0 = MAX2(MIN2(box->y, box->y + box->height), 0);
+   const uint32_t x1 = MAX2(box->x, box->x + box->width);
+   const uint32_t y1 = MAX2(box->y, box->y + box->height);
+
+   if (res->aux.dirty.x1 <= res->aux.dirty.x0 ||
+       res->aux.dirty.y1 <= res->aux.dirty.y0) {
+      res->aux.dirty.x0 = x0;
+      res->aux.dirty.y0 = y0;
+      res->aux.dirty.x1 = x1;
+      res->aux.dirty.y1 = y1;
+   } else {
+      res->aux.dirty.x0 = MIN2(res->aux.dirty.x0, x0);
+      res->aux.dirty.y0 = MIN2(res->aux.dirty.y0, y0);
+      res->aux.dirty.x1 = MAX2(res->aux.dirty.x1, x1);
+      res->aux.dirty.y1 = MAX2(res->aux.dirty.y1, y1);
+   }
+}
+
+/**
+ * Mark the slice as fully resolved (called after an aux operation which
+ * leaves no unresolved data behind).
+ */
+static void
+aux_dirty_region_clean(struct iris_resource *res, uint32_t level,
+                       uint32_t layer)
+{
+   if (!aux_dirty_region_tracked(res, level, layer))
+      return;
+
+   res->aux.dirty.full = false;
+   res->aux.dirty.x0 = res->aux.dirty.y0 = 0;
+   res->aux.dirty.x1 = res->aux.dirty.y1 = 0;
+}
+
 static void
 iris_resolve_color(struct iris_context *ice,
                    struct iris_batch *batch,
@@ -507,6 +584,22 @@ iris_resolve_color(struct iris_context *ice,
 {
    //DBG("%s to mt %p level %u layer %u\n", __func__, mt, level, layer);
 
+   /* If the dirty region for this slice is known, clip the resolve to it.
+    * An empty region means nothing was written since the last full resolve,
+    * so the blorp pass (and its end-of-pipe syncs) can be skipped entirely.
+    */
+   const bool use_dirty_region =
+      (resolve_op == ISL_AUX_OP_FULL_RESOLVE ||
+       resolve_op == ISL_AUX_OP_PARTIAL_RESOLVE) &&
+      batch->screen->devinfo->ver >= 9 &&
+      aux_dirty_region_tracked(res, level, layer) &&
+      !res->aux.dirty.full;
+
+   if (use_dirty_region &&
+       (res->aux.dirty.x1 <= res->aux.dirty.x0 ||
+        res->aux.dirty.y1 <= res->aux.dirty.y0))
+      return;
+
    struct blorp_surf surf;
    iris_blorp_surf_for_resource(batch, &surf, &res->base.b,
                                 res->aux.usage, level, true);
@@ -545,8 +638,15 @@ iris_resolve_color(struct iris_context *ice,
    iris_batch_sync_region_start(batch);
    struct blorp_batch blorp_batch;
    blorp_batch_init(&ice->blorp, &blorp_batch, batch, 0);
-   blorp_ccs_resolve(&blorp_batch, &surf, level, layer, 1, res->surf.format,
-                     resolve_op);
+   if (use_dirty_region) {
+      blorp_ccs_resolve_region(&blorp_batch, &surf, level, layer, 1,
+                               res->surf.format, resolve_op,
+                               res->aux.dirty.x0, res->aux.dirty.y0,
+                               res->aux.dirty.x1, res->aux.dirty.y1);
+   } else {
+      blorp_ccs_resolve(&blorp_batch, &surf, level, layer, 1,
+                        res->surf.format, resolve_op);
+   }
    blorp_batch_finish(&blorp_batch);
 
    /* See comment above */
@@ -558,6 +658,13 @@ iris_resolve_color(struct iris_context *ice,
    }
 
    iris_batch_sync_region_end(batch);
+
+   /* Everything in the slice is now consistent with the resolved state,
+    * except after a partial resolve, which leaves compressed non-clear data
+    * behind.
+    */
+   if (resolve_op != ISL_AUX_OP_PARTIAL_RESOLVE)
+      aux_dirty_region_clean(res, level, layer);
 }
 
 static void
@@ -932,10 +1039,23 @@ iris_resource_finish_write(struct iris_context *ice,
                            struct iris_resource *res, uint32_t level,
                            uint32_t start_layer, uint32_t num_layers,
                            enum isl_aux_usage aux_usage)
+{
+   iris_resource_finish_write_region(ice, res, level, start_layer,
+                                     num_layers, aux_usage, NULL);
+}
+
+void
+iris_resource_finish_write_region(struct iris_context *ice,
+                                  struct iris_resource *res, uint32_t level,
+                                  uint32_t start_layer, uint32_t num_layers,
+                                  enum isl_aux_usage aux_usage,
+                                  const struct pipe_box *box)
 {
    if (res->aux.usage == ISL_AUX_USAGE_NONE)
       return;
 
+   aux_dirty_region_add(res, level, start_layer, num_layers, box);
+
    const uint32_t level_layers =
       miptree_layer_range_length(res, level, start_layer, num_layers);
 
@@ -994,6 +1114,13 @@ iris_resource_set_aux_state(struct iris_context *ice,
              res->surf.msaa_layout == ISL_MSAA_LAYOUT_ARRAY);
    }
 
+   /* Fast clears write the aux buffer without going through
+    * iris_resource_finish_write, so catch them here.
+    */
+   if (aux_state == ISL_AUX_STATE_CLEAR ||
+       aux_state == ISL_AUX_STATE_PARTIAL_CLEAR)
+      aux_dirty_region_add(res, level, start_layer, num_layers, NULL);
+
    for (unsigned a = 0; a < num_layers; a++) {
       if (res->aux.state[level][start_layer + a] != aux_state) {
          res->aux.state[level][start_layer + a] = aux_state;
@@ -1353,3 +1480,14 @@ iris_resource_finish_render(struct iris_context *ice,
    iris_resource_finish_write(ice, res, level, start_layer, layer_count,
                               aux_usage);
 }
+
+void
+iris_resource_finish_render_region(struct iris_context *ice,
+                                   struct iris_resource *res, uint32_t level,
+                                   uint32_t start_layer, uint32_t layer_count,
+                                   enum isl_aux_usage aux_usage,
+                                   const struct pipe_box *box)
+{
+   iris_resource_finish_write_region(ice, res, level, start_layer,
+                                     layer_count, aux_usage, box);
+}
@@ -575,6 +575,11 @@ create_aux_state_map(struct iris_resource *res, enum isl_aux_state initial)
 {
    assert(res->aux.state == NULL);
 
+   /* The aux contents aren't known yet (e.g. imports with modifiers), so
+    * start with the whole surface considered dirty for resolves.
+    */
+   res->aux.dirty.full = true;
+
    uint32_t total_slices = 0;
    for (uint32_t level = 0; level < res->surf.levels; level++)
       total_slices += iris_get_num_logical_layers(res, level);
@@ -1564,6 +1569,7 @@ iris_reallocate_resource_inplace(struct iris_context *ice,
 
    if (new_res->aux.state) {
       assert(old_res->aux.state);
+      old_res->aux.dirty.full = true;
       for (unsigned l = 0; l <= templ.last_level; l++) {
          unsigned layers = util_num_layers(&templ, l);
          for (unsigned z = 0; z < layers; z++) {
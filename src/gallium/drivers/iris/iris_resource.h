@@ -147,6 +147,21 @@ struct iris_resource {
        * aux state for each slice.
        */
       enum isl_aux_state **state;
+
+      /**
+       * \brief Region of the surface which may need resolving.
+       *
+       * Only tracked for single-level, non-array, single-sampled color
+       * surfaces with CCS, so that small GPU writes (e.g. a compositor
+       * updating a cursor-sized region of a 4K scanout surface) don't
+       * force full-surface resolves.  The rectangle is in pixels of the
+       * base level; \c full overrides it and an empty rectangle
+       * (x1 <= x0 or y1 <= y0) means everything is already resolved.
+       */
+      struct {
+         bool full;
+         uint32_t x0, y0, x1, y1;
+      } dirty;
    } aux;
 
    /**
@@ -414,6 +429,21 @@ iris_resource_finish_write(struct iris_context *ice,
                            uint32_t start_layer, uint32_t num_layers,
                            enum isl_aux_usage aux_usage);
 
+/**
+ * Like iris_resource_finish_write, but with the written region known.
+ *
+ * Callers which know which pixels they wrote (blits, copies, scissored
+ * clears) should use this variant so that a later resolve can be clipped
+ * to the dirty region.  A NULL box means the whole slice may have been
+ * written.
+ */
+void
+iris_resource_finish_write_region(struct iris_context *ice,
+                                  struct iris_resource *res, uint32_t level,
+                                  uint32_t start_layer, uint32_t num_layers,
+                                  enum isl_aux_usage aux_usage,
+                                  const struct pipe_box *box);
+
 /** Get the auxiliary compression state of a miptree slice */
 enum isl_aux_state
 iris_resource_get_aux_state(const struct iris_resource *res,
@@ -509,4 +539,10 @@ void iris_resource_finish_render(struct iris_context *ice,
                                  struct iris_resource *res, uint32_t level,
                                  uint32_t start_layer, uint32_t layer_count,
                                  enum isl_aux_usage aux_usage);
+void iris_resource_finish_render_region(struct iris_context *ice,
+                                        struct iris_resource *res,
+                                        uint32_t level, uint32_t start_layer,
+                                        uint32_t layer_count,
+                                        enum isl_aux_usage aux_usage,
+                                        const struct pipe_box *box);
 #endif
@@ -60,6 +60,11 @@ struct lima_fs_compiled_shader {
 struct lima_fs_uncompiled_shader {
    struct pipe_shader_state base;
    unsigned char nir_sha1[20];
+   /* Bitmask of samplers the shader actually references, used to
+    * normalize the shader key: swizzles of bound but unused samplers
+    * must not force a different variant.
+    */
+   uint32_t textures_used;
 };
 
 struct lima_fs_key {
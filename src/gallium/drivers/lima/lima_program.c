@@ -133,7 +133,7 @@ lima_program_optimize_vs_nir(struct nir_shader *s)
       NIR_PASS(progress, s, nir_opt_dce);
       NIR_PASS(progress, s, nir_opt_dead_cf);
       NIR_PASS(progress, s, nir_opt_cse);
-      NIR_PASS(progress, s, nir_opt_peephole_select, 8, true, true);
+      NIR_PASS(progress, s, nir_opt_peephole_select, 8, 8, true, true);
       NIR_PASS(progress, s, nir_opt_algebraic);
       NIR_PASS(progress, s, lima_nir_lower_ftrunc);
       NIR_PASS(progress, s, nir_opt_constant_folding);
@@ -243,7 +243,7 @@ lima_program_optimize_fs_nir(struct nir_shader *s,
       NIR_PASS(progress, s, nir_opt_dce);
       NIR_PASS(progress, s, nir_opt_dead_cf);
       NIR_PASS(progress, s, nir_opt_cse);
-      NIR_PASS(progress, s, nir_opt_peephole_select, 8, true, true);
+      NIR_PASS(progress, s, nir_opt_peephole_select, 8, 8, true, true);
       NIR_PASS(progress, s, nir_opt_algebraic);
       NIR_PASS(progress, s, nir_opt_constant_folding);
       NIR_PASS(progress, s, nir_opt_undef);
@@ -421,6 +421,11 @@ lima_create_fs_state(struct pipe_context *pctx,
    so->base.type = PIPE_SHADER_IR_NIR;
    so->base.ir.nir = nir;
 
+   /* Both the GL frontend and tgsi_to_nir have run
+    * nir_shader_gather_info by this point.
+    */
+   so->textures_used = nir->info.textures_used[0];
+
    /* Serialize the NIR to a binary blob that we can hash for the disk
     * cache.  Drop unnecessary information (like variable names)
     * so the serialized NIR is smaller, and also to let us detect more
@@ -616,7 +621,12 @@ lima_update_fs_state(struct lima_context *ctx)
                            PIPE_SWIZZLE_Z, PIPE_SWIZZLE_W };
    for (int i = 0; i < lima_tex->num_textures; i++) {
       struct lima_sampler_view *sampler = lima_sampler_view(lima_tex->textures[i]);
-      if (!sampler) {
+      /* Normalize the key: swizzles of samplers the shader never
+       * references are don't-care bits, so keep them at identity to
+       * avoid recompiling (and re-looking-up) an identical program
+       * whenever unused texture slots churn.
+       */
+      if (!sampler || !(ctx->uncomp_fs->textures_used & (1u << i))) {
          memcpy(key->tex[i].swizzle, identity, 4);
          continue;
       }
@@ -547,60 +547,32 @@ lp_scene_is_resource_referenced(const struct lp_scene *scene,
 }
 
 
-/** advance curr_x,y to the next bin */
-static bool
-next_bin(struct lp_scene *scene)
-{
-   scene->curr_x++;
-   if (scene->curr_x >= scene->tiles_x) {
-      scene->curr_x = 0;
-      scene->curr_y++;
-   }
-   if (scene->curr_y >= scene->tiles_y) {
-      /* no more bins */
-      return false;
-   }
-   return true;
-}
-
-
 void
 lp_scene_bin_iter_begin(struct lp_scene *scene)
 {
-   scene->curr_x = scene->curr_y = -1;
+   p_atomic_set(&scene->curr_bin, 0);
 }
 
 
 /**
  * Return pointer to next bin to be rendered.
- * The lp_scene::curr_x and ::curr_y fields will be advanced.
  * Multiple rendering threads will call this function to get a chunk
- * of work (a bin) to work on.
+ * of work (a bin) to work on.  Bins are claimed with a single atomic
+ * add so that idle threads never wait on a busy one; a thread stuck
+ * on an expensive bin simply stops claiming new ones and the rest of
+ * the scene is drained by its siblings.
  */
 struct cmd_bin *
 lp_scene_bin_iter_next(struct lp_scene *scene , int *x, int *y)
 {
-   struct cmd_bin *bin = NULL;
+   unsigned bin_idx = (unsigned)p_atomic_add_return(&scene->curr_bin, 1) - 1;
 
-   mtx_lock(&scene->mutex);
-
-   if (scene->curr_x < 0) {
-      /* first bin */
-      scene->curr_x = 0;
-      scene->curr_y = 0;
-   } else if (!next_bin(scene)) {
-      /* no more bins left */
-      goto end;
-   }
-
-   bin = lp_scene_get_bin(scene, scene->curr_x, scene->curr_y);
-   *x = scene->curr_x;
-   *y = scene->curr_y;
+   if (bin_idx >= scene->tiles_x * scene->tiles_y)
+      return NULL;
 
-end:
-   /*printf("return bin %p at %d, %d\n", (void *) bin, *bin_x, *bin_y);*/
-   mtx_unlock(&scene->mutex);
-   return bin;
+   *x = bin_idx % scene->tiles_x;
+   *y = bin_idx / scene->tiles_x;
+   return lp_scene_get_bin(scene, *x, *y);
 }
 
 
@@ -195,7 +195,7 @@ struct lp_scene {
     */
    unsigned tiles_x, tiles_y;
 
-   int curr_x, curr_y;  /**< for iterating over bins */
+   int curr_bin;  /**< next bin to hand out, taken with an atomic add */
    mtx_t mutex;
 
    unsigned num_alloced_tiles;
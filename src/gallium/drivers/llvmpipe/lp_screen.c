@@ -39,6 +39,7 @@
 #include "gallivm/lp_bld_type.h"
 #include "gallivm/lp_bld_nir.h"
 #include "util/disk_cache.h"
+#include "util/hash_table.h"
 #include "util/hex.h"
 #include "util/os_misc.h"
 #include "util/os_time.h"
@@ -883,6 +884,14 @@ llvmpipe_is_format_supported(struct pipe_screen *_screen,
 }
 
 
+/* Presents raw pixels to the sw winsys. For remote display targets the knob
+ * for cutting transfer size is the damage list (nboxes/sub_box) we forward
+ * below: a winsys serving a network transport can ship only the changed
+ * boxes. Compressing or diffing the pixel data itself belongs in that
+ * transport, not here — by the time we present, the scene (and its per-tile
+ * state) is long gone, so a tile-level diff would need a shadow copy of the
+ * previous frame, which a remote transport already keeps anyway.
+ */
 static void
 llvmpipe_flush_frontbuffer(struct pipe_screen *_screen,
                            struct pipe_context *_pipe,
@@ -923,6 +932,16 @@ llvmpipe_destroy_screen(struct pipe_screen *_screen)
 
    disk_cache_destroy(screen->disk_shader_cache);
 
+   if (screen->mem_shader_cache) {
+      hash_table_foreach(screen->mem_shader_cache, entry) {
+         struct lp_mem_cached_shader *mem = entry->data;
+         free(mem->data);
+         FREE(mem);
+      }
+      _mesa_hash_table_destroy(screen->mem_shader_cache, NULL);
+   }
+   mtx_destroy(&screen->mem_shader_cache_mutex);
+
    glsl_type_singleton_decref();
 
 #ifdef HAVE_LIBDRM
@@ -1031,6 +1050,59 @@ llvmpipe_screen_get_fd(struct pipe_screen *_screen)
 }
 
 
+struct lp_mem_cached_shader {
+   unsigned char sha1[20];
+   void *data;
+   size_t data_size;
+};
+
+
+static uint32_t
+lp_mem_shader_cache_hash(const void *key)
+{
+   return _mesa_hash_data(key, 20);
+}
+
+
+static bool
+lp_mem_shader_cache_equals(const void *a, const void *b)
+{
+   return memcmp(a, b, 20) == 0;
+}
+
+
+/**
+ * Remember a JIT'd ELF object in the in-memory cache.  Makes its own copy
+ * of the data since the caller's copy is freed with the gallivm state.
+ */
+static void
+lp_mem_cache_add_shader(struct llvmpipe_screen *screen,
+                        struct lp_cached_code *cache,
+                        unsigned char ir_sha1_cache_key[20])
+{
+   if (!screen->mem_shader_cache)
+      return;
+
+   mtx_lock(&screen->mem_shader_cache_mutex);
+   if (!_mesa_hash_table_search(screen->mem_shader_cache,
+                                ir_sha1_cache_key)) {
+      struct lp_mem_cached_shader *mem = MALLOC_STRUCT(lp_mem_cached_shader);
+      void *data = mem ? malloc(cache->data_size) : NULL;
+
+      if (data) {
+         memcpy(mem->sha1, ir_sha1_cache_key, 20);
+         memcpy(data, cache->data, cache->data_size);
+         mem->data = data;
+         mem->data_size = cache->data_size;
+         _mesa_hash_table_insert(screen->mem_shader_cache, mem->sha1, mem);
+      } else {
+         FREE(mem);
+      }
+   }
+   mtx_unlock(&screen->mem_shader_cache_mutex);
+}
+
+
 void
 lp_disk_cache_find_shader(struct llvmpipe_screen *screen,
                           struct lp_cached_code *cache,
@@ -1038,6 +1110,25 @@ lp_disk_cache_find_shader(struct llvmpipe_screen *screen,
 {
    unsigned char sha1[CACHE_KEY_SIZE];
 
+   if (screen->mem_shader_cache) {
+      mtx_lock(&screen->mem_shader_cache_mutex);
+      struct hash_entry *entry =
+         _mesa_hash_table_search(screen->mem_shader_cache, ir_sha1_cache_key);
+      if (entry) {
+         struct lp_mem_cached_shader *mem = entry->data;
+         /* gallivm_free_ir() frees cache->data, so hand out a copy. */
+         void *data = malloc(mem->data_size);
+         if (data) {
+            memcpy(data, mem->data, mem->data_size);
+            cache->data = data;
+            cache->data_size = mem->data_size;
+            mtx_unlock(&screen->mem_shader_cache_mutex);
+            return;
+         }
+      }
+      mtx_unlock(&screen->mem_shader_cache_mutex);
+   }
+
    if (!screen->disk_shader_cache)
       return;
    disk_cache_compute_key(screen->disk_shader_cache, ir_sha1_cache_key,
@@ -1052,6 +1143,9 @@ lp_disk_cache_find_shader(struct llvmpipe_screen *screen,
    }
    cache->data_size = binary_size;
    cache->data = buffer;
+
+   /* Warm the in-memory cache so later contexts skip the disk entirely. */
+   lp_mem_cache_add_shader(screen, cache, ir_sha1_cache_key);
 }
 
 
@@ -1062,7 +1156,12 @@ lp_disk_cache_insert_shader(struct llvmpipe_screen *screen,
 {
    unsigned char sha1[CACHE_KEY_SIZE];
 
-   if (!screen->disk_shader_cache || !cache->data_size || cache->dont_cache)
+   if (!cache->data_size || cache->dont_cache)
+      return;
+
+   lp_mem_cache_add_shader(screen, cache, ir_sha1_cache_key);
+
+   if (!screen->disk_shader_cache)
       return;
    disk_cache_compute_key(screen->disk_shader_cache, ir_sha1_cache_key,
                           20, sha1);
@@ -1181,5 +1280,10 @@ llvmpipe_create_screen(struct sw_winsys *winsys)
 
    (void) mtx_init(&screen->late_mutex, mtx_plain);
 
+   screen->mem_shader_cache =
+      _mesa_hash_table_create(NULL, lp_mem_shader_cache_hash,
+                              lp_mem_shader_cache_equals);
+   (void) mtx_init(&screen->mem_shader_cache_mutex, mtx_plain);
+
    return &screen->base;
 }
@@ -43,6 +43,7 @@
 
 struct sw_winsys;
 struct lp_cs_tpool;
+struct hash_table;
 
 struct llvmpipe_screen
 {
@@ -74,6 +75,13 @@ struct llvmpipe_screen
 
    struct disk_cache *disk_shader_cache;
 
+   /* In-memory cache of JIT'd ELF objects, keyed by the same IR sha1 as the
+    * disk cache.  It keeps compiled shaders alive across context teardown
+    * and also works when the disk cache is disabled.
+    */
+   struct hash_table *mem_shader_cache;
+   mtx_t mem_shader_cache_mutex;
+
 #ifdef HAVE_LIBDRM
    int udmabuf_fd;
 #endif
@@ -909,6 +909,15 @@ llvmpipe_transfer_map_ms(struct pipe_context *pipe,
 
    format = lpr->base.format;
 
+   /* This is a direct map of the linear storage -- no format conversion
+    * happens on this path, so there is nothing here to JIT.  When an upload
+    * does convert (GL user format != pipe format), that happens in the
+    * gallium frontend through the u_format pack/unpack tables before the
+    * data reaches this map, and reads during rendering go through the
+    * gallivm-jitted fetch/sample code.  Speeding up slow uploads therefore
+    * means either picking a pipe format matching the app data, or improving
+    * the relevant u_format (un)pack routine, not adding a JIT stage here.
+    */
    map = llvmpipe_resource_map(resource, level, box->z, tex_usage);
 
 
@@ -67,6 +67,13 @@ panfrost_clear(struct pipe_context *pipe, unsigned buffers,
     * cause the batch to be flushed.
     */
    struct panfrost_context *ctx = pan_context(pipe);
+
+   /* Tilebuffer stores pending for the attachments we are about to clear
+    * would be overwritten immediately, so drop them while their batches are
+    * still unsubmitted.
+    */
+   panfrost_elide_dead_stores(ctx, buffers);
+
    struct panfrost_batch *batch = panfrost_get_batch_for_fbo(ctx);
 
    /* At the start of the batch, we can clear for free */
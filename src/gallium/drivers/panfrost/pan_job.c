@@ -707,6 +707,98 @@ panfrost_flush_all_batches(struct panfrost_context *ctx, const char *reason)
    }
 }
 
+static bool
+panfrost_surface_equal(const struct pipe_surface *a,
+                       const struct pipe_surface *b)
+{
+   return a->texture == b->texture && a->format == b->format &&
+          a->u.tex.level == b->u.tex.level &&
+          a->u.tex.first_layer == b->u.tex.first_layer &&
+          a->u.tex.last_layer == b->u.tex.last_layer;
+}
+
+/* Called when the whole framebuffer is about to be cleared. A pending batch
+ * that writes one of the attachments being cleared would store tilebuffer
+ * contents that the clear immediately overwrites, so drop those stores to
+ * save the write bandwidth, provided no other pending batch and no external
+ * consumer can observe the stored contents first.
+ *
+ * This must run before the clear's batch is looked up: creating that batch
+ * registers the attachment writes, which submits the pending writer.
+ */
+void
+panfrost_elide_dead_stores(struct panfrost_context *ctx, unsigned buffers)
+{
+   const struct pipe_framebuffer_state *fb = &ctx->pipe_framebuffer;
+
+   for (unsigned i = 0; i <= fb->nr_cbufs; ++i) {
+      bool zs = (i == fb->nr_cbufs);
+      struct pipe_surface *surf = zs ? fb->zsbuf : fb->cbufs[i];
+      unsigned clear_mask = zs ? (buffers & PIPE_CLEAR_DEPTHSTENCIL)
+                               : (buffers & (PIPE_CLEAR_COLOR0 << i));
+
+      if (!surf || !clear_mask)
+         continue;
+
+      struct panfrost_resource *rsrc = pan_resource(surf->texture);
+
+      /* External consumers may observe the resource between submits. */
+      if (rsrc->base.bind &
+          (PIPE_BIND_SHARED | PIPE_BIND_SCANOUT | PIPE_BIND_DISPLAY_TARGET))
+         continue;
+
+      /* The clear covers the framebuffer; it only kills the store if that
+       * in turn covers the whole surface.
+       */
+      if (fb->width < surf->width || fb->height < surf->height)
+         continue;
+
+      struct hash_entry *ent = _mesa_hash_table_search(ctx->writers, rsrc);
+      struct panfrost_batch *writer = ent ? ent->data : NULL;
+
+      /* The current batch's own store is the post-clear contents. */
+      if (!writer || writer == ctx->batch)
+         continue;
+
+      /* Any other pending batch using the resource still needs the stored
+       * contents. If the current batch had used it, the writer would have
+       * been submitted already.
+       */
+      bool used_elsewhere = false;
+      unsigned idx;
+      foreach_batch(ctx, idx) {
+         struct panfrost_batch *other = &ctx->batches.slots[idx];
+
+         if (other != writer && other != ctx->batch &&
+             panfrost_batch_uses_resource(other, rsrc)) {
+            used_elsewhere = true;
+            break;
+         }
+      }
+
+      if (used_elsewhere)
+         continue;
+
+      /* Only elide stores going through the exact same surface, so that
+       * writes to other levels/layers of the resource stay intact.
+       */
+      if (zs) {
+         if (writer->key.zsbuf && panfrost_surface_equal(writer->key.zsbuf, surf)) {
+            perf_debug(ctx, "Eliding ZS store of fully cleared attachment");
+            writer->resolve &= ~clear_mask;
+         }
+      } else {
+         for (unsigned j = 0; j < writer->key.nr_cbufs; ++j) {
+            if (writer->key.cbufs[j] &&
+                panfrost_surface_equal(writer->key.cbufs[j], surf)) {
+               perf_debug(ctx, "Eliding color store of fully cleared attachment");
+               writer->resolve &= ~(PIPE_CLEAR_COLOR0 << j);
+            }
+         }
+      }
+   }
+}
+
 void
 panfrost_flush_writer(struct panfrost_context *ctx,
                       struct panfrost_resource *rsrc, const char *reason)
@@ -267,6 +267,9 @@ void panfrost_flush_batches_accessing_rsrc(struct panfrost_context *ctx,
 void panfrost_flush_writer(struct panfrost_context *ctx,
                            struct panfrost_resource *rsrc, const char *reason);
 
+void panfrost_elide_dead_stores(struct panfrost_context *ctx,
+                                unsigned buffers);
+
 void panfrost_batch_adjust_stack_size(struct panfrost_batch *batch);
 
 struct panfrost_bo *panfrost_batch_get_scratchpad(struct panfrost_batch *batch,
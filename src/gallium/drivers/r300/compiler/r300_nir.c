@@ -198,7 +198,7 @@ r300_optimize_nir(struct nir_shader *s, struct pipe_screen *screen)
       if (is_r500)
          nir_shader_intrinsics_pass(s, set_speculate,
                                     nir_metadata_control_flow, NULL);
-      NIR_PASS(progress, s, nir_opt_peephole_select, is_r500 ? 8 : ~0, true, true);
+      NIR_PASS(progress, s, nir_opt_peephole_select, is_r500 ? 8 : ~0, is_r500 ? 8 : ~0, true, true);
       if (s->info.stage == MESA_SHADER_FRAGMENT) {
          NIR_PASS(progress, s, r300_nir_lower_bool_to_float_fs);
       }
@@ -15,6 +15,7 @@
 #include "sfn_instr_mem.h"
 #include "sfn_instr_tex.h"
 #include "sfn_peephole.h"
+#include "util/u_debug.h"
 #include "sfn_valuefactory.h"
 #include "sfn_virtualvalues.h"
 
@@ -22,6 +23,8 @@
 
 namespace r600 {
 
+DEBUG_GET_ONCE_NUM_OPTION(opt_rounds, "R600_SFN_MAX_OPT_ROUNDS", 64);
+
 bool
 optimize(Shader& shader)
 {
@@ -34,6 +37,14 @@ optimize(Shader& shader)
       sfn_log << ss.str() << "\n\n";
    }
 
+   /* Bound the fixed-point iteration so that pathological shaders can't
+    * stall compilation for seconds. The shader is valid after every round,
+    * so hitting the budget just keeps the partially optimized result.
+    * Normal shaders converge in a handful of rounds and never get near
+    * the limit.
+    */
+   auto max_rounds = debug_get_option_opt_rounds();
+
    do {
       progress = false;
       progress |= copy_propagation_fwd(shader);
@@ -43,7 +54,7 @@ optimize(Shader& shader)
       progress |= simplify_source_vectors(shader);
       progress |= peephole(shader);
       progress |= dead_code_elimination(shader);
-   } while (progress);
+   } while (progress && --max_rounds > 0);
 
    return progress;
 }
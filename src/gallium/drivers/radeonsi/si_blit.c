@@ -6,6 +6,7 @@
  */
 
 #include "si_pipe.h"
+#include "si_tracepoints.h"
 #include "util/format/u_format.h"
 #include "util/u_log.h"
 #include "util/u_surface.h"
@@ -1218,7 +1219,7 @@ bool si_msaa_resolve_blit_via_CB(struct pipe_context *ctx, const struct pipe_bli
    return false;
 }
 
-static void si_blit(struct pipe_context *ctx, const struct pipe_blit_info *info)
+static void si_blit_impl(struct pipe_context *ctx, const struct pipe_blit_info *info)
 {
    struct si_context *sctx = (struct si_context *)ctx;
    struct si_texture *sdst = (struct si_texture *)info->dst.resource;
@@ -1273,6 +1274,19 @@ static void si_blit(struct pipe_context *ctx, const struct pipe_blit_info *info)
    si_gfx_blit(ctx, info);
 }
 
+static void si_blit(struct pipe_context *ctx, const struct pipe_blit_info *info)
+{
+   struct si_context *sctx = (struct si_context *)ctx;
+
+   if (u_trace_perfetto_active(&sctx->ds.trace_context))
+      trace_si_begin_blit(&sctx->trace);
+
+   si_blit_impl(ctx, info);
+
+   if (u_trace_perfetto_active(&sctx->ds.trace_context))
+      trace_si_end_blit(&sctx->trace, abs(info->dst.box.width), abs(info->dst.box.height));
+}
+
 void si_gfx_blit(struct pipe_context *ctx, const struct pipe_blit_info *info)
 {
    struct si_context *sctx = (struct si_context *)ctx;
@@ -533,6 +533,15 @@ static void si_buffer_subdata(struct pipe_context *ctx, struct pipe_resource *bu
    struct pipe_box box;
    uint8_t *map = NULL;
 
+   /* Tiny dword-aligned updates of a busy buffer are written inline through
+    * the command stream, which skips the staging buffer and the per-copy
+    * CP DMA synchronization.
+    */
+   if (!(usage & (PIPE_MAP_DIRECTLY | PIPE_MAP_UNSYNCHRONIZED)) &&
+       si_cp_write_buffer_inline((struct si_context *)ctx, si_resource(buffer),
+                                 offset, size, data))
+      return;
+
    usage |= PIPE_MAP_WRITE;
 
    if (!(usage & PIPE_MAP_DIRECTLY))
@@ -705,6 +705,15 @@ static void si_setup_user_sgprs_co_v2(struct si_context *sctx, const amd_kernel_
    radeon_end();
 }
 
+/* Kernel arguments are suballocated from const_uploader, a u_upload_mgr
+ * that hands out ranges of a large persistently mapped buffer and only
+ * allocates a new one when the current buffer is exhausted, so thousands of
+ * small launches share a handful of BOs instead of allocating per launch.
+ * Launches themselves are already batched: launch_grid only emits packets
+ * into the current CS, which is submitted to the kernel when it fills up or
+ * when the frontend requests a fence, so back-to-back grids with no
+ * dependency go out in one submission.
+ */
 static bool si_upload_compute_input(struct si_context *sctx, const amd_kernel_code_t *code_object,
                                     const struct pipe_grid_info *info)
 {
@@ -1142,6 +1151,16 @@ static bool si_check_needs_implicit_sync(struct si_context *sctx, uint32_t usage
    return false;
 }
 
+/* Dispatches always go to this context's single ring (gfx, or an ACE ring for
+ * compute-only contexts).  Routing them to a separate compute queue would
+ * require rebinding all compute state on another context and fencing every
+ * resource shared with gfx, and the kernel's implicit BO sync would serialize
+ * the queues anyway whenever a dispatch touches anything the gfx ring uses.
+ * Self-contained internal jobs that do benefit use
+ * si_screen::async_compute_context instead (see the DRI_PRIME copy in
+ * si_blit).  Back-to-back app dispatches already overlap on this ring because
+ * CS_PARTIAL_FLUSH is only emitted when a barrier or state change needs it.
+ */
 static void si_launch_grid(struct pipe_context *ctx, const struct pipe_grid_info *info)
 {
    struct si_context *sctx = (struct si_context *)ctx;
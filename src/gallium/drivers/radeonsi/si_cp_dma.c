@@ -457,6 +457,77 @@ void si_cp_write_data(struct si_context *sctx, struct si_resource *buf, unsigned
    radeon_end();
 }
 
+/* The max size of an inline buffer write. Above this, a staging buffer and
+ * CP DMA are faster because the data doesn't bloat the IB.
+ */
+#define SI_CP_WRITE_INLINE_MAX_SIZE 256
+
+/**
+ * Write a small amount of CPU data into a busy buffer through the command
+ * stream (WRITE_DATA) instead of allocating a staging buffer and copying it
+ * with CP DMA.
+ *
+ * This is meant for apps that issue thousands of tiny glBufferSubData
+ * updates per frame: the writes are ordered by the ME, so a burst of them
+ * needs only 1 shader sync and 1 PFP_SYNC_ME for the whole burst instead of
+ * syncing around every copy, and no staging allocations are made.
+ *
+ * \return false if the caller should take the regular transfer path.
+ */
+bool si_cp_write_buffer_inline(struct si_context *sctx, struct si_resource *buf,
+                               unsigned offset, unsigned size, const void *data)
+{
+   if (!sctx->has_graphics ||
+       offset % 4 != 0 || size % 4 != 0 || size > SI_CP_WRITE_INLINE_MAX_SIZE ||
+       buf->flags & (RADEON_FLAG_SPARSE | RADEON_FLAG_ENCRYPTED) ||
+       buf->b.is_shared || buf->b.is_user_ptr)
+      return false;
+
+   /* Only take over if mapping the buffer would have to wait for the GPU or
+    * use a staging buffer. Idle buffers are written faster by the CPU.
+    */
+   if (!si_cs_is_buffer_referenced(sctx, buf->buf, RADEON_USAGE_READWRITE) &&
+       sctx->ws->buffer_wait(sctx->ws, buf->buf, 0, RADEON_USAGE_READWRITE))
+      return false;
+
+   util_range_add(&buf->b.b, &buf->valid_buffer_range, offset, offset + size);
+
+   /* Wait for in-flight shaders that might read the old contents and
+    * invalidate caches, but only if shader work has been submitted since the
+    * last inline write. Within a burst of inline writes, the packets are
+    * ordered by the ME, so only the first write has to sync.
+    */
+   unsigned work_seq = sctx->num_draw_calls + sctx->num_compute_calls;
+
+   if (sctx->last_inline_write_work_seq != work_seq) {
+      sctx->flags |= SI_CONTEXT_VS_PARTIAL_FLUSH | SI_CONTEXT_PS_PARTIAL_FLUSH |
+                     SI_CONTEXT_CS_PARTIAL_FLUSH |
+                     si_get_flush_flags(sctx, SI_COHERENCY_SHADER, L2_LRU);
+      sctx->last_inline_write_work_seq = work_seq;
+   }
+
+   si_need_gfx_cs_space(sctx, 0);
+
+   /* Don't flush if only PFP_SYNC_ME is pending - the write doesn't need it
+    * and emitting it here would stall the PFP on every write of a burst.
+    * It stays pending for the next draw.
+    */
+   if (sctx->flags & ~SI_CONTEXT_PFP_SYNC_ME)
+      si_emit_cache_flush_direct(sctx);
+
+   si_cp_write_data(sctx, buf, offset, size, V_370_TC_L2, V_370_ME, data);
+
+   /* Index buffers are fetched by the PFP, which doesn't wait for the ME.
+    * Defer the sync to the next draw, which covers the whole burst.
+    */
+   sctx->flags |= SI_CONTEXT_PFP_SYNC_ME;
+   si_mark_atom_dirty(sctx, &sctx->atoms.s.cache_flush);
+
+   buf->TC_L2_dirty = true;
+   sctx->num_cp_dma_calls++;
+   return true;
+}
+
 void si_cp_copy_data(struct si_context *sctx, struct radeon_cmdbuf *cs, unsigned dst_sel,
                      struct si_resource *dst, unsigned dst_offset, unsigned src_sel,
                      struct si_resource *src, unsigned src_offset)
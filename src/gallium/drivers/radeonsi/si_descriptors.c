@@ -40,6 +40,7 @@
 #include "sid.h"
 #include "util/format/u_format.h"
 #include "util/hash_table.h"
+#include "util/set.h"
 #include "util/u_idalloc.h"
 #include "util/u_memory.h"
 #include "util/u_upload_mgr.h"
@@ -1821,7 +1822,11 @@ void si_rebind_buffer(struct si_context *sctx, struct pipe_resource *buf)
             si_set_buf_desc_address(si_resource(buffer), view->u.buf.offset,
                                     descs->list + desc_slot * 16 + 4);
 
-            (*tex_handle)->desc_dirty = true;
+            if (!(*tex_handle)->desc_dirty) {
+               (*tex_handle)->desc_dirty = true;
+               util_dynarray_append(&sctx->dirty_tex_handles, struct si_texture_handle *,
+                                    *tex_handle);
+            }
             si_mark_bindless_descriptors_dirty(sctx);
 
             radeon_add_to_buffer_list(sctx, &sctx->gfx_cs, si_resource(buffer), RADEON_USAGE_READ |
@@ -1846,7 +1851,11 @@ void si_rebind_buffer(struct si_context *sctx, struct pipe_resource *buf)
             si_set_buf_desc_address(si_resource(buffer), view->u.buf.offset,
                                     descs->list + desc_slot * 16 + 4);
 
-            (*img_handle)->desc_dirty = true;
+            if (!(*img_handle)->desc_dirty) {
+               (*img_handle)->desc_dirty = true;
+               util_dynarray_append(&sctx->dirty_img_handles, struct si_image_handle *,
+                                    *img_handle);
+            }
             si_mark_bindless_descriptors_dirty(sctx);
 
             radeon_add_to_buffer_list(sctx, &sctx->gfx_cs, si_resource(buffer),
@@ -1895,25 +1904,26 @@ static void si_upload_bindless_descriptors(struct si_context *sctx)
    sctx->flags |= SI_CONTEXT_PS_PARTIAL_FLUSH | SI_CONTEXT_CS_PARTIAL_FLUSH;
    si_emit_cache_flush_direct(sctx);
 
-   util_dynarray_foreach (&sctx->resident_tex_handles, struct si_texture_handle *, tex_handle) {
-      unsigned desc_slot = (*tex_handle)->desc_slot;
-
+   /* Only dirty handles are tracked, so the cost of this is proportional to
+    * the number of modified descriptors, not the number of resident ones.
+    */
+   util_dynarray_foreach (&sctx->dirty_tex_handles, struct si_texture_handle *, tex_handle) {
       if (!(*tex_handle)->desc_dirty)
          continue;
 
-      si_upload_bindless_descriptor(sctx, desc_slot, 16);
+      si_upload_bindless_descriptor(sctx, (*tex_handle)->desc_slot, 16);
       (*tex_handle)->desc_dirty = false;
    }
+   util_dynarray_clear(&sctx->dirty_tex_handles);
 
-   util_dynarray_foreach (&sctx->resident_img_handles, struct si_image_handle *, img_handle) {
-      unsigned desc_slot = (*img_handle)->desc_slot;
-
+   util_dynarray_foreach (&sctx->dirty_img_handles, struct si_image_handle *, img_handle) {
       if (!(*img_handle)->desc_dirty)
          continue;
 
-      si_upload_bindless_descriptor(sctx, desc_slot, 8);
+      si_upload_bindless_descriptor(sctx, (*img_handle)->desc_slot, 8);
       (*img_handle)->desc_dirty = false;
    }
+   util_dynarray_clear(&sctx->dirty_img_handles);
 
    /* Invalidate scalar L0 because the cache doesn't know that L2 changed. */
    sctx->flags |= SI_CONTEXT_INV_SCACHE;
@@ -1972,11 +1982,25 @@ static void si_update_bindless_image_descriptor(struct si_context *sctx,
 static void si_update_all_resident_texture_descriptors(struct si_context *sctx)
 {
    util_dynarray_foreach (&sctx->resident_tex_handles, struct si_texture_handle *, tex_handle) {
+      bool was_dirty = (*tex_handle)->desc_dirty;
+
       si_update_bindless_texture_descriptor(sctx, *tex_handle);
+
+      if (!was_dirty && (*tex_handle)->desc_dirty) {
+         util_dynarray_append(&sctx->dirty_tex_handles, struct si_texture_handle *,
+                              *tex_handle);
+      }
    }
 
    util_dynarray_foreach (&sctx->resident_img_handles, struct si_image_handle *, img_handle) {
+      bool was_dirty = (*img_handle)->desc_dirty;
+
       si_update_bindless_image_descriptor(sctx, *img_handle);
+
+      if (!was_dirty && (*img_handle)->desc_dirty) {
+         util_dynarray_append(&sctx->dirty_img_handles, struct si_image_handle *,
+                              *img_handle);
+      }
    }
 }
 
@@ -2646,8 +2670,10 @@ static void si_make_texture_handle_resident(struct pipe_context *ctx, uint64_t h
       /* Re-upload the descriptor if it has been updated while it
        * wasn't resident.
        */
-      if (tex_handle->desc_dirty)
+      if (tex_handle->desc_dirty) {
+         util_dynarray_append(&sctx->dirty_tex_handles, struct si_texture_handle *, tex_handle);
          si_mark_bindless_descriptors_dirty(sctx);
+      }
 
       /* Add the texture handle to the per-context list. */
       util_dynarray_append(&sctx->resident_tex_handles, struct si_texture_handle *, tex_handle);
@@ -2658,9 +2684,14 @@ static void si_make_texture_handle_resident(struct pipe_context *ctx, uint64_t h
       si_sampler_view_add_buffer(sctx, sview->base.texture, RADEON_USAGE_READ,
                                  sview->is_stencil_sampler);
    } else {
-      /* Remove the texture handle from the per-context list. */
+      /* Remove the texture handle from the per-context lists. The descriptor
+       * keeps its dirty flag, so it will be re-added to the dirty list if the
+       * handle becomes resident again.
+       */
       util_dynarray_delete_unordered(&sctx->resident_tex_handles, struct si_texture_handle *,
                                      tex_handle);
+      util_dynarray_delete_unordered(&sctx->dirty_tex_handles, struct si_texture_handle *,
+                                     tex_handle);
 
       if (sctx->gfx_level < GFX12 && sview->base.texture->target != PIPE_BUFFER) {
          util_dynarray_delete_unordered(&sctx->resident_tex_needs_depth_decompress,
@@ -2769,8 +2800,10 @@ static void si_make_image_handle_resident(struct pipe_context *ctx, uint64_t han
       /* Re-upload the descriptor if it has been updated while it
        * wasn't resident.
        */
-      if (img_handle->desc_dirty)
+      if (img_handle->desc_dirty) {
+         util_dynarray_append(&sctx->dirty_img_handles, struct si_image_handle *, img_handle);
          si_mark_bindless_descriptors_dirty(sctx);
+      }
 
       /* Add the image handle to the per-context list. */
       util_dynarray_append(&sctx->resident_img_handles, struct si_image_handle *, img_handle);
@@ -2782,9 +2815,14 @@ static void si_make_image_handle_resident(struct pipe_context *ctx, uint64_t han
                                  (access & PIPE_IMAGE_ACCESS_WRITE) ?
                                     RADEON_USAGE_READWRITE : RADEON_USAGE_READ, false);
    } else {
-      /* Remove the image handle from the per-context list. */
+      /* Remove the image handle from the per-context lists. The descriptor
+       * keeps its dirty flag, so it will be re-added to the dirty list if the
+       * handle becomes resident again.
+       */
       util_dynarray_delete_unordered(&sctx->resident_img_handles, struct si_image_handle *,
                                      img_handle);
+      util_dynarray_delete_unordered(&sctx->dirty_img_handles, struct si_image_handle *,
+                                     img_handle);
 
       if (sctx->gfx_level < GFX12 && res->b.b.target != PIPE_BUFFER) {
          util_dynarray_delete_unordered(&sctx->resident_img_needs_color_decompress,
@@ -2800,21 +2838,45 @@ static void si_resident_buffers_add_all_to_bo_list(struct si_context *sctx)
    num_resident_tex_handles = sctx->resident_tex_handles.size / sizeof(struct si_texture_handle *);
    num_resident_img_handles = sctx->resident_img_handles.size / sizeof(struct si_image_handle *);
 
-   /* Add all resident texture handles. */
-   util_dynarray_foreach (&sctx->resident_tex_handles, struct si_texture_handle *, tex_handle) {
-      struct si_sampler_view *sview = (struct si_sampler_view *)(*tex_handle)->view;
-
-      si_sampler_view_add_buffer(sctx, sview->base.texture, RADEON_USAGE_READ,
-                                 sview->is_stencil_sampler);
-   }
+   /* Applications can create many handles per texture, but the BO list only
+    * needs each buffer once, so dedupe the handles at the resource level
+    * before going through the winsys.  Image handles are added first so that
+    * a buffer accessed through both an image and a texture handle keeps the
+    * stronger READWRITE usage.  The key mixes the stencil-sampler flag into
+    * the low pointer bit because it selects a different buffer for depth
+    * textures that can't be sampled directly.
+    */
+   struct set *seen = _mesa_pointer_set_create(NULL);
 
    /* Add all resident image handles. */
    util_dynarray_foreach (&sctx->resident_img_handles, struct si_image_handle *, img_handle) {
       struct pipe_image_view *view = &(*img_handle)->view;
+      bool found = false;
 
-      si_sampler_view_add_buffer(sctx, view->resource, RADEON_USAGE_READWRITE, false);
+      if (seen && view->resource)
+         _mesa_set_search_or_add(seen, view->resource, &found);
+      if (!found)
+         si_sampler_view_add_buffer(sctx, view->resource, RADEON_USAGE_READWRITE, false);
    }
 
+   /* Add all resident texture handles. */
+   util_dynarray_foreach (&sctx->resident_tex_handles, struct si_texture_handle *, tex_handle) {
+      struct si_sampler_view *sview = (struct si_sampler_view *)(*tex_handle)->view;
+      bool found = false;
+
+      if (seen && sview->base.texture) {
+         const void *key = (uint8_t *)sview->base.texture +
+                           (sview->is_stencil_sampler ? 1 : 0);
+         _mesa_set_search_or_add(seen, key, &found);
+      }
+      if (!found)
+         si_sampler_view_add_buffer(sctx, sview->base.texture, RADEON_USAGE_READ,
+                                    sview->is_stencil_sampler);
+   }
+
+   if (seen)
+      _mesa_set_destroy(seen, NULL);
+
    sctx->num_resident_handles += num_resident_tex_handles + num_resident_img_handles;
    assert(sctx->bo_list_add_all_resident_resources);
    sctx->bo_list_add_all_resident_resources = false;
@@ -47,6 +47,10 @@ static const struct {
    {
       "draw",
       SI_DS_QUEUE_STAGE_DRAW,
+   },
+   {
+      "blit",
+      SI_DS_QUEUE_STAGE_BLIT,
    }
 };
 
@@ -277,6 +281,7 @@ void si_ds_end_##event_name(struct si_ds_device *device, uint64_t ts_ns, uint16_
 
 CREATE_DUAL_EVENT_CALLBACK(draw, SI_DS_QUEUE_STAGE_DRAW)
 CREATE_DUAL_EVENT_CALLBACK(compute, SI_DS_QUEUE_STAGE_COMPUTE)
+CREATE_DUAL_EVENT_CALLBACK(blit, SI_DS_QUEUE_STAGE_BLIT)
 
 uint64_t si_ds_begin_submit(struct si_ds_queue *queue)
 {
@@ -359,6 +359,8 @@ static void si_destroy_context(struct pipe_context *context)
 
    util_dynarray_fini(&sctx->resident_tex_handles);
    util_dynarray_fini(&sctx->resident_img_handles);
+   util_dynarray_fini(&sctx->dirty_tex_handles);
+   util_dynarray_fini(&sctx->dirty_img_handles);
    util_dynarray_fini(&sctx->resident_tex_needs_color_decompress);
    util_dynarray_fini(&sctx->resident_img_needs_color_decompress);
    util_dynarray_fini(&sctx->resident_tex_needs_depth_decompress);
@@ -770,6 +772,8 @@ static struct pipe_context *si_create_context(struct pipe_screen *screen, unsign
 
    util_dynarray_init(&sctx->resident_tex_handles, NULL);
    util_dynarray_init(&sctx->resident_img_handles, NULL);
+   util_dynarray_init(&sctx->dirty_tex_handles, NULL);
+   util_dynarray_init(&sctx->dirty_img_handles, NULL);
    util_dynarray_init(&sctx->resident_tex_needs_color_decompress, NULL);
    util_dynarray_init(&sctx->resident_img_needs_color_decompress, NULL);
    util_dynarray_init(&sctx->resident_tex_needs_depth_decompress, NULL);
@@ -1265,6 +1265,12 @@ struct si_context {
    struct util_dynarray resident_tex_handles;
    struct util_dynarray resident_img_handles;
 
+   /* Resident bindless handles whose descriptor needs to be re-uploaded.
+    * This avoids walking all resident handles when only a few are dirty.
+    */
+   struct util_dynarray dirty_tex_handles;
+   struct util_dynarray dirty_img_handles;
+
    /* Resident bindless handles which need decompression */
    struct util_dynarray resident_tex_needs_color_decompress;
    struct util_dynarray resident_img_needs_color_decompress;
@@ -1295,6 +1301,9 @@ struct si_context {
    unsigned last_db_flush_num_decompress_calls;
    unsigned num_compute_calls;
    unsigned num_cp_dma_calls;
+   /* num_draw_calls + num_compute_calls at the last inline buffer write,
+    * so that a burst of inline writes only syncs shaders once. */
+   unsigned last_inline_write_work_seq;
    unsigned num_vs_flushes;
    unsigned num_ps_flushes;
    unsigned num_cs_flushes;
@@ -1540,6 +1549,8 @@ void si_cp_dma_copy_buffer(struct si_context *sctx, struct pipe_resource *dst,
                            enum si_cache_policy cache_policy);
 void si_cp_write_data(struct si_context *sctx, struct si_resource *buf, unsigned offset,
                       unsigned size, unsigned dst_sel, unsigned engine, const void *data);
+bool si_cp_write_buffer_inline(struct si_context *sctx, struct si_resource *buf,
+                               unsigned offset, unsigned size, const void *data);
 void si_cp_copy_data(struct si_context *sctx, struct radeon_cmdbuf *cs, unsigned dst_sel,
                      struct si_resource *dst, unsigned dst_offset, unsigned src_sel,
                      struct si_resource *src, unsigned src_offset);
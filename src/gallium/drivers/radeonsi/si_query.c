@@ -1064,6 +1064,14 @@ static void emit_set_predicate(struct si_context *ctx, struct si_resource *buf,
    radeon_add_to_buffer_list(ctx, &ctx->gfx_cs, buf, RADEON_USAGE_READ | RADEON_PRIO_QUERY);
 }
 
+/* Emit SET_PREDICATION packets for conditional rendering.
+ *
+ * Note that for occlusion queries this consumes the raw ZPASS counter pairs
+ * straight from the query buffer (PREDICATION_OP_ZPASS) - no compute resolve
+ * is involved.  The only case that goes through the query-result compute
+ * shader is the GFX8/GFX9 firmware bug workaround for streamout overflow
+ * predication (see needs_workaround in si_render_condition).
+ */
 static void si_emit_query_predication(struct si_context *ctx, unsigned index)
 {
    uint32_t op;
@@ -1518,6 +1526,15 @@ static bool si_query_hw_get_result(struct si_context *sctx, struct si_query *squ
    return true;
 }
 
+/* Resolve one query into a buffer with the query-result compute shader.
+ *
+ * Each call dispatches one grid per buffer in the query's chain.  Resolves
+ * of different queries cannot be batched into a single dispatch here because
+ * the gallium interface hands them to us one query at a time and the
+ * destination offsets are caller-chosen; the dispatches are tiny, so the
+ * cost is dominated by the CS_PARTIAL_FLUSH between them, which is required
+ * anyway for the chain accumulator.
+ */
 static void si_query_hw_get_result_resource(struct si_context *sctx, struct si_query *squery,
                                             enum pipe_query_flags flags,
                                             enum pipe_query_value_type result_type,
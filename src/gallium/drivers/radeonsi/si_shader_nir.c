@@ -111,7 +111,7 @@ void si_nir_opts(struct si_screen *sscreen, struct nir_shader *nir, bool first)
       progress |= lower_alu_to_scalar | lower_phis_to_scalar;
 
       NIR_PASS(progress, nir, nir_opt_cse);
-      NIR_PASS(progress, nir, nir_opt_peephole_select, 8, true, true);
+      NIR_PASS(progress, nir, nir_opt_peephole_select, 8, 16, true, true);
 
       /* Needed for algebraic lowering */
       NIR_PASS(progress, nir, nir_lower_bit_size, si_lower_bit_size_callback, NULL);
@@ -26,6 +26,16 @@
 
 static void si_update_tess_in_out_patch_vertices(struct si_context *sctx);
 
+/* The wave size choice is static: heuristics below, overridable per process
+ * with the AMD_DEBUG w32/w64 flags and per shader with si_shader_profiles[]
+ * (keyed by source_blake3, which the shader stats dump prints). Shaders that
+ * measurably prefer the non-default size get a profile entry; that's the
+ * persistent per-shader decision cache here. A runtime feedback loop driven
+ * by perf counters was considered and rejected: sampling occupancy/VALU
+ * counters perturbs the workload being measured, merged shader parts must
+ * agree on one wave size so single-shader recompiles can invalidate their
+ * siblings, and background recompile churn costs more than the rare win.
+ */
 unsigned si_determine_wave_size(struct si_screen *sscreen, struct si_shader *shader)
 {
    /* There are a few uses that pass shader=NULL here, expecting the default compute wave size. */
@@ -3443,6 +3453,28 @@ void si_get_active_slot_masks(struct si_screen *sscreen, const struct si_shader_
    *samplers_and_images = u_bit_consecutive64(start, num_images / 2 + num_samplers);
 }
 
+/* A driver-injected depth prepass for apps that don't do their own has been
+ * proposed for fill-bound workloads, but it can't be built on the current
+ * variant machinery:
+ *
+ * - There is no position-only shader variant anymore.  The primitive discard
+ *   compute shader, which compiled such variants, was removed, and the keys
+ *   below have no way to express "drop all PS inputs and param exports" for
+ *   a replay.
+ * - The driver doesn't retain draws.  Replaying a "large opaque depth-tested
+ *   sequence" would require buffering pipe_draw_info, index/vertex buffer
+ *   references and the full bound state for every draw until a heuristic
+ *   decides the sequence is worth a prepass, then re-emitting it — a draw
+ *   recorder that neither si_state_draw nor u_threaded_context provides.
+ * - It's only correct if no draw in the sequence has side effects (atomics,
+ *   image/buffer stores, streamout, queries) and the PS can't kill, which
+ *   we only know after shader variants are compiled.
+ *
+ * Given that, a prepass is better injected by the app or a layer that sees
+ * whole frames.  If this is revisited, it needs a draw recorder plus a
+ * position-only variant bit in si_shader_key, not a hook here.
+ */
+
 static void *si_create_shader_selector(struct pipe_context *ctx,
                                        const struct pipe_shader_state *state)
 {
@@ -4863,6 +4895,17 @@ static void gfx12_emit_tess_io_layout_state(struct si_context *sctx, unsigned in
    radeon_end(); /* don't track context rolls on GFX12 */
 }
 
+/* The live shader cache is what deduplicates shaders across contexts: it is
+ * screen-level and keyed on the serialized IR, so identical shaders created
+ * in multiple contexts resolve to a single si_shader_selector, and therefore
+ * share one set of variants and one GPU-resident copy of each binary.
+ *
+ * Deduplicating the GPU copies below the selector level (e.g. a refcounted
+ * BO store keyed on a binary hash) would not buy much on top of this: the
+ * uploaded image is a per-variant concatenation of prolog/main/epilog parts
+ * with symbols (including the scratch address) resolved at upload time,
+ * while sscreen->shader_cache deduplicates only the pre-link main parts.
+ */
 void si_init_screen_live_shader_cache(struct si_screen *sscreen)
 {
    util_live_shader_cache_init(&sscreen->live_shader_cache, si_create_shader_selector,
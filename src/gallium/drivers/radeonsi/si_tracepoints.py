@@ -52,6 +52,12 @@ def define_tracepoints(args):
                           Arg(type='uint32_t', var='group_z', c_format='%u'),],
                  tp_print=['group=%ux%ux%u', '__entry->group_x', '__entry->group_y', '__entry->group_z'])
 
+    # Blits (whether they end up on the CB, compute or gfx path)
+    begin_end_tp('blit',
+                 tp_args=[Arg(type='uint32_t', var='width', c_format='%u'),
+                          Arg(type='uint32_t', var='height', c_format='%u'),],
+                 tp_print=['dst=%ux%u', '__entry->width', '__entry->height'])
+
 def generate_code(args):
     from u_trace import utrace_generate
     from u_trace import utrace_generate_perfetto_utils
@@ -180,20 +180,19 @@ sp_flush_tex_tile_cache(struct softpipe_tex_tile_cache *tc)
 
 /**
  * Given the texture face, level, zslice, x and y values, compute
- * the cache entry position/index where we'd hope to find the
- * cached texture tile.
- * This is basically a direct-map cache.
- * XXX There's probably lots of ways in which we can improve this.
+ * the cache set where we'd hope to find the cached texture tile.
+ * The cache is two-way set associative; each set holds
+ * TEX_TILE_CACHE_WAYS consecutive entries.
  */
 static inline uint
 tex_cache_pos( union tex_tile_address addr )
 {
-   uint entry = (addr.bits.x + 
-                 addr.bits.y * 9 + 
+   uint entry = (addr.bits.x +
+                 addr.bits.y * 9 +
                  addr.bits.z +
                  addr.bits.level * 7);
 
-   return entry % NUM_TEX_TILE_ENTRIES;
+   return entry % NUM_TEX_TILE_SETS;
 }
 
 /**
@@ -201,12 +200,31 @@ tex_cache_pos( union tex_tile_address addr )
  * Tiles are read-only and indexed with more params.
  */
 const struct softpipe_tex_cached_tile *
-sp_find_cached_tile_tex(struct softpipe_tex_tile_cache *tc, 
+sp_find_cached_tile_tex(struct softpipe_tex_tile_cache *tc,
                         union tex_tile_address addr )
 {
-   struct softpipe_tex_cached_tile *tile;
+   const uint set = tex_cache_pos( addr );
+   struct softpipe_tex_cached_tile *tile = NULL;
+
+   for (uint way = 0; way < TEX_TILE_CACHE_WAYS; way++) {
+      struct softpipe_tex_cached_tile *t =
+         tc->entries + set * TEX_TILE_CACHE_WAYS + way;
+
+      if (addr.value == t->addr.value) {
+         tile = t;
+         /* Evict the other way next, we're using this one. */
+         tc->replace[set] = way ^ 1;
+         break;
+      }
+   }
 
-   tile = tc->entries + tex_cache_pos( addr );
+   if (!tile) {
+      /* cache miss: replace the least recently used way in the set */
+      uint way = tc->replace[set];
+
+      tile = tc->entries + set * TEX_TILE_CACHE_WAYS + way;
+      tc->replace[set] = way ^ 1;
+   }
 
    if (addr.value != tile->addr.value) {
 
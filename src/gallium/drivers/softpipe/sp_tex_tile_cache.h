@@ -74,10 +74,14 @@ struct softpipe_tex_cached_tile
 /*
  * The number of cache entries.
  * Should not be decreased to lower than 16, and even that
- * seems too low to avoid cache thrashing in some cases (because
- * the cache is direct mapped, see tex_cache_pos() function).
+ * seems too low to avoid cache thrashing in some cases.
+ * The cache is two-way set associative (see tex_cache_pos()), which
+ * avoids the worst ping-pong cases of the old direct-mapped scheme,
+ * e.g. bilinear fetches straddling two tiles that hash to the same set.
  */
 #define NUM_TEX_TILE_ENTRIES 16
+#define TEX_TILE_CACHE_WAYS 2
+#define NUM_TEX_TILE_SETS (NUM_TEX_TILE_ENTRIES / TEX_TILE_CACHE_WAYS)
 
 struct softpipe_tex_tile_cache
 {
@@ -90,6 +94,9 @@ struct softpipe_tex_tile_cache
 
    struct softpipe_tex_cached_tile entries[NUM_TEX_TILE_ENTRIES];
 
+   /** Per-set index of the way to replace on the next miss (pseudo-LRU) */
+   uint8_t replace[NUM_TEX_TILE_SETS];
+
    struct pipe_transfer *tex_trans;
    void *tex_trans_map;
    int tex_level, tex_z;
@@ -117,6 +117,26 @@ svga_transfer_dma(struct svga_context *svga,
       h = st->hw_nblocksy * blockheight;
       srcy = 0;
 
+      /* For multi-band readbacks, try to double-buffer the DMA: the device
+       * can transfer one band into one buffer while the guest drains the
+       * previous band from the other, instead of serializing each band on
+       * its own flush/wait/copy. If the second buffer can't be allocated
+       * (this path already implies memory pressure), fall back to the
+       * serialized loop.
+       */
+      struct svga_winsys_buffer *hwbufs[2] = { st->hwbuf, NULL };
+      struct svga_winsys_buffer *prev_buf = NULL;
+      struct pipe_fence_handle *band_fence = NULL;
+      void *prev_sw = NULL;
+      unsigned prev_length = 0;
+
+      if (transfer == SVGA3D_READ_HOST_VRAM && st->box.h > h) {
+         hwbufs[1] =
+            svga_winsys_buffer_create(svga, 1, 0,
+                                      st->hw_nblocksy * st->base.stride *
+                                      st->box.d);
+      }
+
       for (y = 0; y < st->box.h; y += h) {
          unsigned offset, length;
          void *hw, *sw;
@@ -163,16 +183,62 @@ svga_transfer_dma(struct svga_context *svga,
          flags.discard = false;
 
          if (transfer == SVGA3D_READ_HOST_VRAM) {
-            svga_context_flush(svga, &fence);
-            sws->fence_finish(sws, fence, OS_TIMEOUT_INFINITE, 0);
+            if (hwbufs[1]) {
+               /* Kick off this band's DMA, then drain the previous band
+                * while this one is in flight.
+                */
+               svga_context_flush(svga, &fence);
+               if (prev_buf) {
+                  sws->fence_finish(sws, band_fence, OS_TIMEOUT_INFINITE, 0);
+
+                  hw = sws->buffer_map(sws, prev_buf, PIPE_MAP_READ);
+                  assert(hw);
+                  if (hw) {
+                     memcpy(prev_sw, hw, prev_length);
+                     sws->buffer_unmap(sws, prev_buf);
+                  }
+               }
+               sws->fence_reference(sws, &band_fence, NULL);
+               band_fence = fence;
+               fence = NULL;
+
+               prev_buf = st->hwbuf;
+               prev_sw = sw;
+               prev_length = length;
+
+               /* The next band targets the other buffer */
+               st->hwbuf = (st->hwbuf == hwbufs[0]) ? hwbufs[1] : hwbufs[0];
+            } else {
+               svga_context_flush(svga, &fence);
+               sws->fence_finish(sws, fence, OS_TIMEOUT_INFINITE, 0);
+
+               hw = sws->buffer_map(sws, st->hwbuf, PIPE_MAP_READ);
+               assert(hw);
+               if (hw) {
+                  memcpy(sw, hw, length);
+                  sws->buffer_unmap(sws, st->hwbuf);
+               }
+            }
+         }
+      }
+
+      if (hwbufs[1]) {
+         /* Drain the final band and retire the second DMA buffer */
+         if (prev_buf) {
+            void *hw;
 
-            hw = sws->buffer_map(sws, st->hwbuf, PIPE_MAP_READ);
+            sws->fence_finish(sws, band_fence, OS_TIMEOUT_INFINITE, 0);
+
+            hw = sws->buffer_map(sws, prev_buf, PIPE_MAP_READ);
             assert(hw);
             if (hw) {
-               memcpy(sw, hw, length);
-               sws->buffer_unmap(sws, st->hwbuf);
+               memcpy(prev_sw, hw, prev_length);
+               sws->buffer_unmap(sws, prev_buf);
             }
+            sws->fence_reference(sws, &band_fence, NULL);
          }
+         st->hwbuf = hwbufs[0];
+         sws->buffer_destroy(sws, hwbufs[1]);
       }
    }
 }
@@ -447,6 +447,16 @@ vc4_job_submit(struct vc4_context *vc4, struct vc4_job *job)
 
         submit.bo_handles = (uintptr_t)job->bo_handles.base;
         submit.bo_handle_count = cl_offset(&job->bo_handles) / 4;
+        /* Note that bin_cl is only the binning *command list*; the binner's
+         * working memory is owned entirely by the kernel, which hands the
+         * HW more memory from its pool on the overflow interrupt.  There is
+         * no submit parameter to pre-size it from here, so userspace
+         * overflow prediction from previous-frame statistics has nothing to
+         * feed.  Dense scenes that overflow repeatedly are a kernel pool
+         * sizing issue (CMA size on the Pi), and re-binning geometry on the
+         * CPU to avoid it would redo the binner's work per tile on exactly
+         * the machines that can least afford it.
+         */
         submit.bin_cl = (uintptr_t)job->bcl.base;
         submit.bin_cl_size = cl_offset(&job->bcl);
         submit.shader_rec = (uintptr_t)job->shader_rec.base;
@@ -627,7 +627,18 @@ static void virgl_set_blend_color(struct pipe_context *ctx,
 static void virgl_hw_set_index_buffer(struct virgl_context *vctx,
                                      struct virgl_indexbuf *ib)
 {
-   virgl_encoder_set_index_buffer(vctx, ib);
+   /* SET_INDEX_BUFFER is sub-context state on the host and survives cmdbuf
+    * flushes, so only the resource attach is needed when the buffer, index
+    * size and offset match what the last indexed draw already sent.
+    */
+   if (vctx->index_buffer != ib->buffer ||
+       vctx->index_buffer_size != ib->index_size ||
+       vctx->index_buffer_offset != ib->offset) {
+      virgl_encoder_set_index_buffer(vctx, ib);
+      pipe_resource_reference(&vctx->index_buffer, ib->buffer);
+      vctx->index_buffer_size = ib->index_size;
+      vctx->index_buffer_offset = ib->offset;
+   }
    virgl_attach_res_index_buffer(vctx, ib);
 }
 
@@ -1600,6 +1611,8 @@ virgl_context_destroy( struct pipe_context *ctx )
       pipe_resource_reference(&vctx->atomic_buffers[i].buffer, NULL);
    }
 
+   pipe_resource_reference(&vctx->index_buffer, NULL);
+
    rs->vws->cmd_buf_destroy(vctx->cbuf);
    if (vctx->uploader)
       u_upload_destroy(vctx->uploader);
@@ -90,6 +90,20 @@ struct virgl_context {
    unsigned num_vertex_buffers;
    bool vertex_array_dirty;
 
+   /* Index buffer state from the last SET_INDEX_BUFFER sent to the host, so
+    * that back-to-back indexed draws from the same buffer don't re-encode the
+    * command. The cached resource is referenced, which also prevents its
+    * address from being reused while it serves as the comparison key.
+    */
+   struct pipe_resource *index_buffer;
+   uint32_t index_buffer_size;
+   uint32_t index_buffer_offset;
+
+   /* Shader handles from the last BIND_SHADER per stage, to drop redundant
+    * binds. Handles are never reused, so equality means the same shader.
+    */
+   uint32_t bound_shader_handles[PIPE_SHADER_TYPES];
+
    struct virgl_rasterizer_state rs_state;
    struct virgl_so_target so_targets[PIPE_MAX_SO_BUFFERS];
    unsigned num_so_targets;
@@ -953,21 +953,30 @@ int virgl_encoder_draw_vbo(struct virgl_context *ctx,
    if (indirect && indirect->buffer)
       length = VIRGL_DRAW_VBO_SIZE_INDIRECT;
    virgl_encoder_write_cmd_dword(ctx, VIRGL_CMD0(VIRGL_CCMD_DRAW_VBO, 0, length));
-   virgl_encoder_write_dword(ctx->cbuf, draw->start);
-   virgl_encoder_write_dword(ctx->cbuf, draw->count);
-   virgl_encoder_write_dword(ctx->cbuf, info->mode);
-   virgl_encoder_write_dword(ctx->cbuf, !!info->index_size);
-   virgl_encoder_write_dword(ctx->cbuf, info->instance_count);
-   virgl_encoder_write_dword(ctx->cbuf, info->index_size ? draw->index_bias : 0);
-   virgl_encoder_write_dword(ctx->cbuf, info->start_instance);
-   virgl_encoder_write_dword(ctx->cbuf, info->primitive_restart);
-   virgl_encoder_write_dword(ctx->cbuf, info->primitive_restart ? info->restart_index : 0);
-   virgl_encoder_write_dword(ctx->cbuf, info->index_bounds_valid ? info->min_index : 0);
-   virgl_encoder_write_dword(ctx->cbuf, info->index_bounds_valid ? info->max_index : ~0);
+
+   /* The fixed-layout part of the command is filled with indexed stores and
+    * a single cdw update, so the stores don't serialize on the per-dword
+    * counter increment of virgl_encoder_write_dword(). Draws dominate the
+    * encoded stream, which makes this the hottest path in the encoder.
+    */
+   uint32_t *buf = ctx->cbuf->buf + ctx->cbuf->cdw;
+   buf[0] = draw->start;
+   buf[1] = draw->count;
+   buf[2] = info->mode;
+   buf[3] = !!info->index_size;
+   buf[4] = info->instance_count;
+   buf[5] = info->index_size ? draw->index_bias : 0;
+   buf[6] = info->start_instance;
+   buf[7] = info->primitive_restart;
+   buf[8] = info->primitive_restart ? info->restart_index : 0;
+   buf[9] = info->index_bounds_valid ? info->min_index : 0;
+   buf[10] = info->index_bounds_valid ? info->max_index : ~0;
    if (indirect && indirect->count_from_stream_output)
-      virgl_encoder_write_dword(ctx->cbuf, indirect->count_from_stream_output->buffer_size);
+      buf[11] = indirect->count_from_stream_output->buffer_size;
    else
-      virgl_encoder_write_dword(ctx->cbuf, 0);
+      buf[11] = 0;
+   ctx->cbuf->cdw += VIRGL_DRAW_VBO_SIZE;
+
    if (length >= VIRGL_DRAW_VBO_SIZE_TESS) {
       virgl_encoder_write_dword(ctx->cbuf, ctx->patch_vertices); /* vertices per patch */
       virgl_encoder_write_dword(ctx->cbuf, drawid_offset); /* drawid */
@@ -1455,6 +1464,15 @@ int virgl_encode_bind_shader(struct virgl_context *ctx,
                              uint32_t handle,
                              enum pipe_shader_type type)
 {
+   /* Shader handles come from virgl_object_assign_handle() and are never
+    * reused, so an equal handle is always the same shader and the redundant
+    * BIND_SHADER can be dropped. The host keeps the binding across cmdbuf
+    * flushes, hence no invalidation on flush either.
+    */
+   if (ctx->bound_shader_handles[type] == handle)
+      return 0;
+   ctx->bound_shader_handles[type] = handle;
+
    virgl_encoder_write_cmd_dword(ctx, VIRGL_CMD0(VIRGL_CCMD_BIND_SHADER, 0, 2));
    virgl_encoder_write_dword(ctx->cbuf, handle);
    virgl_encoder_write_dword(ctx->cbuf, virgl_shader_stage_convert(type));
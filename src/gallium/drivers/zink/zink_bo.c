@@ -570,6 +570,16 @@ error_alloc_commitments:
 }
 
 struct pb_buffer *
+/* Allocation is two-level, following the radeonsi winsys design: buffers up
+ * to the largest slab entry size (1 MB) are sub-allocated from 2 MB slabs,
+ * and everything bigger gets its own VkDeviceMemory that is recycled through
+ * the pb_cache (capped at 1/8 of total device memory) instead of being freed.
+ * Allocation failure reclaims both levels via clean_up_buffer_managers() and
+ * retries, which bounds fragmentation on small heaps.  Going further with a
+ * VMA-style pool that compacts during idle is not possible at this layer:
+ * live resources are pinned by buffer device addresses and exported dmabuf
+ * handles, so their backing memory can never be moved.
+ */
 zink_bo_create(struct zink_screen *screen, uint64_t size, unsigned alignment, enum zink_heap heap, enum zink_alloc_flag flags, unsigned mem_type_idx, const void *pNext)
 {
    struct zink_bo *bo;
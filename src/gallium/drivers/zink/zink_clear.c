@@ -43,6 +43,16 @@ scissor_states_equal(const struct pipe_scissor_state *a, const struct pipe_sciss
    return a->minx == b->minx && a->miny == b->miny && a->maxx == b->maxx && a->maxy == b->maxy;
 }
 
+/* Scissored clears never cost a full-screen draw: inside a render pass they
+ * are emitted as vkCmdClearAttachments with a VkClearRect, with all
+ * clearable attachments folded into a single call, and outside a render
+ * pass they are deferred onto the fb_clears lists and replayed when the
+ * next render pass actually starts.  Only unscissored deferred clears can
+ * be promoted to VK_ATTACHMENT_LOAD_OP_CLEAR: the render pass begins lazily
+ * at the first draw, so we don't yet know whether later draws in the pass
+ * stay within a clear's scissor, and rendering outside the render area is
+ * undefined, which rules out shrinking renderArea to the scissor rect.
+ */
 static void
 clear_in_rp(struct pipe_context *pctx,
            unsigned buffers,
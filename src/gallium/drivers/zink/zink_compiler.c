@@ -1068,6 +1068,14 @@ lower_64bit_pack(nir_shader *shader)
                                        nir_metadata_control_flow, NULL);
 }
 
+/* Emulated geometry shaders (this one and the passthrough GS used for
+ * edgeflag/line-smooth lowering) currently always go through a real VK
+ * geometry stage.  On hardware where GS throughput is poor, lowering these
+ * small expansion shaders to VK_EXT_mesh_shader would be a clear win, but
+ * that requires mesh support throughout zink (extension/feature enablement,
+ * pipeline construction and EXT_mesh_shader SPIR-V emission in ntv), none of
+ * which exists yet.  Revisit once mesh shaders are wired up.
+ */
 nir_shader *
 zink_create_quads_emulation_gs(const nir_shader_compiler_options *options,
                                const nir_shader *prev_stage)
@@ -1644,7 +1652,7 @@ optimize_nir(struct nir_shader *s, struct zink_shader *zs, bool can_shrink)
       NIR_PASS(progress, s, nir_opt_dead_cf);
       NIR_PASS(progress, s, nir_lower_phis_to_scalar, false);
       NIR_PASS(progress, s, nir_opt_cse);
-      NIR_PASS(progress, s, nir_opt_peephole_select, 8, true, true);
+      NIR_PASS(progress, s, nir_opt_peephole_select, 8, 8, true, true);
       NIR_PASS(progress, s, nir_opt_algebraic);
       NIR_PASS(progress, s, nir_opt_constant_folding);
       NIR_PASS(progress, s, nir_opt_undef);
@@ -262,6 +262,8 @@ zink_context_destroy(struct pipe_context *pctx)
       pipe_resource_reference(res, NULL);
    }
    util_dynarray_fini(&ctx->di.global_bindings);
+   util_dynarray_fini(&ctx->barrier_collect.barriers[0]);
+   util_dynarray_fini(&ctx->barrier_collect.barriers[1]);
 
    ralloc_free(ctx);
 }
@@ -2896,6 +2898,8 @@ begin_rendering(struct zink_context *ctx, bool check_msaa_expand)
       return 0;
 
    zink_batch_no_rp(ctx);
+   /* combine the attachment barriers into single vkCmdPipelineBarrier2 calls */
+   zink_barrier_collect_begin(ctx);
    for (int i = 0; i < ctx->fb_state.nr_cbufs; i++) {
       VkImageView iv = VK_NULL_HANDLE;
       struct zink_surface *surf = zink_csurface(ctx->fb_state.cbufs[i]);
@@ -2914,9 +2918,11 @@ begin_rendering(struct zink_context *ctx, bool check_msaa_expand)
             ctx->dynamic_fb.attachments[i].resolveImageView = VK_NULL_HANDLE;
             ctx->dynamic_fb.attachments[i].resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
          }
-         if (!iv)
+         if (!iv) {
             /* dead swapchain */
+            zink_barrier_collect_end(ctx);
             return 0;
+         }
 
       }
       ctx->dynamic_fb.attachments[i].imageView = iv;
@@ -2959,6 +2965,7 @@ begin_rendering(struct zink_context *ctx, bool check_msaa_expand)
          ctx->dynamic_fb.attachments[PIPE_MAX_COLOR_BUFS + 1].resolveMode = 0;
       }
    }
+   zink_barrier_collect_end(ctx);
    ctx->zsbuf_unused = !zsbuf_used;
    assert(ctx->fb_state.width >= ctx->dynamic_fb.info.renderArea.extent.width);
    assert(ctx->fb_state.height >= ctx->dynamic_fb.info.renderArea.extent.height);
@@ -5147,6 +5154,8 @@ zink_context_create(struct pipe_screen *pscreen, void *priv, unsigned flags)
    ctx->gfx_pipeline_state.gfx_prim_mode = MESA_PRIM_COUNT;
    ctx->gfx_pipeline_state.shader_rast_prim = MESA_PRIM_COUNT;
    ctx->gfx_pipeline_state.rast_prim = MESA_PRIM_COUNT;
+   util_dynarray_init(&ctx->barrier_collect.barriers[0], NULL);
+   util_dynarray_init(&ctx->barrier_collect.barriers[1], NULL);
 
    zink_init_draw_functions(ctx, screen);
    zink_init_grid_functions(ctx);
@@ -135,6 +135,12 @@ zink_resource_image_transfer_dst_barrier(struct zink_context *ctx, struct zink_r
 bool
 zink_resource_buffer_transfer_dst_barrier(struct zink_context *ctx, struct zink_resource *res, unsigned offset, unsigned size);
 void
+zink_barrier_collect_begin(struct zink_context *ctx);
+void
+zink_barrier_collect_flush(struct zink_context *ctx);
+void
+zink_barrier_collect_end(struct zink_context *ctx);
+void
 zink_synchronization_init(struct zink_screen *screen);
 void
 zink_update_descriptor_refs(struct zink_context *ctx, bool compute);
@@ -873,6 +873,51 @@ set_pool(struct zink_batch_state *bs, struct zink_program *pg, struct zink_descr
    return true;
 }
 
+/* pop a retired multi-pool with a matching pool key from the context's freelist, if any */
+static struct zink_descriptor_pool_multi *
+pop_recycled_pool(struct zink_context *ctx, enum zink_descriptor_type type, const struct zink_descriptor_pool_key *pool_key)
+{
+   if (ctx->dd.pool_freelist_size[type] <= pool_key->id)
+      return NULL;
+   struct zink_descriptor_pool_multi **head = util_dynarray_element(&ctx->dd.pool_freelist[type], struct zink_descriptor_pool_multi *, pool_key->id);
+   struct zink_descriptor_pool_multi *mpool = *head;
+   if (mpool) {
+      assert(mpool->pool_key == pool_key);
+      *head = mpool->next_free;
+      mpool->next_free = NULL;
+   }
+   return mpool;
+}
+
+/* retire an idle multi-pool to the context's freelist instead of destroying it:
+ * the pools (and their pre-allocated sets) can be reused wholesale when a program
+ * with a matching pool key is created later, turning set allocation back into an
+ * array index increment instead of redoing pool creation and the set alloc ramp
+ */
+static void
+recycle_multi_pool(struct zink_context *ctx, enum zink_descriptor_type type, struct zink_descriptor_pool_multi *mpool)
+{
+   const struct zink_descriptor_pool_key *pool_key = mpool->pool_key;
+   size_t size = ctx->dd.pool_freelist[type].capacity;
+   /* ensure the freelist array is big enough to have an element for this key */
+   if (!util_dynarray_resize(&ctx->dd.pool_freelist[type], struct zink_descriptor_pool_multi *, pool_key->id + 1)) {
+      multi_pool_destroy(zink_screen(ctx->base.screen), mpool);
+      return;
+   }
+   if (size != ctx->dd.pool_freelist[type].capacity) {
+      /* when resizing, always zero the new data to avoid garbage */
+      uint8_t *data = ctx->dd.pool_freelist[type].data;
+      memset(data + size, 0, ctx->dd.pool_freelist[type].capacity - size);
+   }
+   /* dynarray can't track sparse array sizing, so the array size must be manually tracked */
+   ctx->dd.pool_freelist_size[type] = MAX2(ctx->dd.pool_freelist_size[type], pool_key->id + 1);
+   if (mpool->pool)
+      mpool->pool->set_idx = 0;
+   struct zink_descriptor_pool_multi **head = util_dynarray_element(&ctx->dd.pool_freelist[type], struct zink_descriptor_pool_multi *, pool_key->id);
+   mpool->next_free = *head;
+   *head = mpool;
+}
+
 static struct zink_descriptor_pool *
 alloc_new_pool(struct zink_screen *screen, struct zink_descriptor_pool_multi *mpool)
 {
@@ -1019,12 +1064,16 @@ get_descriptor_pool(struct zink_context *ctx, struct zink_program *pg, enum zink
                                          NULL;
    if (mppool && *mppool)
       return check_pool_alloc(ctx, *mppool, pg, type, bs, is_compute);
-   struct zink_descriptor_pool_multi *mpool = CALLOC_STRUCT(zink_descriptor_pool_multi);
-   if (!mpool)
-      return NULL;
-   util_dynarray_init(&mpool->overflowed_pools[0], NULL);
-   util_dynarray_init(&mpool->overflowed_pools[1], NULL);
-   mpool->pool_key = pool_key;
+   /* reuse a retired multi-pool before creating one from scratch */
+   struct zink_descriptor_pool_multi *mpool = pop_recycled_pool(ctx, type, pool_key);
+   if (!mpool) {
+      mpool = CALLOC_STRUCT(zink_descriptor_pool_multi);
+      if (!mpool)
+         return NULL;
+      util_dynarray_init(&mpool->overflowed_pools[0], NULL);
+      util_dynarray_init(&mpool->overflowed_pools[1], NULL);
+      mpool->pool_key = pool_key;
+   }
    if (!set_pool(bs, pg, mpool, type)) {
       multi_pool_destroy(screen, mpool);
       return NULL;
@@ -1550,8 +1599,10 @@ zink_batch_descriptor_reset(struct zink_screen *screen, struct zink_batch_state
             if (mpool->pool_key->use_count)
                mpool->pool->set_idx = 0;
             else {
-               /* otherwise destroy it to reclaim memory */
-               multi_pool_destroy(screen, mpool);
+               /* otherwise freelist it for reuse: identical programs recreated later
+                * (e.g., GL state-based shader variants) produce the same pool key
+                */
+               recycle_multi_pool(bs->ctx, i, mpool);
                mpools[j] = NULL;
             }
          }
@@ -1610,6 +1661,8 @@ bool
 zink_descriptors_init(struct zink_context *ctx)
 {
    struct zink_screen *screen = zink_screen(ctx->base.screen);
+   for (unsigned i = 0; i < ZINK_DESCRIPTOR_BASE_TYPES; i++)
+      util_dynarray_init(&ctx->dd.pool_freelist[i], NULL);
    for (unsigned i = 0; i < ZINK_GFX_SHADER_COUNT; i++) {
       VkDescriptorUpdateTemplateEntry *entry = &ctx->dd.push_entries[i];
       init_push_template_entry(entry, i);
@@ -1652,6 +1705,17 @@ void
 zink_descriptors_deinit(struct zink_context *ctx)
 {
    struct zink_screen *screen = zink_screen(ctx->base.screen);
+   for (unsigned i = 0; i < ZINK_DESCRIPTOR_BASE_TYPES; i++) {
+      for (unsigned j = 0; j < ctx->dd.pool_freelist_size[i]; j++) {
+         struct zink_descriptor_pool_multi *mpool = *util_dynarray_element(&ctx->dd.pool_freelist[i], struct zink_descriptor_pool_multi *, j);
+         while (mpool) {
+            struct zink_descriptor_pool_multi *next = mpool->next_free;
+            multi_pool_destroy(screen, mpool);
+            mpool = next;
+         }
+      }
+      util_dynarray_fini(&ctx->dd.pool_freelist[i]);
+   }
    if (ctx->dd.push_dsl[0])
       VKSCR(DestroyDescriptorSetLayout)(screen->dev, ctx->dd.push_dsl[0]->layout, NULL);
    if (ctx->dd.push_dsl[1])
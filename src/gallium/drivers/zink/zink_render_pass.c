@@ -621,6 +621,8 @@ prep_fb_attachments(struct zink_context *ctx, VkImageView *att)
    bool have_zsbuf = ctx->fb_state.zsbuf && zink_is_zsbuf_used(ctx);
    const unsigned cresolve_offset = ctx->fb_state.nr_cbufs + !!have_zsbuf;
    unsigned num_resolves = 0;
+   /* combine the attachment barriers into single vkCmdPipelineBarrier2 calls */
+   zink_barrier_collect_begin(ctx);
    for (int i = 0; i < ctx->fb_state.nr_cbufs; i++) {
       struct zink_surface *surf = zink_csurface(ctx->fb_state.cbufs[i]);
       struct zink_surface *transient = zink_transient_surface(ctx->fb_state.cbufs[i]);
@@ -630,9 +632,11 @@ prep_fb_attachments(struct zink_context *ctx, VkImageView *att)
          num_resolves++;
       } else {
          att[i] = zink_prep_fb_attachment(ctx, surf, i);
-         if (!att[i])
+         if (!att[i]) {
             /* dead swapchain */
+            zink_barrier_collect_end(ctx);
             return false;
+         }
       }
    }
    if (have_zsbuf) {
@@ -645,6 +649,7 @@ prep_fb_attachments(struct zink_context *ctx, VkImageView *att)
          att[ctx->fb_state.nr_cbufs] = zink_prep_fb_attachment(ctx, surf, ctx->fb_state.nr_cbufs);
       }
    }
+   zink_barrier_collect_end(ctx);
    return true;
 }
 
@@ -407,6 +407,24 @@ struct emit_memory_barrier<barrier_KHR_synchronzation2> {
          res->queue = VK_QUEUE_FAMILY_IGNORED;
          *queue_import = true;
       }
+      if (ctx->barrier_collect.active) {
+         int idx = cmdbuf == ctx->bs->cmdbuf ? 0 :
+                   cmdbuf == ctx->bs->reordered_cmdbuf ? 1 : -1;
+         if (idx != -1) {
+            /* barriers within one vkCmdPipelineBarrier2 are unordered against
+             * each other, so a second transition of the same image must go
+             * into a later call
+             */
+            util_dynarray_foreach(&ctx->barrier_collect.barriers[idx], VkImageMemoryBarrier2, prev) {
+               if (prev->image == imb.image) {
+                  zink_barrier_collect_flush(ctx);
+                  break;
+               }
+            }
+            util_dynarray_append(&ctx->barrier_collect.barriers[idx], VkImageMemoryBarrier2, imb);
+            return;
+         }
+      }
       VkDependencyInfo dep = {
          VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
          NULL,
@@ -779,6 +797,54 @@ zink_resource_buffer_barrier(struct zink_context *ctx, struct zink_resource *res
       zink_resource_copies_reset(res);
 }
 
+/* Start accumulating image barriers instead of emitting them one
+ * vkCmdPipelineBarrier2 at a time.  Only valid across a span of pure barrier
+ * emission (e.g. prepping all fb attachments for a renderpass): any other
+ * command recorded into the same cmdbufs before zink_barrier_collect_end()
+ * would be misordered against the pending barriers.  Sync2 only; the
+ * fallback path keeps emitting eagerly.
+ */
+void
+zink_barrier_collect_begin(struct zink_context *ctx)
+{
+   assert(!ctx->barrier_collect.active);
+   ctx->barrier_collect.active = true;
+}
+
+void
+zink_barrier_collect_flush(struct zink_context *ctx)
+{
+   for (unsigned i = 0; i < 2; i++) {
+      struct util_dynarray *barriers = &ctx->barrier_collect.barriers[i];
+      unsigned count = util_dynarray_num_elements(barriers, VkImageMemoryBarrier2);
+      if (!count)
+         continue;
+      VkCommandBuffer cmdbuf = i ? ctx->bs->reordered_cmdbuf : ctx->bs->cmdbuf;
+      VkDependencyInfo dep = {
+         VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+         NULL,
+         0,
+         0,
+         NULL,
+         0,
+         NULL,
+         count,
+         (VkImageMemoryBarrier2 *)barriers->data
+      };
+      bool marker = zink_cmd_debug_marker_begin(ctx, cmdbuf, "image_barriers(%u)", count);
+      VKCTX(CmdPipelineBarrier2)(cmdbuf, &dep);
+      zink_cmd_debug_marker_end(ctx, cmdbuf, marker);
+      util_dynarray_clear(barriers);
+   }
+}
+
+void
+zink_barrier_collect_end(struct zink_context *ctx)
+{
+   zink_barrier_collect_flush(ctx);
+   ctx->barrier_collect.active = false;
+}
+
 void
 zink_synchronization_init(struct zink_screen *screen)
 {
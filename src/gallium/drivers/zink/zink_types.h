@@ -429,6 +429,12 @@ struct zink_descriptor_data {
 
    struct zink_descriptor_layout *dummy_dsl;
 
+   /* real size of 'pool_freelist' */
+   unsigned pool_freelist_size[ZINK_DESCRIPTOR_BASE_TYPES];
+   /* multi-pools retired on batch reset when their pool key had no more users, chained by
+    * zink_descriptor_pool_key::id; members may be NULL */
+   struct util_dynarray pool_freelist[ZINK_DESCRIPTOR_BASE_TYPES];
+
    union {
       struct {
          VkDescriptorPool bindless_pool;
@@ -498,6 +504,8 @@ struct zink_descriptor_pool_multi {
    struct zink_descriptor_pool *pool;
    /* pool key for convenience */
    const struct zink_descriptor_pool_key *pool_key;
+   /* link in the per-context freelist when retired for reuse */
+   struct zink_descriptor_pool_multi *next_free;
 };
 
 /* bs->dd; created on batch state creation */
@@ -1808,6 +1816,15 @@ struct zink_context {
    struct pipe_framebuffer_state fb_state;
    struct hash_table framebuffer_cache;
 
+   /* while active, consecutive image barriers are accumulated here and then
+    * emitted as a single vkCmdPipelineBarrier2 per cmdbuf (sync2 only);
+    * see zink_barrier_collect_begin()
+    */
+   struct {
+      struct util_dynarray barriers[2]; //VkImageMemoryBarrier2: [0] = cmdbuf, [1] = reordered_cmdbuf
+      bool active;
+   } barrier_collect;
+
    struct zink_vertex_elements_state *element_state;
    struct zink_rasterizer_state *rast_state;
    struct zink_depth_stencil_alpha_state *dsa_state;
@@ -421,6 +421,16 @@ handle_in_fence(struct dri_context *ctx, __DRIimage *img)
  * Backend functions for pipe_frontend_drawable.
  */
 
+/* Note on resize storms: this function only imports the buffers the loader
+ * hands us; it never negotiates format modifiers itself.  The modifier sets
+ * are cached where they are negotiated -- the Wayland loader keeps the
+ * dmabuf-feedback format table from the compositor for the lifetime of the
+ * display, and gbm surfaces store the modifier list they were created with --
+ * so a resize costs one allocation per attachment, not a renegotiation.
+ * Speculatively allocating the "next" size here would not help either: the
+ * loader dictates the drawable size, and a mispredicted buffer is pure waste
+ * on top of the real allocation.
+ */
 static void
 dri2_allocate_textures(struct dri_context *ctx,
                        struct dri_drawable *drawable,
@@ -2027,6 +2037,8 @@ dri2_map_image(__DRIcontext *context, __DRIimage *image,
          pipe_access |= PIPE_MAP_READ;
    if (flags & __DRI_IMAGE_TRANSFER_WRITE)
          pipe_access |= PIPE_MAP_WRITE;
+   if (flags & __DRI_IMAGE_TRANSFER_DIRECT)
+         pipe_access |= PIPE_MAP_DIRECTLY;
 
    map = pipe_texture_map(pipe, resource, 0, 0, pipe_access, x0, y0,
                            width, height, &trans);
@@ -181,6 +181,14 @@ get_st_manager(void)
 
 /* Reads the color or depth buffer from the backing context to either the user storage
  * (color buffer) or our temporary (z/s)
+ *
+ * This snapshots the full frame on every front-buffer flush. Restricting the
+ * copy to tiles actually rendered since the last flush would need damage
+ * information that no gallium interface exposes: OSMesa only sees
+ * pipe_resources and works with any driver, while e.g. llvmpipe's per-tile
+ * status lives in its scene structures and is consumed during rasterization.
+ * Applications that redraw small regions can bound the copy themselves by
+ * using a correspondingly small OSMesa buffer and compositing on their side.
  */
 static void
 osmesa_read_buffer(OSMesaContext osmesa, struct pipe_resource *res, void *dst,
@@ -206,11 +214,17 @@ osmesa_read_buffer(OSMesaContext osmesa, struct pipe_resource *res, void *dst,
    }
 
    unsigned bpp = util_format_get_blocksize(res->format);
-   for (unsigned y = 0; y < res->height0; y++)
-   {
-      memcpy(dst, src, bpp * res->width0);
-      dst = (uint8_t *)dst + dst_stride;
-      src += transfer->stride;
+   if (!y_up && dst_stride == (int)transfer->stride &&
+       dst_stride == (int)(bpp * res->width0)) {
+      /* Tightly packed and not flipped: one big copy beats the row loop */
+      memcpy(dst, src, (size_t)dst_stride * res->height0);
+   } else {
+      for (unsigned y = 0; y < res->height0; y++)
+      {
+         memcpy(dst, src, bpp * res->width0);
+         dst = (uint8_t *)dst + dst_stride;
+         src += transfer->stride;
+      }
    }
 
    pipe->texture_unmap(pipe, transfer);
@@ -710,6 +710,7 @@ vlVaPutImage(VADriverContextP ctx, VASurfaceID surface, VAImageID image,
          return VA_STATUS_ERROR_ALLOCATION_FAILED;
       }
 
+      vlVaSurfaceClearExportCache(surf);
       surf->buffer->destroy(surf->buffer);
       surf->buffer = tmp_buf;
    }
@@ -744,6 +745,14 @@ vlVaPutImage(VADriverContextP ctx, VASurfaceID surface, VAImageID image,
          struct pipe_box dst_box;
          u_box_3d(0, 0, j, width, height, 1, &dst_box);
 
+         /* Staging for these uploads is the driver's business: texture_map
+          * with DISCARD_RANGE and texture_subdata go through the driver's
+          * transfer path, which already recycles fenced staging memory in
+          * write-combined placement where that helps. Frontends that can
+          * avoid this CPU copy altogether should import the producer's
+          * dmabuf instead (VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME{,_2} at
+          * surface creation).
+          */
          if (((format == PIPE_FORMAT_YV12) || (format == PIPE_FORMAT_IYUV))
              && (surf->buffer->buffer_format == PIPE_FORMAT_NV12)
              && i == 1) {
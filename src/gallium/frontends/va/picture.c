@@ -1324,6 +1324,14 @@ vlVaEndPicture(VADriverContextP ctx, VAContextID context_id)
    if (context->desc.base.fence)
       context->desc.base.flush_flags = drv->has_external_handles ? 0 : PIPE_FLUSH_ASYNC;
 
+   /* This submission is pipelined: the async flush and the per-surface fence
+    * let apps enqueue multiple vaEndPicture frames before waiting, and the
+    * bitstream readback is deferred until vaSyncBuffer/vaMapBuffer fetches
+    * the feedback (on drivers reporting ENC_SUPPORTS_ASYNC_OPERATION).
+    * Reconstructed/reference surfaces are allocated and cycled by the app as
+    * VA-API requires, so there is no frontend-side surface pool to manage.
+    */
+
    context->decoder->end_frame(context->decoder, context->target, &context->desc.base);
 
    if (drv->pipe->screen->get_video_param(drv->pipe->screen,
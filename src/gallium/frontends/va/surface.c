@@ -30,6 +30,7 @@
 #include "pipe/p_video_codec.h"
 
 #include "util/u_memory.h"
+#include "util/os_file.h"
 #include "util/u_handle_table.h"
 #include "util/u_rect.h"
 #include "util/u_sampler.h"
@@ -82,6 +83,7 @@ vlVaDestroySurfaces(VADriverContextP ctx, VASurfaceID *surface_list, int num_sur
          mtx_unlock(&drv->mutex);
          return VA_STATUS_ERROR_INVALID_SURFACE;
       }
+      vlVaSurfaceClearExportCache(surf);
       if (surf->buffer)
          surf->buffer->destroy(surf->buffer);
       if (surf->ctx) {
@@ -1021,6 +1023,21 @@ fail:
 
 #endif
 
+/**
+ * Drop the cached dmabuf export descriptor, closing the driver-owned fds.
+ * Must be called whenever surface->buffer is replaced.
+ */
+void
+vlVaSurfaceClearExportCache(vlVaSurface *surface)
+{
+#ifndef _WIN32
+   for (unsigned i = 0; i < surface->export.desc.num_objects; i++)
+      close(surface->export.desc.objects[i].fd);
+   surface->export.desc.num_objects = 0;
+   surface->export.buffer = NULL;
+#endif
+}
+
 VAStatus
 vlVaHandleSurfaceAllocate(vlVaDriver *drv, vlVaSurface *surface,
                           struct pipe_video_buffer *templat,
@@ -1030,6 +1047,8 @@ vlVaHandleSurfaceAllocate(vlVaDriver *drv, vlVaSurface *surface,
    struct pipe_surface **surfaces;
    unsigned i;
 
+   vlVaSurfaceClearExportCache(surface);
+
    if (modifiers_count > 0) {
       if (!drv->pipe->create_video_buffer_with_modifiers)
          return VA_STATUS_ERROR_ATTR_NOT_SUPPORTED;
@@ -1621,6 +1640,34 @@ vlVaExportSurfaceHandle(VADriverContextP ctx,
       interlaced->destroy(interlaced);
    }
 
+#ifndef _WIN32
+   /* Repeated exports of the same buffer (e.g. one per decoded frame in a
+    * transcode loop) can be served from the cached descriptor; each caller
+    * gets its own dups of the driver-owned fds.
+    */
+   if (surf->export.buffer == surf->buffer && surf->export.flags == flags &&
+       surf->export.desc.num_objects) {
+      VADRMPRIMESurfaceDescriptor *cached_desc = descriptor;
+
+      *cached_desc = surf->export.desc;
+      for (i = 0; i < (int)cached_desc->num_objects; i++) {
+         cached_desc->objects[i].fd =
+            os_dupfd_cloexec(surf->export.desc.objects[i].fd);
+         if (cached_desc->objects[i].fd < 0) {
+            while (--i >= 0)
+               close(cached_desc->objects[i].fd);
+            break;
+         }
+      }
+
+      if (i == (int)cached_desc->num_objects) {
+         mtx_unlock(&drv->mutex);
+         return VA_STATUS_SUCCESS;
+      }
+      /* dup failed: fall through to a fresh export */
+   }
+#endif
+
    surfaces = surf->buffer->get_surfaces(surf->buffer);
 
    usage = 0;
@@ -1732,6 +1779,25 @@ vlVaExportSurfaceHandle(VADriverContextP ctx,
    } else {
       desc->num_layers = p;
    }
+
+   /* Remember the descriptor with our own dups of the fds so the next
+    * export of this buffer doesn't need to hit the kernel.
+    */
+   vlVaSurfaceClearExportCache(surf);
+   surf->export.desc = *desc;
+   surf->export.flags = flags;
+   for (i = 0; i < (int)desc->num_objects; i++) {
+      surf->export.desc.objects[i].fd =
+         os_dupfd_cloexec(desc->objects[i].fd);
+      if (surf->export.desc.objects[i].fd < 0) {
+         /* Just skip caching, the caller still gets its descriptor. */
+         surf->export.desc.num_objects = i;
+         vlVaSurfaceClearExportCache(surf);
+         break;
+      }
+   }
+   if (i == (int)desc->num_objects)
+      surf->export.buffer = surf->buffer;
 #endif
 
    drv->has_external_handles = true;
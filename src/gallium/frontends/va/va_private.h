@@ -411,6 +411,17 @@ typedef struct {
    enum pipe_format encoder_format;
    bool full_range;
    struct pipe_fence_handle *fence;
+#ifndef _WIN32
+   /* Cached vaExportSurfaceHandle descriptor with driver-owned dmabuf fds;
+    * repeated per-frame exports of the same buffer dup these instead of
+    * going through the kernel handle-to-fd path every time.
+    */
+   struct {
+      struct pipe_video_buffer *buffer;
+      uint32_t flags;
+      VADRMPRIMESurfaceDescriptor desc;
+   } export;
+#endif
 } vlVaSurface;
 
 typedef struct {
@@ -528,6 +539,7 @@ VAStatus vlVaMapBuffer2(VADriverContextP ctx, VABufferID buf_id, void **pbuf, ui
 VAStatus vlVaHandleVAProcPipelineParameterBufferType(vlVaDriver *drv, vlVaContext *context, vlVaBuffer *buf);
 VAStatus vlVaHandleSurfaceAllocate(vlVaDriver *drv, vlVaSurface *surface, struct pipe_video_buffer *templat,
                                    const uint64_t *modifiers, unsigned int modifiers_count);
+void vlVaSurfaceClearExportCache(vlVaSurface *surface);
 void vlVaGetReferenceFrame(vlVaDriver *drv, VASurfaceID surface_id, struct pipe_video_buffer **ref_frame);
 void vlVaHandlePictureParameterBufferMPEG12(vlVaDriver *drv, vlVaContext *context, vlVaBuffer *buf);
 void vlVaHandleIQMatrixBufferMPEG12(vlVaContext *context, vlVaBuffer *buf);
@@ -192,7 +192,9 @@ struct st_config_options
    bool allow_glsl_cross_stage_interpolation_mismatch;
    bool do_dce_before_clip_cull_analysis;
    bool allow_draw_out_of_order;
+   bool allow_deferred_readpixels;
    bool glthread_nop_check_framebuffer_status;
+   bool glthread_async_get_error;
    bool ignore_map_unsynchronized;
    bool ignore_discard_framebuffer;
    bool force_integer_tex_nearest;
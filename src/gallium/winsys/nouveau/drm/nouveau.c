@@ -932,6 +932,13 @@ nouveau_bufctx(struct nouveau_bufctx *bctx)
    return (struct nouveau_bufctx_priv *)bctx;
 }
 
+/* Global residency generation source.  Drawing every bufctx's generation
+ * from one counter keeps values unique across bufctx lifetimes, so a stale
+ * (bufctx, gen) pair remembered by a pushbuf can never match a different
+ * bufctx that happens to be allocated at the same address.
+ */
+static uint32_t bufctx_gen_counter;
+
 int
 nouveau_bufctx_new(struct nouveau_client *client, int bins, struct nouveau_bufctx **pbctx)
 {
@@ -943,6 +950,7 @@ nouveau_bufctx_new(struct nouveau_client *client, int bins, struct nouveau_bufct
       list_inithead(&priv->base.pending);
       list_inithead(&priv->base.current);
       priv->base.client = client;
+      priv->base.gen = p_atomic_inc_return(&bufctx_gen_counter);
       priv->nr_bins = bins;
       *pbctx = &priv->base;
       return 0;
@@ -1006,6 +1014,8 @@ nouveau_bufctx_refn(struct nouveau_bufctx *bctx, int bin,
    pref->base.flags = flags;
    pref->base.packet = 0;
 
+   bctx->gen = p_atomic_inc_return(&bufctx_gen_counter);
+
    list_addtail(&pref->base.thead, &bctx->pending);
    pref->bufctx = bctx;
    pref->next = pbin->list;
@@ -1031,6 +1041,12 @@ struct nouveau_pushbuf_priv {
    struct nouveau_pushbuf_krec *list;
    struct nouveau_pushbuf_krec *krec;
    struct list_head bctx_list;
+   /* Bufctx and its generation as of the last successful validate; while
+    * they still match (and no flush rebuilt the kernel buffer list),
+    * validation is a no-op beyond the space check.
+    */
+   struct nouveau_bufctx *val_bctx;
+   uint32_t val_gen;
    struct nouveau_bo *bo;
    uint32_t type;
    uint32_t suffix0;
@@ -1218,8 +1234,18 @@ pushbuf_flush(struct nouveau_pushbuf *push)
       list_splice(&bctx->current, &bctx->pending);
       list_inithead(&bctx->current);
       list_delinit(&bctx->head);
+      /* Everything went back to pending, so any pushbuf remembering this
+       * bufctx's generation must not take the fast path.
+       */
+      bctx->gen = p_atomic_inc_return(&bufctx_gen_counter);
    }
 
+   /* The kernel buffer list was rebuilt from scratch, so the next validate
+    * has to re-reference everything.
+    */
+   nvpb->val_bctx = NULL;
+   nvpb->val_gen = 0;
+
    return ret;
 }
 
@@ -1459,6 +1485,15 @@ pushbuf_validate(struct nouveau_pushbuf *push, bool retry)
    int relocs = bctx ? bctx->relocs * 2: 0;
    int sref, srel, ret;
 
+   /* Unchanged BO set: every ref is already on the kernel buffer list and
+    * no new relocs will be emitted, so the conservative full-reloc space
+    * reservation and the pending-list walk can both be skipped.
+    */
+   if (bctx && bctx == nvpb->val_bctx && bctx->gen == nvpb->val_gen) {
+      assert(list_is_empty(&bctx->pending));
+      return nouveau_pushbuf_space(push, 0, 0, 0);
+   }
+
    ret = nouveau_pushbuf_space(push, relocs, relocs, 0);
    if (ret || bctx == NULL)
       return ret;
@@ -1496,6 +1531,11 @@ pushbuf_validate(struct nouveau_pushbuf *push, bool retry)
       }
    }
 
+   if (ret == 0) {
+      nvpb->val_bctx = bctx;
+      nvpb->val_gen = bctx->gen;
+   }
+
    return ret;
 }
 
@@ -1604,6 +1644,7 @@ nouveau_bufctx_reset(struct nouveau_bufctx *bctx, int bin)
 
    bctx->relocs -= pbin->relocs;
    pbin->relocs  = 0;
+   bctx->gen = p_atomic_inc_return(&bufctx_gen_counter);
 }
 
 struct nouveau_bufctx *
@@ -100,6 +100,11 @@ struct nouveau_bufctx {
    struct list_head pending;
    struct list_head current;
    int relocs;
+   /* Residency generation, bumped whenever refs are added or a bin is
+    * reset; lets pushbuf_validate() skip the bufctx walk when nothing
+    * changed since the last validate on the same pushbuf.
+    */
+   uint32_t gen;
 };
 
 struct nouveau_pushbuf {
@@ -21,6 +21,16 @@
  * USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+/* Guest-side cache of freed virgl resources, keyed on size/bind/format, so
+ * that resource churn doesn't turn into VIRTGPU_RESOURCE_CREATE round trips
+ * to the host. Released resources sit here for a timeout window; a lookup
+ * only reuses an entry once the winsys proves it idle through its
+ * entry_is_busy_func (the DRM winsys answers with a non-blocking
+ * VIRTGPU_WAIT, i.e. the host fence state, with a maybe_busy flag as a
+ * no-ioctl fast path). Entries are kept in release order, so expiry and the
+ * busy scan both stop at the first entry that fails their check.
+ */
+
 #ifndef VIRGL_RESOURCE_CACHE_H
 #define VIRGL_RESOURCE_CACHE_H
 
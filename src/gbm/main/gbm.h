@@ -431,6 +431,16 @@ enum gbm_bo_transfer_flags {
     * Read/modify/write
     */
    GBM_BO_TRANSFER_READ_WRITE = (GBM_BO_TRANSFER_READ | GBM_BO_TRANSFER_WRITE),
+
+   /**
+    * Map the buffer storage directly, without a staging copy, even if CPU
+    * access to the native layout is slower (e.g. write-combined or tiled
+    * memory). The map fails instead of silently falling back to a staging
+    * blit, so the caller can retry without this flag. Useful for streaming
+    * access patterns that touch each byte once, where the detiling blit
+    * costs more than uncached access.
+    */
+   GBM_BO_TRANSFER_DIRECT     = (1 << 2),
 };
 
 void *
@@ -243,6 +243,22 @@ blorp_copy(struct blorp_batch *batch,
            uint32_t dst_x, uint32_t dst_y,
            uint32_t src_width, uint32_t src_height);
 
+/* Copies layer_count consecutive layers of one miplevel.  When the surfaces
+ * allow it, this emits a single instanced draw covering all the layers
+ * instead of one full pipeline setup per layer; otherwise it falls back to
+ * per-layer blorp_copy() calls.
+ */
+void
+blorp_copy_layers(struct blorp_batch *batch,
+                  const struct blorp_surf *src_surf,
+                  unsigned src_level, unsigned src_layer,
+                  const struct blorp_surf *dst_surf,
+                  unsigned dst_level, unsigned dst_layer,
+                  uint32_t src_x, uint32_t src_y,
+                  uint32_t dst_x, uint32_t dst_y,
+                  uint32_t src_width, uint32_t src_height,
+                  uint32_t layer_count);
+
 void
 blorp_buffer_copy(struct blorp_batch *batch,
                   struct blorp_address src,
@@ -346,6 +362,20 @@ blorp_ccs_resolve(struct blorp_batch *batch,
                   enum isl_format format,
                   enum isl_aux_op resolve_op);
 
+/* Like blorp_ccs_resolve, but only guarantees that the given region (in
+ * pixels of the given level) gets resolved.  The edges are expanded to the
+ * hardware's resolve-rectangle alignment; on Gfx8 and earlier the whole
+ * surface is resolved regardless of the region.
+ */
+void
+blorp_ccs_resolve_region(struct blorp_batch *batch,
+                         struct blorp_surf *surf, uint32_t level,
+                         uint32_t start_layer, uint32_t num_layers,
+                         enum isl_format format,
+                         enum isl_aux_op resolve_op,
+                         uint32_t x0, uint32_t y0,
+                         uint32_t x1, uint32_t y1);
+
 void
 blorp_ccs_ambiguate(struct blorp_batch *batch,
                     struct blorp_surf *surf,
@@ -62,6 +62,21 @@ blorp_blit_vars_init(nir_builder *b, struct blorp_blit_vars *v,
    LOAD_INPUT(src_inv_size, glsl_vector_type(GLSL_TYPE_FLOAT, 2))
 
 #undef LOAD_INPUT
+
+   if (key->layered) {
+      /* Layered copies draw one instance per layer and need the source
+       * z/layer coordinate to track the render target array index.  Redirect
+       * v_src_z through a temporary so every texture fetch picks this up.
+       */
+      assert(b->shader->info.stage == MESA_SHADER_FRAGMENT);
+      nir_variable *src_z =
+         nir_local_variable_create(b->impl, glsl_float_type(), "src_z");
+      nir_store_var(b, src_z,
+                    nir_fadd(b, nir_load_var(b, v->v_src_z),
+                             nir_u2f32(b, nir_load_layer_id(b))),
+                    0x1);
+      v->v_src_z = src_z;
+   }
 }
 
 static nir_def *
@@ -2903,15 +2918,16 @@ blorp_copy_get_formats(const struct isl_device *isl_dev,
 }
 
 
-void
-blorp_copy(struct blorp_batch *batch,
-           const struct blorp_surf *src_surf,
-           unsigned src_level, unsigned src_layer,
-           const struct blorp_surf *dst_surf,
-           unsigned dst_level, unsigned dst_layer,
-           uint32_t src_x, uint32_t src_y,
-           uint32_t dst_x, uint32_t dst_y,
-           uint32_t src_width, uint32_t src_height)
+static void
+do_blorp_copy(struct blorp_batch *batch,
+              const struct blorp_surf *src_surf,
+              unsigned src_level, unsigned src_layer,
+              const struct blorp_surf *dst_surf,
+              unsigned dst_level, unsigned dst_layer,
+              uint32_t src_x, uint32_t src_y,
+              uint32_t dst_x, uint32_t dst_y,
+              uint32_t src_width, uint32_t src_height,
+              uint32_t layer_count)
 {
    const struct isl_device *isl_dev = batch->blorp->isl_dev;
    const struct intel_device_info *devinfo = isl_dev->info;
@@ -2949,6 +2965,16 @@ blorp_copy(struct blorp_batch *batch,
       .need_dst_offset = dst_surf->tile_x_sa || dst_surf->tile_y_sa,
    };
 
+   if (layer_count > 1) {
+      /* Guaranteed by blorp_copy_supports_layered() */
+      assert(!(batch->flags & (BLORP_BATCH_USE_COMPUTE |
+                               BLORP_BATCH_USE_BLITTER)));
+      assert(params.src.view.array_len >= layer_count);
+      assert(params.dst.view.array_len >= layer_count);
+      key.layered = true;
+      params.num_layers = layer_count;
+   }
+
    params.shader_type = key.base.shader_type;
    params.shader_pipeline = key.base.shader_pipeline;
 
@@ -3070,6 +3096,122 @@ blorp_copy(struct blorp_batch *batch,
    do_blorp_blit(batch, &params, &key, &coords);
 }
 
+void
+blorp_copy(struct blorp_batch *batch,
+           const struct blorp_surf *src_surf,
+           unsigned src_level, unsigned src_layer,
+           const struct blorp_surf *dst_surf,
+           unsigned dst_level, unsigned dst_layer,
+           uint32_t src_x, uint32_t src_y,
+           uint32_t dst_x, uint32_t dst_y,
+           uint32_t src_width, uint32_t src_height)
+{
+   do_blorp_copy(batch, src_surf, src_level, src_layer,
+                 dst_surf, dst_level, dst_layer,
+                 src_x, src_y, dst_x, dst_y, src_width, src_height, 1);
+}
+
+/* A layered copy draws one instance per layer with the fragment shader
+ * steering the source fetch by the render target array index.  That only
+ * works as long as none of the surface overrides in try_blorp_blit()
+ * collapse the views down to a single slice.
+ */
+static bool
+blorp_copy_supports_layered(struct blorp_batch *batch,
+                            const struct blorp_surf *src_surf,
+                            const struct blorp_surf *dst_surf)
+{
+   const struct intel_device_info *devinfo = batch->blorp->isl_dev->info;
+
+   /* Only the render pipeline has instanced layered rendering. */
+   if (batch->flags & (BLORP_BATCH_USE_COMPUTE | BLORP_BATCH_USE_BLITTER))
+      return false;
+
+   if (src_surf->surf->dim != ISL_SURF_DIM_2D ||
+       dst_surf->surf->dim != ISL_SURF_DIM_2D)
+      return false;
+
+   /* Depth and stencil destinations go through the depth-stencil config or
+    * W-tile retiling, both of which are single-slice.
+    */
+   if (isl_surf_usage_is_depth_or_stencil(src_surf->surf->usage) ||
+       isl_surf_usage_is_depth_or_stencil(dst_surf->surf->usage))
+      return false;
+
+   /* Interleaved MSAA destinations are faked as single-slice single-sampled
+    * surfaces; keep all the MSAA cases on the per-layer path.
+    */
+   if (src_surf->surf->samples > 1 || dst_surf->surf->samples > 1)
+      return false;
+
+   /* Intratile offsets are only allowed on single-slice surfaces. */
+   if (src_surf->tile_x_sa || src_surf->tile_y_sa ||
+       dst_surf->tile_x_sa || dst_surf->tile_y_sa)
+      return false;
+
+   /* Block-compressed surfaces are copied through an uncompressed view of a
+    * single slice, and RGB destinations are faked as a single slice of a red
+    * surface.
+    */
+   const struct isl_format_layout *src_fmtl =
+      isl_format_get_layout(src_surf->surf->format);
+   const struct isl_format_layout *dst_fmtl =
+      isl_format_get_layout(dst_surf->surf->format);
+   if (src_fmtl->bw > 1 || src_fmtl->bh > 1 ||
+       dst_fmtl->bw > 1 || dst_fmtl->bh > 1 ||
+       dst_fmtl->bpb % 3 == 0)
+      return false;
+
+   /* Cube maps are lowered to a single slice on gfx4. */
+   if (devinfo->ver == 4 &&
+       ((src_surf->surf->usage & ISL_SURF_USAGE_CUBE_BIT) ||
+        (dst_surf->surf->usage & ISL_SURF_USAGE_CUBE_BIT)))
+      return false;
+
+   /* Oversized surfaces get split by shrinking single slices, and the debug
+    * splitting path shrinks unconditionally.
+    */
+   if (split_blorp_blit_debug)
+      return false;
+
+   const unsigned max_surface_size = devinfo->ver >= 7 ? 16384 : 8192;
+   if (src_surf->surf->logical_level0_px.width > max_surface_size ||
+       src_surf->surf->logical_level0_px.height > max_surface_size ||
+       dst_surf->surf->logical_level0_px.width > max_surface_size ||
+       dst_surf->surf->logical_level0_px.height > max_surface_size)
+      return false;
+
+   return true;
+}
+
+void
+blorp_copy_layers(struct blorp_batch *batch,
+                  const struct blorp_surf *src_surf,
+                  unsigned src_level, unsigned src_layer,
+                  const struct blorp_surf *dst_surf,
+                  unsigned dst_level, unsigned dst_layer,
+                  uint32_t src_x, uint32_t src_y,
+                  uint32_t dst_x, uint32_t dst_y,
+                  uint32_t src_width, uint32_t src_height,
+                  uint32_t layer_count)
+{
+   if (layer_count > 1 &&
+       blorp_copy_supports_layered(batch, src_surf, dst_surf)) {
+      do_blorp_copy(batch, src_surf, src_level, src_layer,
+                    dst_surf, dst_level, dst_layer,
+                    src_x, src_y, dst_x, dst_y,
+                    src_width, src_height, layer_count);
+      return;
+   }
+
+   for (uint32_t i = 0; i < layer_count; i++) {
+      do_blorp_copy(batch, src_surf, src_level, src_layer + i,
+                    dst_surf, dst_level, dst_layer + i,
+                    src_x, src_y, dst_x, dst_y,
+                    src_width, src_height, 1);
+   }
+}
+
 static enum isl_format
 isl_format_for_size(unsigned size_B)
 {
@@ -1156,12 +1156,13 @@ blorp_clear_attachments(struct blorp_batch *batch,
    batch->blorp->exec(batch, &params);
 }
 
-void
-blorp_ccs_resolve(struct blorp_batch *batch,
-                  struct blorp_surf *surf, uint32_t level,
-                  uint32_t start_layer, uint32_t num_layers,
-                  enum isl_format format,
-                  enum isl_aux_op resolve_op)
+static void
+ccs_resolve(struct blorp_batch *batch,
+            struct blorp_surf *surf, uint32_t level,
+            uint32_t start_layer, uint32_t num_layers,
+            enum isl_format format,
+            enum isl_aux_op resolve_op,
+            uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
 {
    assert((batch->flags & BLORP_BATCH_USE_COMPUTE) == 0);
    struct blorp_params params;
@@ -1183,9 +1184,10 @@ blorp_ccs_resolve(struct blorp_batch *batch,
    blorp_surface_info_init(batch, &params.dst, surf,
                                level, start_layer, format, true);
 
-   params.x0 = params.y0 = 0;
-   params.x1 = u_minify(params.dst.surf.logical_level0_px.width, level);
-   params.y1 = u_minify(params.dst.surf.logical_level0_px.height, level);
+   const uint32_t level_width =
+      u_minify(params.dst.surf.logical_level0_px.width, level);
+   const uint32_t level_height =
+      u_minify(params.dst.surf.logical_level0_px.height, level);
    if (ISL_GFX_VER(batch->blorp->isl_dev) >= 9) {
       /* From Bspec 2424, "Render Target Resolve":
        *
@@ -1194,10 +1196,24 @@ blorp_ccs_resolve(struct blorp_batch *batch,
        *
        * Note that this differs from Vol7 of the Sky Lake PRM, which only
        * specifies aligning by the scaledown factors.
+       *
+       * Since the rectangle rules match the fast-clear ones, the resolve may
+       * also cover just a subregion of the surface; get_fast_clear_rect
+       * takes care of expanding the edges to the required alignment.
        */
+      params.x0 = MIN2(x0, level_width);
+      params.y0 = MIN2(y0, level_height);
+      params.x1 = MIN2(x1, level_width);
+      params.y1 = MIN2(y1, level_height);
       get_fast_clear_rect(batch->blorp->isl_dev, surf->surf, surf->aux_surf,
                           &params.x0, &params.y0, &params.x1, &params.y1);
    } else {
+      /* The scaled-down rectangle math below assumes an origin of (0, 0),
+       * so these platforms always resolve the whole surface.
+       */
+      params.x0 = params.y0 = 0;
+      params.x1 = level_width;
+      params.y1 = level_height;
       /* From the Ivy Bridge PRM, Vol2 Part1 11.9 "Render Target Resolve":
        *
        *    A rectangle primitive must be scaled down by the following factors
@@ -1262,6 +1278,30 @@ blorp_ccs_resolve(struct blorp_batch *batch,
    }
 }
 
+void
+blorp_ccs_resolve(struct blorp_batch *batch,
+                  struct blorp_surf *surf, uint32_t level,
+                  uint32_t start_layer, uint32_t num_layers,
+                  enum isl_format format,
+                  enum isl_aux_op resolve_op)
+{
+   ccs_resolve(batch, surf, level, start_layer, num_layers, format,
+               resolve_op, 0, 0, UINT32_MAX, UINT32_MAX);
+}
+
+void
+blorp_ccs_resolve_region(struct blorp_batch *batch,
+                         struct blorp_surf *surf, uint32_t level,
+                         uint32_t start_layer, uint32_t num_layers,
+                         enum isl_format format,
+                         enum isl_aux_op resolve_op,
+                         uint32_t x0, uint32_t y0,
+                         uint32_t x1, uint32_t y1)
+{
+   ccs_resolve(batch, surf, level, start_layer, num_layers, format,
+               resolve_op, x0, y0, x1, y1);
+}
+
 static nir_def *
 blorp_nir_bit(nir_builder *b, nir_def *src, unsigned bit)
 {
@@ -391,6 +391,12 @@ struct blorp_blit_prog_key
     */
    bool use_kill;
 
+   /* True if the source z/layer coordinate should be offset by the render
+    * target array index, so that a single instanced draw can copy one layer
+    * per instance.  Only set for layered copies on the render pipeline.
+    */
+   bool layered;
+
    /**
     * True if the WM program should be run in MSDISPMODE_PERSAMPLE with more
     * than one sample per pixel.
@@ -772,8 +772,8 @@ brw_nir_optimize(nir_shader *nir,
        * indices will nearly always be in bounds and the cost of the load is
        * low.  Therefore there shouldn't be a performance benefit to avoid it.
        */
-      LOOP_OPT(nir_opt_peephole_select, 0, true, false);
-      LOOP_OPT(nir_opt_peephole_select, 8, true, true);
+      LOOP_OPT(nir_opt_peephole_select, 0, 0, true, false);
+      LOOP_OPT(nir_opt_peephole_select, 8, 8, true, true);
 
       LOOP_OPT(nir_opt_intrinsics);
       LOOP_OPT(nir_opt_idiv_const, 32);
@@ -1706,8 +1706,8 @@ brw_postprocess_nir(nir_shader *nir, const struct brw_compiler *compiler,
        * instruction from one of the branches of the if-statement, so now it
        * might be under the threshold of conversion to bcsel.
        */
-      OPT(nir_opt_peephole_select, 0, false, false);
-      OPT(nir_opt_peephole_select, 1, false, true);
+      OPT(nir_opt_peephole_select, 0, 0, false, false);
+      OPT(nir_opt_peephole_select, 1, 1, false, true);
    }
 
    do {
@@ -661,8 +661,8 @@ elk_nir_optimize(nir_shader *nir, bool is_scalar,
       const bool is_vec4_tessellation = !is_scalar &&
          (nir->info.stage == MESA_SHADER_TESS_CTRL ||
           nir->info.stage == MESA_SHADER_TESS_EVAL);
-      OPT(nir_opt_peephole_select, 0, !is_vec4_tessellation, false);
-      OPT(nir_opt_peephole_select, 8, !is_vec4_tessellation,
+      OPT(nir_opt_peephole_select, 0, 0, !is_vec4_tessellation, false);
+      OPT(nir_opt_peephole_select, 8, 8, !is_vec4_tessellation,
           devinfo->ver >= 6);
 
       OPT(nir_opt_intrinsics);
@@ -1415,8 +1415,8 @@ elk_postprocess_nir(nir_shader *nir, const struct elk_compiler *compiler,
       const bool is_vec4_tessellation = !is_scalar &&
          (nir->info.stage == MESA_SHADER_TESS_CTRL ||
           nir->info.stage == MESA_SHADER_TESS_EVAL);
-      OPT(nir_opt_peephole_select, 0, is_vec4_tessellation, false);
-      OPT(nir_opt_peephole_select, 1, is_vec4_tessellation,
+      OPT(nir_opt_peephole_select, 0, 0, is_vec4_tessellation, false);
+      OPT(nir_opt_peephole_select, 1, 1, is_vec4_tessellation,
           compiler->devinfo->ver >= 6);
    }
 
@@ -33,6 +33,13 @@ struct PerfRecord {
 /// the driver computes an _accumulation_ (`last_perf_record - previous_perf_record`).
 /// For optimization purposes, it might ignore some perf-records, considering only those
 /// perf-records close to the boundary of the sampling period range.
+///
+/// Scope note: this data source reports device-wide OA metrics.  Per-DRM-client attribution
+/// (engine busyness, memory residency per process) is deliberately not implemented here --
+/// the kernel already publishes it through each client's /proc/<pid>/fdinfo DRM keys, which
+/// fleet agents can read directly without any tracing session or GPU-side overhead; tools
+/// like intel_gpu_top in igt-gpu-tools are built on exactly that interface.  Duplicating it
+/// behind a Mesa shared-memory protocol would add a daemon to maintain without adding data.
 class IntelDriver : public Driver
 {
    public:
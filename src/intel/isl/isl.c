@@ -29,6 +29,7 @@
 #include "dev/intel_debug.h"
 #include "genxml/genX_bits.h"
 #include "util/log.h"
+#include "util/u_cpu_detect.h"
 
 #include "isl.h"
 #include "isl_gfx4.h"
@@ -55,6 +56,16 @@ isl_memcpy_linear_to_tiled(uint32_t xt1, uint32_t xt2,
                            enum isl_tiling tiling,
                            isl_memcpy_type copy_type)
 {
+#ifdef USE_AVX512
+   if (util_get_cpu_caps()->has_avx512f &&
+       util_get_cpu_caps()->has_avx512bw) {
+      _isl_memcpy_linear_to_tiled_avx512(
+         xt1, xt2, yt1, yt2, dst, src, dst_pitch, src_pitch, has_swizzling,
+         tiling, copy_type);
+      return;
+   }
+#endif
+
 #ifdef USE_SSE41
    if (copy_type == ISL_MEMCPY_STREAMING_LOAD) {
       _isl_memcpy_linear_to_tiled_sse41(
@@ -78,6 +89,16 @@ isl_memcpy_tiled_to_linear(uint32_t xt1, uint32_t xt2,
                            enum isl_tiling tiling,
                            isl_memcpy_type copy_type)
 {
+#ifdef USE_AVX512
+   if (util_get_cpu_caps()->has_avx512f &&
+       util_get_cpu_caps()->has_avx512bw) {
+      _isl_memcpy_tiled_to_linear_avx512(
+         xt1, xt2, yt1, yt2, dst, src, dst_pitch, src_pitch, has_swizzling,
+         tiling, copy_type);
+      return;
+   }
+#endif
+
 #ifdef USE_SSE41
    if (copy_type == ISL_MEMCPY_STREAMING_LOAD) {
       _isl_memcpy_tiled_to_linear_sse41(
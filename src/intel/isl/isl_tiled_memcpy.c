@@ -36,7 +36,9 @@
 #include "util/rounding.h"
 #include "isl_priv.h"
 
-#if defined(__SSSE3__)
+#if defined(INLINE_AVX512)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
 #include <tmmintrin.h>
 #elif defined(__SSE2__)
 #include <emmintrin.h>
@@ -156,6 +158,21 @@ rgba8_copy_16_aligned_src(void *dst, const void *src)
 }
 #endif
 
+#if defined(INLINE_AVX512)
+/* The per-pixel R/B swap only permutes bytes within each 32-bit pixel, so
+ * rgba8_permutation replicated to all four 128-bit lanes works with vpshufb,
+ * which shuffles within lanes.  Unaligned loads/stores are used because a
+ * 64-byte copy is only guaranteed to be 16-byte aligned on the tiled side.
+ */
+static inline void
+rgba8_copy_64(void *dst, const void *src)
+{
+   _mm512_storeu_si512(dst,
+                       _mm512_shuffle_epi8(_mm512_loadu_si512(src),
+                                           _mm512_broadcast_i32x4(*(__m128i *)rgba8_permutation)));
+}
+#endif
+
 /**
  * Copy RGBA to BGRA - swap R and B, with the destination 16-byte aligned.
  */
@@ -166,10 +183,14 @@ rgba8_copy_aligned_dst(void *dst, const void *src, size_t bytes)
 
 #if defined(__SSSE3__) || defined(__SSE2__)
    if (bytes == 64) {
+#if defined(INLINE_AVX512)
+      rgba8_copy_64(dst, src);
+#else
       rgba8_copy_16_aligned_dst(dst +  0, src +  0);
       rgba8_copy_16_aligned_dst(dst + 16, src + 16);
       rgba8_copy_16_aligned_dst(dst + 32, src + 32);
       rgba8_copy_16_aligned_dst(dst + 48, src + 48);
+#endif
       return dst;
    }
 
@@ -196,10 +217,14 @@ rgba8_copy_aligned_src(void *dst, const void *src, size_t bytes)
 
 #if defined(__SSSE3__) || defined(__SSE2__)
    if (bytes == 64) {
+#if defined(INLINE_AVX512)
+      rgba8_copy_64(dst, src);
+#else
       rgba8_copy_16_aligned_src(dst +  0, src +  0);
       rgba8_copy_16_aligned_src(dst + 16, src + 16);
       rgba8_copy_16_aligned_src(dst + 32, src + 32);
       rgba8_copy_16_aligned_src(dst + 48, src + 48);
+#endif
       return dst;
    }
 
@@ -970,6 +995,13 @@ _memcpy_streaming_load(void *dest, const void *src, size_t count)
       _mm_storeu_si128((__m128i *)dest, val);
       return dest;
    } else if (count == 64) {
+#if defined(INLINE_AVX512)
+      /* A 64-byte span is always a whole cacheline in the tiled layout, so
+       * the source is 64-byte aligned as vmovntdqa requires.
+       */
+      __m512i val = _mm512_stream_load_si512((void *)src);
+      _mm512_storeu_si512(dest, val);
+#else
       __m128i val0 = _mm_stream_load_si128(((__m128i *)src) + 0);
       __m128i val1 = _mm_stream_load_si128(((__m128i *)src) + 1);
       __m128i val2 = _mm_stream_load_si128(((__m128i *)src) + 2);
@@ -978,6 +1010,45 @@ _memcpy_streaming_load(void *dest, const void *src, size_t count)
       _mm_storeu_si128(((__m128i *)dest) + 1, val1);
       _mm_storeu_si128(((__m128i *)dest) + 2, val2);
       _mm_storeu_si128(((__m128i *)dest) + 3, val3);
+#endif
+      return dest;
+   } else {
+      assert(count < 64); /* and (count < 16) for ytiled */
+      return memcpy(dest, src, count);
+   }
+}
+#endif
+
+#if defined(__SSE2__)
+/**
+ * Copy to a tiled destination with non-temporal stores.
+ *
+ * This bypasses the cache for the written surface, which keeps a large
+ * detiling upload from evicting the working set.  The destination of every
+ * span-sized copy is 16-byte aligned in the tiled layout, as movntdq
+ * requires; partial spans at tile edges fall back to regular stores.
+ * linear_to_tiled() issues the sfence that orders these stores.
+ */
+static ALWAYS_INLINE void *
+_memcpy_streaming_store(void *dest, const void *src, size_t count)
+{
+   if (count == 16) {
+      __m128i val = _mm_loadu_si128((__m128i *)src);
+      _mm_stream_si128((__m128i *)dest, val);
+      return dest;
+   } else if (count == 64) {
+#if defined(INLINE_AVX512)
+      _mm512_stream_si512((void *)dest, _mm512_loadu_si512(src));
+#else
+      __m128i val0 = _mm_loadu_si128(((__m128i *)src) + 0);
+      __m128i val1 = _mm_loadu_si128(((__m128i *)src) + 1);
+      __m128i val2 = _mm_loadu_si128(((__m128i *)src) + 2);
+      __m128i val3 = _mm_loadu_si128(((__m128i *)src) + 3);
+      _mm_stream_si128(((__m128i *)dest) + 0, val0);
+      _mm_stream_si128(((__m128i *)dest) + 1, val1);
+      _mm_stream_si128(((__m128i *)dest) + 2, val2);
+      _mm_stream_si128(((__m128i *)dest) + 3, val3);
+#endif
       return dest;
    } else {
       assert(count < 64); /* and (count < 16) for ytiled */
@@ -999,6 +1070,12 @@ choose_copy_function(isl_memcpy_type copy_type)
       return _memcpy_streaming_load;
 #else
       unreachable("ISL_MEMCOPY_STREAMING_LOAD requires sse4.1");
+#endif
+   case ISL_MEMCPY_STREAMING_STORE:
+#if defined(__SSE2__)
+      return _memcpy_streaming_store;
+#else
+      unreachable("ISL_MEMCPY_STREAMING_STORE requires sse2");
 #endif
    case ISL_MEMCPY_INVALID:
       unreachable("invalid copy_type");
@@ -1034,6 +1111,12 @@ linear_to_xtiled_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
          return linear_to_xtiled(0, 0, xtile_width, xtile_width, 0, xtile_height,
                                  dst, src, src_pitch, swizzle_bit,
                                  rgba8_copy, rgba8_copy_aligned_dst);
+#if defined(__SSE2__)
+      else if (copy_type == ISL_MEMCPY_STREAMING_STORE)
+         return linear_to_xtiled(0, 0, xtile_width, xtile_width, 0, xtile_height,
+                                 dst, src, src_pitch, swizzle_bit,
+                                 memcpy, _memcpy_streaming_store);
+#endif
       else
          unreachable("not reached");
    } else {
@@ -1045,6 +1128,12 @@ linear_to_xtiled_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
          return linear_to_xtiled(x0, x1, x2, x3, y0, y1,
                                  dst, src, src_pitch, swizzle_bit,
                                  rgba8_copy, rgba8_copy_aligned_dst);
+#if defined(__SSE2__)
+      else if (copy_type == ISL_MEMCPY_STREAMING_STORE)
+         return linear_to_xtiled(x0, x1, x2, x3, y0, y1,
+                                 dst, src, src_pitch, swizzle_bit,
+                                 memcpy, _memcpy_streaming_store);
+#endif
       else
          unreachable("not reached");
    }
@@ -1079,6 +1168,12 @@ linear_to_ytiled_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
          return linear_to_ytiled(0, 0, ytile_width, ytile_width, 0, ytile_height,
                                  dst, src, src_pitch, swizzle_bit,
                                  rgba8_copy, rgba8_copy_aligned_dst);
+#if defined(__SSE2__)
+      else if (copy_type == ISL_MEMCPY_STREAMING_STORE)
+         return linear_to_ytiled(0, 0, ytile_width, ytile_width, 0, ytile_height,
+                                 dst, src, src_pitch, swizzle_bit,
+                                 memcpy, _memcpy_streaming_store);
+#endif
       else
          unreachable("not reached");
    } else {
@@ -1089,6 +1184,12 @@ linear_to_ytiled_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
          return linear_to_ytiled(x0, x1, x2, x3, y0, y1,
                                  dst, src, src_pitch, swizzle_bit,
                                  rgba8_copy, rgba8_copy_aligned_dst);
+#if defined(__SSE2__)
+      else if (copy_type == ISL_MEMCPY_STREAMING_STORE)
+         return linear_to_ytiled(x0, x1, x2, x3, y0, y1,
+                                 dst, src, src_pitch, swizzle_bit,
+                                 memcpy, _memcpy_streaming_store);
+#endif
       else
          unreachable("not reached");
    }
@@ -1124,6 +1225,12 @@ linear_to_tile4_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
          return linear_to_tile4(0, 0, ytile_width, ytile_width, 0, ytile_height,
                                  dst, src, src_pitch, swizzle_bit,
                                  rgba8_copy, rgba8_copy_aligned_dst);
+#if defined(__SSE2__)
+      else if (copy_type == ISL_MEMCPY_STREAMING_STORE)
+         return linear_to_tile4(0, 0, ytile_width, ytile_width, 0, ytile_height,
+                                 dst, src, src_pitch, swizzle_bit,
+                                 memcpy, _memcpy_streaming_store);
+#endif
       else
          unreachable("not reached");
    } else {
@@ -1134,6 +1241,12 @@ linear_to_tile4_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
          return linear_to_tile4(x0, x1, x2, x3, y0, y1,
                                  dst, src, src_pitch, swizzle_bit,
                                  rgba8_copy, rgba8_copy_aligned_dst);
+#if defined(__SSE2__)
+      else if (copy_type == ISL_MEMCPY_STREAMING_STORE)
+         return linear_to_tile4(x0, x1, x2, x3, y0, y1,
+                                 dst, src, src_pitch, swizzle_bit,
+                                 memcpy, _memcpy_streaming_store);
+#endif
       else
          unreachable("not reached");
    }
@@ -1400,6 +1513,15 @@ linear_to_tiled(uint32_t xt1, uint32_t xt2,
                    copy_type);
       }
    }
+
+#if defined(__SSE2__)
+   if (copy_type == ISL_MEMCPY_STREAMING_STORE) {
+      /* Non-temporal stores are weakly ordered, so fence before anyone
+       * reads the destination or hands it to the GPU.
+       */
+      _mm_sfence();
+   }
+#endif
 }
 
 /**
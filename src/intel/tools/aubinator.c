@@ -241,6 +241,12 @@ aub_file_open(const char *filename)
       exit(EXIT_FAILURE);
    }
 
+   /* We walk the file front to back exactly once; ask the kernel for
+    * aggressive readahead so multi-GB captures don't decode at the pace of
+    * on-demand page faults.
+    */
+   (void)madvise(file->map, sb.st_size, MADV_SEQUENTIAL);
+
    close(fd);
 
    file->cursor = file->map;
@@ -399,6 +405,13 @@ int main(int argc, char *argv[])
       .execlist_write = handle_execlist_write,
       .ring_write = handle_ring_write,
    };
+   /* Batches are decoded serially, in stream order, on purpose: memory
+    * writes interleave with submissions in the AUB stream and later writes
+    * may reuse the same GTT ranges, so each batch has to be decoded against
+    * the address-space state at its submission point. Decoding batches on
+    * worker threads would require copy-on-write snapshots of the whole GTT
+    * per submission to be correct.
+    */
    int consumed;
    while (aub_file_more_stuff(file) &&
           (consumed = aub_read_command(&aub_read, file->cursor,
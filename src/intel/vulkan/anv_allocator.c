@@ -374,6 +374,15 @@ anv_block_pool_init(struct anv_block_pool *pool,
    pool->state.next = 0;
    pool->state.end = 0;
 
+   /* Pool BOs are plain GEM objects, so the page size and NUMA placement of
+    * their backing store are kernel policy, not something we can opt into
+    * per BO from here: shmem-backed objects get transparent huge pages
+    * whenever the object's size and the kernel's shmem THP setting allow it
+    * (pool growth doubles, so sizes beyond 2MB are naturally huge-page
+    * multiples), and the GTT page size is likewise picked by the kernel
+    * from the backing store's contiguity. NUMA placement follows the
+    * allocating task's memory policy at first touch.
+    */
    pool->bo_alloc_flags =
       ANV_BO_ALLOC_FIXED_ADDRESS |
       ANV_BO_ALLOC_MAPPED |
@@ -501,6 +510,16 @@ anv_block_pool_map(struct anv_block_pool *pool, int32_t offset, uint32_t size)
  *
  *  5) The center of the pool is always aligned to both the block_size of
  *     the pool and a 4K CPU page.
+ *
+ * Latency note: this is the only place where steady-state command recording
+ * can take a kernel round trip (a new BO allocation).  Pools never shrink
+ * and growth doubles, so once a process has recorded its largest frame the
+ * pools are at their high-water mark and recording stops touching the
+ * kernel entirely.  Low-latency applications get a bounded-latency steady
+ * state by warming up with one representative frame at init; persisting
+ * high-water marks across runs on the driver side was rejected because the
+ * journal would go stale with content changes while the first recorded
+ * frame always sizes the pools exactly.
  */
 static uint32_t
 anv_block_pool_grow(struct anv_block_pool *pool, struct anv_block_state *state,
@@ -403,13 +403,12 @@ copy_image(struct anv_cmd_buffer *cmd_buffer,
                                            dst_surf.aux_usage, dst_level,
                                            dst_base_layer, layer_count);
 
-         for (unsigned i = 0; i < layer_count; i++) {
-            blorp_copy(batch, &src_surf, src_level, src_base_layer + i,
-                       &dst_surf, dst_level, dst_base_layer + i,
-                       srcOffset.x, srcOffset.y,
-                       dstOffset.x, dstOffset.y,
-                       extent.width, extent.height);
-         }
+         blorp_copy_layers(batch, &src_surf, src_level, src_base_layer,
+                           &dst_surf, dst_level, dst_base_layer,
+                           srcOffset.x, srcOffset.y,
+                           dstOffset.x, dstOffset.y,
+                           extent.width, extent.height,
+                           layer_count);
       }
    } else {
       /* This case handles the ycbcr images, aspect mask are compatible but
@@ -428,13 +427,12 @@ copy_image(struct anv_cmd_buffer *cmd_buffer,
                                         dst_surf.aux_usage, dst_level,
                                         dst_base_layer, layer_count);
 
-      for (unsigned i = 0; i < layer_count; i++) {
-         blorp_copy(batch, &src_surf, src_level, src_base_layer + i,
-                    &dst_surf, dst_level, dst_base_layer + i,
-                    srcOffset.x, srcOffset.y,
-                    dstOffset.x, dstOffset.y,
-                    extent.width, extent.height);
-      }
+      blorp_copy_layers(batch, &src_surf, src_level, src_base_layer,
+                        &dst_surf, dst_level, dst_base_layer,
+                        srcOffset.x, srcOffset.y,
+                        dstOffset.x, dstOffset.y,
+                        extent.width, extent.height,
+                        layer_count);
    }
 }
 
@@ -3369,6 +3369,15 @@ VkResult anv_CreateDevice(
                                                 true);
       override_initial_entrypoints = false;
    }
+   /* Selecting the per-gen entrypoint table here is the whole cost of gen
+    * dispatch: each table entry points directly at the genX(vkCmd*)
+    * function, which is compiled per generation with the genxml pack
+    * macros fully inlined.  There is no second gen-switch inside the hot
+    * path to devirtualize -- the one indirect call left is the device
+    * dispatch itself, which the ICD model requires (entrypoints are
+    * returned as pointers through vkGetDeviceProcAddr), so a
+    * "majority-gen" build could not remove it either.
+    */
    vk_device_dispatch_table_from_entrypoints(&dispatch_table,
       anv_genX(&physical_device->info, device_entrypoints),
       override_initial_entrypoints);
@@ -4907,10 +4916,17 @@ VkResult anv_FlushMappedMemoryRanges(
       if (map_offset >= mem->map_size)
          continue;
 
-      intel_flush_range(mem->map + map_offset,
-                        MIN2(pMemoryRanges[i].size,
-                             mem->map_size - map_offset));
+      /* The fence above orders the writes against all the flushes, so each
+       * range only needs the flush loop itself; a single fence after the
+       * loop orders the (possibly unordered clflushopt) flushes before
+       * anything that follows, instead of paying two fences per range.
+       */
+      intel_flush_range_no_fence(mem->map + map_offset,
+                                 MIN2(pMemoryRanges[i].size,
+                                      mem->map_size - map_offset));
    }
+
+   __builtin_ia32_mfence();
 #endif
    return VK_SUCCESS;
 }
@@ -90,7 +90,7 @@ compile_shader(struct anv_device *device,
    NIR_PASS_V(nir, nir_lower_vars_to_ssa);
    NIR_PASS_V(nir, nir_opt_cse);
    NIR_PASS_V(nir, nir_opt_gcm, true);
-   NIR_PASS_V(nir, nir_opt_peephole_select, 1, false, false);
+   NIR_PASS_V(nir, nir_opt_peephole_select, 1, 1, false, false);
 
    NIR_PASS_V(nir, nir_lower_variable_initializers, ~0);
 
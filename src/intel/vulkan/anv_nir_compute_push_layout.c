@@ -97,6 +97,15 @@ anv_nir_compute_push_layout(nir_shader *nir,
 
    const bool has_push_intrinsic = push_start <= push_end;
 
+   /* Promotion of hot constant-offset UBO ranges into the push space happens
+    * here and in brw_nir_analyze_ubo_ranges(), not in a driver-independent
+    * NIR pass: the analysis half (find small ranges, rank by use count, fit
+    * a budget) is the easy part, but the result only means something
+    * together with the runtime half — 3DSTATE_CONSTANT range programming,
+    * the robustness mask below, and gfx_pipeline push tracking — which is
+    * inherently per-driver. radv does the equivalent by inlining push
+    * constant dwords into user SGPRs (inline_push_constant_mask).
+    */
    const bool push_ubo_ranges =
       has_const_ubo && nir->info.stage != MESA_SHADER_COMPUTE &&
       !brw_shader_stage_requires_bindless_resources(nir->info.stage);
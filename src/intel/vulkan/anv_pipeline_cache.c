@@ -764,7 +764,7 @@ anv_load_fp64_shader(struct anv_device *device)
    NIR_PASS_V(nir, nir_opt_dce);
    NIR_PASS_V(nir, nir_opt_cse);
    NIR_PASS_V(nir, nir_opt_gcm, true);
-   NIR_PASS_V(nir, nir_opt_peephole_select, 1, false, false);
+   NIR_PASS_V(nir, nir_opt_peephole_select, 1, 1, false, false);
    NIR_PASS_V(nir, nir_opt_dce);
 
    NIR_PASS_V(nir, nir_lower_explicit_io, nir_var_function_temp,
@@ -3226,6 +3226,23 @@ cmd_buffer_emit_copy_ts_buffer(struct u_trace_context *utctx,
                         count * device->utrace_timestamp_size);
 }
 
+/* Secondary command buffers are not replayed by copying packets or by
+ * re-emitting inherited state here.  Each secondary records a self-contained
+ * batch and anv_cmd_buffer_add_secondary() executes it either by jumping into
+ * it with MI_BATCH_BUFFER_START (chaining back into the container at the
+ * end), with a call/return sequence on HW that supports it, or by memcpy'ing
+ * the packets inline when the batch is small enough that a jump would cost
+ * more than the copy (see the exec_mode selection in
+ * anv_cmd_buffer_end_batch_buffer()).  The per-secondary CPU cost is
+ * therefore O(1) in the size of the secondary.
+ *
+ * What cannot be skipped is the container-side invalidation below: after the
+ * secondaries return, the container has no idea which pipeline, L3
+ * configuration or dynamic state packets they left programmed, so everything
+ * is flagged dirty and lazily re-emitted on the next draw/dispatch recorded
+ * in the container.  A state-compatibility hash would not help here because
+ * the cost is paid at most once per ExecuteCommands, not per secondary.
+ */
 void
 genX(CmdExecuteCommands)(
     VkCommandBuffer                             commandBuffer,
@@ -20,6 +20,8 @@ ANV_C_TEST(BlockPool, NoFree, block_pool_no_free_test);
 ANV_C_TEST(BlockPool, GrowFirst, block_pool_grow_first_test);
 ANV_C_TEST(BlockPool, MaxSize, block_pool_max_size);
 
+ANV_C_TEST(DescriptorSet, TemplateBench, descriptor_template_bench);
+
 extern "C" void FAIL_IN_GTEST(const char *file_path, unsigned line_number, const char *msg) {
    GTEST_FAIL_AT(file_path, line_number) << msg;
 }
@@ -64,6 +64,7 @@
 #endif
 
 #include "util/macros.h"
+#include "util/simple_mtx.h"
 
 #define __IS_LOADER
 #include "pci_id_driver_map.h"
@@ -698,10 +699,62 @@ out:
    return driver;
 }
 
+/* Per-process memoization of device -> driver name probes.
+ *
+ * GLX/EGL/Vulkan initialization can probe the same device several times in
+ * one process (display init, screen creation, ...) and each probe costs a
+ * drmGetVersion ioctl plus sysfs reads. The cache is deliberately not
+ * persisted across processes: an on-disk per-boot cache can't be
+ * invalidated reliably across module reloads, hotplug and namespaces, and
+ * the probe is cheap because it never enumerates other DRM devices.
+ */
+static simple_mtx_t driver_name_cache_mutex = SIMPLE_MTX_INITIALIZER;
+static struct {
+   dev_t rdev;
+   char *driver;
+} driver_name_cache[MAX_DRM_DEVICES];
+static unsigned num_cached_driver_names;
+
+static char *
+loader_get_cached_driver_name(dev_t rdev)
+{
+   char *driver = NULL;
+
+   simple_mtx_lock(&driver_name_cache_mutex);
+   for (unsigned i = 0; i < num_cached_driver_names; i++) {
+      if (driver_name_cache[i].rdev == rdev) {
+         driver = strdup(driver_name_cache[i].driver);
+         break;
+      }
+   }
+   simple_mtx_unlock(&driver_name_cache_mutex);
+   return driver;
+}
+
+static void
+loader_cache_driver_name(dev_t rdev, const char *driver)
+{
+   simple_mtx_lock(&driver_name_cache_mutex);
+   for (unsigned i = 0; i < num_cached_driver_names; i++) {
+      if (driver_name_cache[i].rdev == rdev)
+         goto out;
+   }
+   if (num_cached_driver_names < ARRAY_SIZE(driver_name_cache)) {
+      char *copy = strdup(driver);
+      if (copy) {
+         driver_name_cache[num_cached_driver_names].rdev = rdev;
+         driver_name_cache[num_cached_driver_names].driver = copy;
+         num_cached_driver_names++;
+      }
+   }
+out:
+   simple_mtx_unlock(&driver_name_cache_mutex);
+}
+
 char *
 loader_get_driver_for_fd(int fd)
 {
-   char *driver;
+   char *driver = NULL;
 
    /* Allow an environment variable to force choosing a different driver
     * binary.  If that driver binary can't survive on this FD, that's the
@@ -714,16 +767,27 @@ loader_get_driver_for_fd(int fd)
          return strdup(override);
    }
 
+   struct stat sbuf;
+   bool has_rdev = fstat(fd, &sbuf) == 0 && S_ISCHR(sbuf.st_mode);
+
+   if (has_rdev) {
+      driver = loader_get_cached_driver_name(sbuf.st_rdev);
+      if (driver)
+         return driver;
+   }
+
 #if defined(USE_DRICONF)
    driver = loader_get_dri_config_driver(fd);
-   if (driver)
-      return driver;
 #endif
 
-   driver = loader_get_pci_driver(fd);
+   if (!driver)
+      driver = loader_get_pci_driver(fd);
    if (!driver)
       driver = loader_get_kernel_driver_name(fd);
 
+   if (driver && has_rdev)
+      loader_cache_driver_name(sbuf.st_rdev, driver);
+
    return driver;
 }
 
@@ -22,6 +22,8 @@
  */
 
 #include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
@@ -37,7 +39,10 @@
 #include "loader_dri_helper.h"
 #include "loader_dri3_helper.h"
 #include "util/macros.h"
+#include "util/os_time.h"
 #include "util/simple_mtx.h"
+#include "util/u_debug.h"
+#include "util/u_math.h"
 #include "drm-uapi/drm_fourcc.h"
 
 /**
@@ -55,6 +60,50 @@ static struct loader_dri3_blit_context blit_context = {
    SIMPLE_MTX_INITIALIZER, NULL
 };
 
+DEBUG_GET_ONCE_BOOL_OPTION(present_stats, "LOADER_DRI3_PRESENT_STATS", false)
+
+/* Bucket a present send-to-complete latency into the drawable's log2
+ * microsecond histogram: bucket 0 is < 2 us, bucket N is < 2^(N+1) us, the
+ * last bucket collects everything slower.
+ */
+static void
+dri3_record_present_latency(struct loader_dri3_drawable *draw,
+                            uint64_t recv_sbc)
+{
+   int64_t send_time =
+      draw->present_send_time[recv_sbc % LOADER_DRI3_SEND_TIME_SLOTS];
+
+   if (!send_time)
+      return;
+
+   int64_t us = (os_time_get_nano() - send_time) / 1000;
+   unsigned bucket = MIN2(us > 0 ? util_logbase2_64(us) : 0,
+                          LOADER_DRI3_LATENCY_BUCKETS - 1);
+
+   draw->present_latency[bucket]++;
+}
+
+static void
+dri3_print_present_stats(struct loader_dri3_drawable *draw)
+{
+   uint64_t total = 0;
+
+   for (unsigned i = 0; i < LOADER_DRI3_LATENCY_BUCKETS; i++)
+      total += draw->present_latency[i];
+
+   if (!total)
+      return;
+
+   fprintf(stderr, "dri3: present latency for drawable 0x%x (%" PRIu64
+           " presents):\n", draw->drawable, total);
+   for (unsigned i = 0; i < LOADER_DRI3_LATENCY_BUCKETS; i++) {
+      if (draw->present_latency[i]) {
+         fprintf(stderr, "   < %u us: %u\n", 2u << i,
+                 draw->present_latency[i]);
+      }
+   }
+}
+
 static void
 dri3_flush_present_events(struct loader_dri3_drawable *draw);
 
@@ -353,6 +402,9 @@ loader_dri3_drawable_fini(struct loader_dri3_drawable *draw)
 {
    int i;
 
+   if (debug_get_option_present_stats())
+      dri3_print_present_stats(draw);
+
    draw->ext->core->destroyDrawable(draw->dri_drawable);
 
    for (i = 0; i < ARRAY_SIZE(draw->buffers); i++)
@@ -412,6 +464,8 @@ loader_dri3_drawable_init(xcb_connection_t *conn,
 
    draw->cur_blit_source = -1;
    draw->back_format = __DRI_IMAGE_FORMAT_NONE;
+   memset(draw->present_send_time, 0, sizeof(draw->present_send_time));
+   memset(draw->present_latency, 0, sizeof(draw->present_latency));
    mtx_init(&draw->mtx, mtx_plain);
    cnd_init(&draw->event_cnd);
 
@@ -517,6 +571,9 @@ dri3_handle_present_event(struct loader_dri3_drawable *draw,
          else if (recv_sbc == (draw->recv_sbc + 0x100000001ULL))
             draw->recv_sbc = recv_sbc - 0x100000000ULL;
 
+         if (debug_get_option_present_stats())
+            dri3_record_present_latency(draw, draw->recv_sbc);
+
          /* When moving from flip to copy, we assume that we can allocate in
           * a more optimal way if we don't need to cater for the display
           * controller.
@@ -1091,6 +1148,10 @@ loader_dri3_swap_buffers_msc(struct loader_dri3_drawable *draw,
        * semantic"
        */
       ++draw->send_sbc;
+      if (debug_get_option_present_stats()) {
+         draw->present_send_time[draw->send_sbc % LOADER_DRI3_SEND_TIME_SLOTS] =
+            os_time_get_nano();
+      }
       if (target_msc == 0 && divisor == 0 && remainder == 0)
          target_msc = draw->msc + abs(draw->swap_interval) *
                       (draw->send_sbc - draw->recv_sbc);
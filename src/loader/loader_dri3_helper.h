@@ -185,6 +185,16 @@ struct loader_dri3_drawable {
    unsigned int back_format;
    xcb_present_complete_mode_t last_present_mode;
 
+   /* Present latency tracking, only active when LOADER_DRI3_PRESENT_STATS is
+    * set: send timestamps of in-flight presents indexed by SBC, and a log2
+    * microsecond histogram of send-to-complete latency printed at drawable
+    * teardown.
+    */
+#define LOADER_DRI3_SEND_TIME_SLOTS    16
+#define LOADER_DRI3_LATENCY_BUCKETS    20
+   int64_t present_send_time[LOADER_DRI3_SEND_TIME_SLOTS];
+   uint32_t present_latency[LOADER_DRI3_LATENCY_BUCKETS];
+
    bool is_protected_content;
 
    /* Currently protects the following fields:
@@ -24,6 +24,7 @@ import contextlib
 import gl_XML
 import license
 import marshal_XML
+import static_data
 import sys
 import collections
 import apiexec
@@ -66,6 +67,11 @@ def indent(delta = 3):
     current_indent -= delta
 
 
+def hot_attr(func):
+    """Group the hot entrypoints in the hot text section for icache locality."""
+    return 'ATTRIBUTE_HOT ' if func.name in static_data.hot_functions else ''
+
+
 class PrintCode(gl_XML.gl_print_base):
     def __init__(self):
         super(PrintCode, self).__init__()
@@ -90,7 +96,7 @@ class PrintCode(gl_XML.gl_print_base):
 
     def print_sync_body(self, func):
         out('/* {0}: marshalled synchronously */'.format(func.name))
-        out('{0}{1} GLAPIENTRY'.format('static ' if func.marshal_is_static() else '', func.return_type))
+        out('{0}{1}{2} GLAPIENTRY'.format('static ' if func.marshal_is_static() else '', hot_attr(func), func.return_type))
         out('_mesa_marshal_{0}({1})'.format(func.name, func.get_parameter_string()))
         out('{')
         with indent():
@@ -104,6 +110,8 @@ class PrintCode(gl_XML.gl_print_base):
         out('')
 
     def print_unmarshal_func(self, func, is_packed=False):
+        if func.name in static_data.hot_functions:
+            out('ATTRIBUTE_HOT')
         func.print_unmarshal_prototype(is_packed=is_packed)
         out('{')
         with indent():
@@ -160,7 +168,7 @@ class PrintCode(gl_XML.gl_print_base):
         if not is_packed and func.packed_fixed_params:
             self.print_unmarshal_func(func, is_packed=True)
 
-    def print_marshal_async_code(self, func, is_packed=False):
+    def print_marshal_async_code(self, func, is_packed=False, no_error=False):
         struct = func.get_marshal_struct_name(is_packed)
 
         if func.marshal_sync:
@@ -175,7 +183,10 @@ class PrintCode(gl_XML.gl_print_base):
         else:
             size_terms = ['sizeof({0})'.format(struct)]
             for p in func.variable_params:
-                out('int {0}_size = {1};'.format(p.name, p.size_string(marshal=1)))
+                # no_error contexts promise valid arguments, so sizes can be
+                # computed with plain multiplies instead of safe_mul.
+                out('int {0}_size = {1};'.format(
+                    p.name, p.size_string(use_parens=not no_error, marshal=1)))
                 if p.img_null_flag:
                     size_terms.append('({0} ? {0}_size : 0)'.format(p.name))
                 else:
@@ -199,7 +210,12 @@ class PrintCode(gl_XML.gl_print_base):
                         list.append('({0}_size > 0 && !{0})'.format(p.name))
 
             if len(list) != 0:
-                list.append('(unsigned)cmd_size > MARSHAL_MAX_CMD_SIZE')
+                if no_error:
+                    # Invalid counts and pointers are undefined behavior with
+                    # KHR_no_error; only the batch buffer must stay protected.
+                    list = ['(unsigned)cmd_size > MARSHAL_MAX_CMD_SIZE']
+                else:
+                    list.append('(unsigned)cmd_size > MARSHAL_MAX_CMD_SIZE')
 
                 out('if (unlikely({0})) {{'.format(' || '.join(list)))
                 with indent():
@@ -258,14 +274,11 @@ class PrintCode(gl_XML.gl_print_base):
                         out('variable_data += {0}_size;'.format(p.name))
                 i += 1
 
-    def print_async_body(self, func):
-        out('/* {0}: marshalled asynchronously */'.format(func.name))
-        func.print_struct()
-        self.print_unmarshal_func(func)
-
-        out('{0}{1} GLAPIENTRY'.format('static ' if func.marshal_is_static() else '', func.return_type))
-        out('_mesa_marshal_{0}({1})'.format(
-                func.name, func.get_parameter_string()))
+    def print_async_dispatch(self, func, no_error=False):
+        out('{0}{1}{2} GLAPIENTRY'.format('static ' if func.marshal_is_static() else '', hot_attr(func), func.return_type))
+        out('_mesa_marshal_{0}{1}({2})'.format(
+                func.name, '_no_error' if no_error else '',
+                func.get_parameter_string()))
         out('{')
         with indent():
             out('GET_CURRENT_CONTEXT(ctx);')
@@ -281,13 +294,13 @@ class PrintCode(gl_XML.gl_print_base):
                     out('if (!{0}) {{'.format(func.packed_param_name))
 
                 with indent():
-                    self.print_marshal_async_code(func, is_packed=True)
+                    self.print_marshal_async_code(func, is_packed=True, no_error=no_error)
                 out('} else {')
                 with indent():
-                    self.print_marshal_async_code(func)
+                    self.print_marshal_async_code(func, no_error=no_error)
                 out('}')
             else:
-                self.print_marshal_async_code(func)
+                self.print_marshal_async_code(func, no_error=no_error)
 
             if func.marshal_call_after:
                 out(func.marshal_call_after)
@@ -301,6 +314,15 @@ class PrintCode(gl_XML.gl_print_base):
         out('')
         out('')
 
+    def print_async_body(self, func):
+        out('/* {0}: marshalled asynchronously */'.format(func.name))
+        func.print_struct()
+        self.print_unmarshal_func(func)
+        self.print_async_dispatch(func)
+        if func.marshal_no_error:
+            out('/* {0}: specialized for KHR_no_error contexts */'.format(func.name))
+            self.print_async_dispatch(func, no_error=True)
+
     def print_init_marshal_table(self, functions):
         out('void')
         out('_mesa_glthread_init_dispatch%u(struct gl_context *ctx, '
@@ -3013,3 +3013,132 @@ functions = [
     "WindowPos3sv",
     "WindowPos3svARB",
 ]
+
+
+"""Functions on the hot path of typical draw loops.
+
+The marshal stubs and unmarshal functions of these entrypoints are
+annotated with ATTRIBUTE_HOT, which makes the linker group them in the
+hot text section so that a draw loop touches as few instruction cache
+lines as possible. Keep this list limited to entrypoints that profiles
+of real apps show being called per draw or per frame."""
+hot_functions = frozenset((
+    # draws
+    "DrawArrays",
+    "DrawArraysInstanced",
+    "DrawArraysInstancedBaseInstance",
+    "DrawElements",
+    "DrawElementsBaseVertex",
+    "DrawElementsInstanced",
+    "DrawElementsInstancedBaseVertex",
+    "DrawElementsInstancedBaseVertexBaseInstance",
+    "DrawRangeElements",
+    "DrawRangeElementsBaseVertex",
+    "MultiDrawArrays",
+    "MultiDrawElements",
+    "DrawArraysIndirect",
+    "DrawElementsIndirect",
+    "MultiDrawArraysIndirect",
+    "MultiDrawElementsIndirect",
+    "DispatchCompute",
+    "Clear",
+    "ClearBufferfi",
+    "ClearBufferfv",
+    "ClearBufferiv",
+    "ClearColor",
+    "ClearDepth",
+    "ClearStencil",
+    # binds
+    "ActiveTexture",
+    "BindBuffer",
+    "BindBufferBase",
+    "BindBufferRange",
+    "BindFramebuffer",
+    "BindImageTexture",
+    "BindProgramPipeline",
+    "BindSampler",
+    "BindTexture",
+    "BindTextureUnit",
+    "BindVertexArray",
+    "BindVertexBuffer",
+    "UseProgram",
+    "UseProgramStages",
+    # vertex arrays
+    "DisableVertexAttribArray",
+    "EnableVertexAttribArray",
+    "VertexAttrib4f",
+    "VertexAttrib4fv",
+    "VertexAttribDivisor",
+    "VertexAttribIPointer",
+    "VertexAttribPointer",
+    # uniforms
+    "Uniform1f",
+    "Uniform1fv",
+    "Uniform1i",
+    "Uniform1iv",
+    "Uniform1ui",
+    "Uniform2f",
+    "Uniform2fv",
+    "Uniform2i",
+    "Uniform3f",
+    "Uniform3fv",
+    "Uniform3i",
+    "Uniform4f",
+    "Uniform4fv",
+    "Uniform4i",
+    "Uniform4iv",
+    "UniformMatrix3fv",
+    "UniformMatrix4fv",
+    "ProgramUniform4fv",
+    "ProgramUniformMatrix4fv",
+    # buffers
+    "BufferData",
+    "BufferSubData",
+    "NamedBufferSubData",
+    "MapBufferRange",
+    "UnmapBuffer",
+    "FlushMappedBufferRange",
+    "TexSubImage2D",
+    "TexParameteri",
+    "PixelStorei",
+    # frequently toggled state
+    "BlendEquation",
+    "BlendFunc",
+    "BlendFuncSeparate",
+    "ColorMask",
+    "CullFace",
+    "DepthFunc",
+    "DepthMask",
+    "DepthRange",
+    "Disable",
+    "Enable",
+    "FrontFace",
+    "LineWidth",
+    "PolygonOffset",
+    "Scissor",
+    "StencilFunc",
+    "StencilMask",
+    "StencilOp",
+    "Viewport",
+    "Flush",
+    "GetError",
+    "GetIntegerv",
+    # immediate mode, heavily used by classic apps through glthread
+    "Begin",
+    "End",
+    "Color3f",
+    "Color4f",
+    "Normal3f",
+    "TexCoord2f",
+    "Vertex2f",
+    "Vertex3f",
+    "MatrixMode",
+    "LoadIdentity",
+    "LoadMatrixf",
+    "MultMatrixf",
+    "PopMatrix",
+    "PushMatrix",
+    "Rotatef",
+    "Scalef",
+    "Translatef",
+))
@@ -1005,6 +1005,13 @@ struct gl_constants
     */
    bool GLThreadNopCheckFramebufferStatus;
 
+   /**
+    * If true, glthread answers glGetError from an error shadow updated by
+    * the driver thread instead of synchronizing. Errors from commands that
+    * are still queued are reported by a later glGetError call.
+    */
+   bool GLThreadAsyncGetError;
+
    /** GL_ARB_sparse_texture */
    GLuint MaxSparseTextureSize;
    GLuint MaxSparse3DTextureSize;
@@ -756,6 +756,7 @@ vbo_destroy_vertex_list(struct gl_context *ctx, struct vbo_save_vertex_list *nod
 
    if (node->modes) {
       free(node->modes);
+      free(node->mode_ranges);
       free(node->start_counts);
    }
 
@@ -1624,6 +1624,12 @@ _mesa_validated_drawrangeelements(struct gl_context *ctx,
     *   vertex formats are also supported by the driver)
     * - DrawID is 0 (true if glthread isn't unrolling an indirect multi draw,
     *   which is almost always true)
+    *
+    * There is deliberately no draw merging here: u_threaded_context already
+    * coalesces consecutive tc_draw_single calls whose pipe_draw_info is
+    * identical (only start/count/index_bias differing) into one multidraw
+    * when the batch is executed, so apps that spam tiny glDrawElements with
+    * unchanged state reach the driver as a single draw_vbo call.
     */
    struct st_context *st = st_context(ctx);
    if (index_bo && ctx->Driver.DrawGallium == st_draw_gallium &&
@@ -37,6 +37,7 @@
 #include "debug_output.h"
 #include "util/detect_os.h"
 #include "util/log.h"
+#include "util/u_atomic.h"
 #include "api_exec_decl.h"
 
 static void
@@ -331,6 +332,13 @@ _mesa_error( struct gl_context *ctx, GLenum error, const char *fmtString, ... )
    /* Set the GL context error state for glGetError. */
    if (ctx->ErrorValue == GL_NO_ERROR)
       ctx->ErrorValue = error;
+
+   /* Mirror the first error into the glthread shadow, which the application
+    * thread consumes without synchronizing when glthread_async_get_error is
+    * enabled. See _mesa_glthread_GetError.
+    */
+   if (ctx->Const.GLThreadAsyncGetError)
+      p_atomic_cmpxchg(&ctx->GLThread.LastError, GL_NO_ERROR, error);
 }
 
 void
@@ -663,6 +663,14 @@ update_framebuffer(struct gl_context *ctx, struct gl_framebuffer *fb)
    else {
       /* This is a user-created framebuffer.
        * Completeness only matters for user-created framebuffers.
+       *
+       * The result is cached in fb->_Status and only reset to 0
+       * ("indeterminate") when an attachment actually changes, so
+       * ping-ponging between complete FBOs costs no re-walk here.  We do
+       * re-test FBOs whose cached status is an incomplete enum rather than
+       * caching the failure: the framebuffer may be shared between contexts
+       * with different capabilities, and a status another context computed
+       * as incomplete can be complete in this one.
        */
       if (fb->_Status != GL_FRAMEBUFFER_COMPLETE) {
          _mesa_test_framebuffer_completeness(ctx, fb);
@@ -33,6 +33,7 @@
  */
 
 #include "main/mtypes.h"
+#include "main/context.h"
 #include "main/glthread.h"
 #include "main/glthread_marshal.h"
 #include "main/hash.h"
@@ -173,7 +174,7 @@ glthread_apply_thread_sched_policy(struct gl_context *ctx, bool initialization)
       int cpu = util_get_current_cpu();
 
       if (cpu >= 0 &&
-          util_thread_sched_apply_policy(glthread->queue.threads[0],
+          util_thread_sched_apply_policy(glthread->ring.thread,
                                          UTIL_THREAD_GLTHREAD, cpu,
                                          &glthread->thread_sched_state)) {
          /* If it's successful, apply the policy to the driver threads too. */
@@ -184,13 +185,98 @@ glthread_apply_thread_sched_policy(struct gl_context *ctx, bool initialization)
    }
 }
 
+/**
+ * Submit the next batch by publishing the new ring head.  This is the only
+ * producer-side operation and never takes a lock unless the worker went to
+ * sleep; the exchange on "sleeping" totally orders the submission against
+ * the worker's decision to sleep (see glthread_ring).
+ */
 static void
-glthread_thread_initialization(void *job, void *gdata, int thread_index)
+glthread_submit_batch(struct glthread_ring *ring)
+{
+   p_atomic_set(&ring->head, ring->head + 1);
+
+   if (p_atomic_xchg(&ring->sleeping, false)) {
+      mtx_lock(&ring->mutex);
+      cnd_signal(&ring->wakeup);
+      mtx_unlock(&ring->mutex);
+   }
+}
+
+static int
+glthread_worker_thread(void *job)
 {
    struct gl_context *ctx = (struct gl_context*)job;
+   struct glthread_state *glthread = &ctx->GLThread;
+   struct glthread_ring *ring = &glthread->ring;
+   uint32_t tail = 0;
 
-   st_set_background_context(ctx, &ctx->GLThread.stats);
+   u_thread_setname("gl");
+   st_set_background_context(ctx, &glthread->stats);
    _glapi_set_context(ctx);
+   util_queue_fence_signal(&ring->init_fence);
+
+   while (true) {
+      if (tail != p_atomic_read(&ring->head)) {
+         struct glthread_batch *batch =
+            &glthread->batches[tail % MARSHAL_MAX_BATCHES];
+
+         glthread_unmarshal_batch(batch, NULL, 0);
+         tail++;
+         p_atomic_set(&ring->tail, tail);
+         util_queue_fence_signal(&batch->fence);
+         continue;
+      }
+
+      if (p_atomic_read(&ring->shutdown))
+         break;
+
+      /* Out of work.  Spin briefly in case the application thread is about
+       * to submit the next batch, then go to sleep on the doorbell.
+       */
+      bool have_work = false;
+      for (unsigned i = 0; i < 1000 && !have_work; i++)
+         have_work = tail != p_atomic_read(&ring->head);
+      if (have_work)
+         continue;
+
+      mtx_lock(&ring->mutex);
+      while (tail == p_atomic_read(&ring->head) &&
+             !p_atomic_read(&ring->shutdown)) {
+         /* The exchange orders this against glthread_submit_batch: either
+          * the producer sees sleeping == true and rings the doorbell, or
+          * the re-check below sees the new head.
+          */
+         p_atomic_xchg(&ring->sleeping, true);
+         if (tail != p_atomic_read(&ring->head) ||
+             p_atomic_read(&ring->shutdown))
+            break;
+         cnd_wait(&ring->wakeup, &ring->mutex);
+      }
+      p_atomic_set(&ring->sleeping, false);
+      mtx_unlock(&ring->mutex);
+   }
+   return 0;
+}
+
+static void
+glthread_stop_worker(struct glthread_state *glthread)
+{
+   struct glthread_ring *ring = &glthread->ring;
+
+   p_atomic_set(&ring->shutdown, true);
+   if (p_atomic_xchg(&ring->sleeping, false)) {
+      mtx_lock(&ring->mutex);
+      cnd_signal(&ring->wakeup);
+      mtx_unlock(&ring->mutex);
+   }
+   thrd_join(ring->thread, NULL);
+   ring->thread_created = false;
+   cnd_destroy(&ring->wakeup);
+   mtx_destroy(&ring->mutex);
+
+   for (unsigned i = 0; i < MARSHAL_MAX_BATCHES; i++)
+      util_queue_fence_destroy(&glthread->batches[i].fence);
 }
 
 static void
@@ -218,10 +304,33 @@ _mesa_glthread_init(struct gl_context *ctx)
        !screen->get_param(screen, PIPE_CAP_ALLOW_MAPPED_BUFFERS_DURING_EXECUTION))
       return;
 
-   if (!util_queue_init(&glthread->queue, "gl", MARSHAL_MAX_BATCHES - 2,
-                        1, 0, NULL)) {
+   struct glthread_ring *ring = &glthread->ring;
+   ring->head = 0;
+   ring->tail = 0;
+   ring->shutdown = false;
+   ring->sleeping = false;
+   (void) mtx_init(&ring->mutex, mtx_plain);
+   cnd_init(&ring->wakeup);
+   util_queue_fence_init(&ring->init_fence);
+   util_queue_fence_reset(&ring->init_fence);
+
+   for (unsigned i = 0; i < MARSHAL_MAX_BATCHES; i++) {
+      glthread->batches[i].ctx = ctx;
+      util_queue_fence_init(&glthread->batches[i].fence);
+   }
+
+   /* The worker signals init_fence once it has set up its thread state and
+    * then sleeps until the first batch is submitted.
+    */
+   if (u_thread_create(&ring->thread, glthread_worker_thread, ctx) !=
+       thrd_success) {
+      cnd_destroy(&ring->wakeup);
+      mtx_destroy(&ring->mutex);
       return;
    }
+   ring->thread_created = true;
+   util_queue_fence_wait(&ring->init_fence);
+   util_queue_fence_destroy(&ring->init_fence);
 
    _mesa_InitHashTable(&glthread->VAOs);
    _mesa_glthread_reset_vao(&glthread->DefaultVAO);
@@ -230,34 +339,21 @@ _mesa_glthread_init(struct gl_context *ctx)
    ctx->MarshalExec = _mesa_alloc_dispatch_table(true);
    if (!ctx->MarshalExec) {
       _mesa_DeinitHashTable(&glthread->VAOs, NULL, NULL);
-      util_queue_destroy(&glthread->queue);
+      glthread_stop_worker(glthread);
       return;
    }
 
    _mesa_glthread_init_dispatch(ctx, ctx->MarshalExec);
    _mesa_init_pixelstore_attrib(ctx, &glthread->Unpack);
 
-   for (unsigned i = 0; i < MARSHAL_MAX_BATCHES; i++) {
-      glthread->batches[i].ctx = ctx;
-      util_queue_fence_init(&glthread->batches[i].fence);
-   }
    glthread->next_batch = &glthread->batches[glthread->next];
    glthread->used = 0;
-   glthread->stats.queue = &glthread->queue;
 
    _mesa_glthread_init_call_fence(&glthread->LastProgramChangeBatch);
    _mesa_glthread_init_call_fence(&glthread->LastDListChangeBatchIndex);
 
    _mesa_glthread_enable(ctx);
 
-   /* Execute the thread initialization function in the thread. */
-   struct util_queue_fence fence;
-   util_queue_fence_init(&fence);
-   util_queue_add_job(&glthread->queue, ctx, &fence,
-                      glthread_thread_initialization, NULL, 0);
-   util_queue_fence_wait(&fence);
-   util_queue_fence_destroy(&fence);
-
    glthread->thread_sched_enabled = ctx->pipe->set_context_param &&
                                     util_thread_scheduler_enabled();
    util_thread_scheduler_init_state(&glthread->thread_sched_state);
@@ -277,11 +373,8 @@ _mesa_glthread_destroy(struct gl_context *ctx)
 
    _mesa_glthread_disable(ctx);
 
-   if (util_queue_is_initialized(&glthread->queue)) {
-      util_queue_destroy(&glthread->queue);
-
-      for (unsigned i = 0; i < MARSHAL_MAX_BATCHES; i++)
-         util_queue_fence_destroy(&glthread->batches[i].fence);
+   if (glthread->ring.thread_created) {
+      glthread_stop_worker(glthread);
 
       _mesa_DeinitHashTable(&glthread->VAOs, free_vao, NULL);
       _mesa_glthread_release_upload_buffer(ctx);
@@ -373,11 +466,21 @@ _mesa_glthread_flush_batch(struct gl_context *ctx)
 
    struct glthread_batch *next = glthread->next_batch;
 
-   util_queue_add_job(&glthread->queue, next, &next->fence,
-                      glthread_unmarshal_batch, NULL, 0);
+   util_queue_fence_reset(&next->fence);
+   glthread_submit_batch(&glthread->ring);
+
    glthread->last = glthread->next;
    glthread->next = (glthread->next + 1) % MARSHAL_MAX_BATCHES;
    glthread->next_batch = &glthread->batches[glthread->next];
+
+   /* Wait until the new slot has been consumed before filling it.  This
+    * provides the same back-pressure the bounded queue used to: the
+    * application thread can run at most MARSHAL_MAX_BATCHES - 1 batches
+    * ahead of the worker.
+    */
+   util_queue_fence_wait(&glthread->next_batch->fence);
+   assert(glthread->ring.head - p_atomic_read(&glthread->ring.tail) <
+          MARSHAL_MAX_BATCHES);
 }
 
 /**
@@ -398,7 +501,7 @@ _mesa_glthread_finish(struct gl_context *ctx)
     * dri interface entrypoints), in which case we don't need to actually
     * synchronize against ourself.
     */
-   if (u_thread_is_self(glthread->queue.threads[0]))
+   if (u_thread_is_self(glthread->ring.thread))
       return;
 
    struct glthread_batch *last = &glthread->batches[glthread->last];
@@ -462,6 +565,26 @@ _mesa_error_glthread_safe(struct gl_context *ctx, GLenum error, bool glthread,
    }
 }
 
+/* Non-synchronizing glGetError for glthread_async_get_error.
+ *
+ * Reads and clears the error shadow that the driver thread maintains in
+ * _mesa_error. Unlike the synchronizing path, errors from commands that are
+ * still queued in the batch ring only become visible once the driver thread
+ * has executed them, i.e. usually on a later glGetError call. That trade-off
+ * is why this is an opt-in drirc option rather than the default.
+ */
+GLenum
+_mesa_glthread_GetError(struct gl_context *ctx)
+{
+   GLenum error = p_atomic_xchg(&ctx->GLThread.LastError, GL_NO_ERROR);
+
+   /* Match the KHR_no_error filtering in _mesa_GetError. */
+   if (_mesa_is_no_error_enabled(ctx) && error != GL_OUT_OF_MEMORY)
+      error = GL_NO_ERROR;
+
+   return error;
+}
+
 bool
 _mesa_glthread_invalidate_zsbuf(struct gl_context *ctx)
 {
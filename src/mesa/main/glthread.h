@@ -53,6 +53,7 @@
 
 #include <inttypes.h>
 #include <stdbool.h>
+#include "util/u_memory.h"
 #include "util/u_queue.h"
 #include "compiler/shader_enums.h"
 #include "main/config.h"
@@ -195,10 +196,40 @@ typedef enum {
    M_NUM_MATRIX_STACKS,
 } gl_matrix_index;
 
+/**
+ * Single-producer/single-consumer ring connecting the application thread
+ * to the unmarshalling thread.
+ *
+ * Batches are consumed in submission order, so the cursors are monotonic
+ * batch counts and glthread_state::batches[head % MARSHAL_MAX_BATCHES] is
+ * the next slot to submit.  "head" is only written by the application
+ * thread and "tail" only by the worker; each sits on its own cache line so
+ * that submission doesn't bounce the consumer's line.  Submission is a
+ * plain release store of "head" — the application thread never takes a
+ * lock while the worker is busy.  The mutex/condvar pair is only a
+ * doorbell for waking the worker after it ran out of work; "sleeping" is
+ * updated with atomic exchanges on both sides, which totally orders them
+ * against each other and makes the sleep/submit race safe.
+ */
+struct glthread_ring {
+   thrd_t thread;
+   bool thread_created;
+   bool shutdown;
+   bool sleeping;
+   mtx_t mutex;
+   cnd_t wakeup;
+
+   /** Signalled by the worker once it has set up its thread state. */
+   struct util_queue_fence init_fence;
+
+   EXCLUSIVE_CACHELINE(uint32_t head);
+   EXCLUSIVE_CACHELINE(uint32_t tail);
+};
+
 struct glthread_state
 {
-   /** Multithreaded queue. */
-   struct util_queue queue;
+   /** Lock-free handoff of batches to the unmarshalling thread. */
+   struct glthread_ring ring;
 
    /** This is sent to the driver for framebuffer overlay / HUD. */
    struct util_queue_monitoring stats;
@@ -208,6 +239,12 @@ struct glthread_state
    bool inside_begin_end;
    bool thread_sched_enabled;
 
+   /** First GL error recorded by the driver thread since the last
+    * glGetError, for glthread_async_get_error. Accessed atomically from
+    * both threads.
+    */
+   GLenum LastError;
+
    /** Display lists. */
    GLenum16 ListMode; /**< Zero if not inside display list, else list mode. */
    unsigned ListBase;
@@ -331,6 +368,7 @@ void _mesa_glthread_flush_batch(struct gl_context *ctx);
 void _mesa_glthread_finish(struct gl_context *ctx);
 void _mesa_glthread_finish_before(struct gl_context *ctx, const char *func);
 bool _mesa_glthread_invalidate_zsbuf(struct gl_context *ctx);
+GLenum _mesa_glthread_GetError(struct gl_context *ctx);
 void _mesa_glthread_release_upload_buffer(struct gl_context *ctx);
 void _mesa_glthread_upload(struct gl_context *ctx, const void *data,
                            GLsizeiptr size, unsigned *out_offset,
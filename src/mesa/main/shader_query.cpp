@@ -2167,8 +2167,35 @@ _mesa_create_program_resource_hash(struct gl_shader_program *shProg)
                                        _mesa_key_string_equal);
          }
 
+         const char *key = name.string;
+
+         /* Uniform storage entries carry the canonical "name[0]" form for
+          * arrays, but search_resource_hash() probes with the query's base
+          * name (any trailing "[index]" stripped), so such entries would
+          * never hit the hash and glGetUniformLocation on an array would
+          * always pay the linear resource walk. Key them by base name
+          * instead. Blocks and transform feedback varyings keep their exact
+          * names: they can have one resource per array element, where the
+          * index is part of the identity.
+          */
+         switch (res->Type) {
+         case GL_UNIFORM:
+         case GL_BUFFER_VARIABLE:
+         case GL_VERTEX_SUBROUTINE_UNIFORM:
+         case GL_GEOMETRY_SUBROUTINE_UNIFORM:
+         case GL_FRAGMENT_SUBROUTINE_UNIFORM:
+         case GL_COMPUTE_SUBROUTINE_UNIFORM:
+         case GL_TESS_CONTROL_SUBROUTINE_UNIFORM:
+         case GL_TESS_EVALUATION_SUBROUTINE_UNIFORM:
+            if (name.suffix_is_zero_square_bracketed)
+               key = ralloc_strndup(shProg, name.string, name.length - 3);
+            break;
+         default:
+            break;
+         }
+
          _mesa_hash_table_insert(shProg->data->ProgramResourceHash[type],
-                                 name.string, res);
+                                 key, res);
       }
    }
 }
@@ -544,6 +544,14 @@ struct gl_program
 
    struct st_variant *variants;
 
+   /** Constant buffer 0 slice last uploaded by st_upload_constants.  It is
+    * re-bound without a new upload when no uniform has changed since, see
+    * gl_program_parameter_list::UniformDirtyStart.
+    */
+   struct pipe_resource *const0_buffer;
+   unsigned const0_buffer_offset;
+   unsigned const0_buffer_size;
+
    union {
       /** Fields used by GLSL programs */
       struct {
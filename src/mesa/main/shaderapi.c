@@ -2153,6 +2153,16 @@ shader_source(struct gl_context *ctx, GLuint shaderObj, GLsizei count,
 
    /* Dump original shader source to MESA_SHADER_DUMP_PATH and replace
     * if corresponding entry found from MESA_SHADER_READ_PATH.
+    *
+    * Replacement is intentionally tied to glShaderSource time, which means
+    * editing a file under the read path needs an app restart (or the app
+    * respecifying its shaders) to take effect.  Watching the directory and
+    * swapping live programs from a background thread is not workable here:
+    * shader and program objects belong to the application's context thread,
+    * every program linked against the edited shader would have to be
+    * recompiled, relinked and re-bound at a point where no draw is using
+    * it, and a failed recompile would have no one to report to.  For
+    * restart-free A/B experiments, replay a trace of the workload instead.
     */
    _mesa_dump_shader_source(sh->Stage, source, original_blake3);
 
@@ -31,6 +31,8 @@
 
 
 #include "util/glheader.h"
+#include "util/u_cpu_detect.h"
+#include "util/u_queue.h"
 
 #include "context.h"
 #include "formats.h"
@@ -929,3 +931,99 @@ _mesa_decompress_image(mesa_format format, GLuint width, GLuint height,
       }
    }
 }
+
+
+/* Worker threads shared by the CPU block encoders.  The queue is created on
+ * first use and lives for the rest of the process; u_queue kills its threads
+ * from an atexit handler.
+ */
+static struct util_queue texcomp_queue;
+static bool texcomp_queue_ready = false;
+static once_flag texcomp_queue_once = ONCE_FLAG_INIT;
+
+static void
+texcomp_queue_init(void)
+{
+   unsigned num_threads = MIN2(util_get_cpu_caps()->nr_cpus, 8);
+
+   if (num_threads > 1) {
+      texcomp_queue_ready = util_queue_init(&texcomp_queue, "texcomp", 64,
+                                            num_threads, 0, NULL);
+   }
+}
+
+struct texcomp_rows_job {
+   struct util_queue_fence fence;
+   mesa_compress_rows_func func;
+   void *data;
+   int y_start;
+   int y_end;
+};
+
+static void
+texcomp_rows_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct texcomp_rows_job *job = data;
+
+   job->func(job->data, job->y_start, job->y_end);
+}
+
+/* Images with fewer blocks than this are encoded on the calling thread; the
+ * encode cost wouldn't hide the job dispatch overhead.
+ */
+#define TEXCOMP_MIN_PARALLEL_BLOCKS 1024
+
+/**
+ * Run a CPU block encoder over an image, splitting it into block-row chunks
+ * across the shared worker threads when the image is large enough.  \p func
+ * is always called with a block-aligned y_start and must not depend on any
+ * state written while encoding other rows.
+ *
+ * \param height      image height in pixels
+ * \param block_h     compressed block height in pixels
+ * \param num_blocks  total number of blocks in the image
+ */
+void
+_mesa_compress_rows(mesa_compress_rows_func func, void *data,
+                    int height, int block_h, unsigned num_blocks)
+{
+   int y_blocks = (height + block_h - 1) / block_h;
+
+   if (num_blocks >= TEXCOMP_MIN_PARALLEL_BLOCKS && y_blocks >= 2) {
+      call_once(&texcomp_queue_once, texcomp_queue_init);
+
+      if (texcomp_queue_ready) {
+         struct texcomp_rows_job jobs[8];
+         unsigned num_jobs = MIN3((unsigned)y_blocks, texcomp_queue.num_threads,
+                                  (unsigned)ARRAY_SIZE(jobs));
+         unsigned rows_per_job =
+            (y_blocks + num_jobs - 1) / num_jobs * block_h;
+
+         for (unsigned i = 0; i < num_jobs; i++) {
+            struct texcomp_rows_job *job = &jobs[i];
+
+            job->func = func;
+            job->data = data;
+            job->y_start = i * rows_per_job;
+            job->y_end = MIN2(job->y_start + rows_per_job, height);
+
+            if (i < num_jobs - 1) {
+               util_queue_fence_init(&job->fence);
+               util_queue_add_job(&texcomp_queue, job, &job->fence,
+                                  texcomp_rows_job_execute, NULL, 0);
+            } else {
+               /* Encode the last chunk on the calling thread. */
+               texcomp_rows_job_execute(job, NULL, -1);
+            }
+         }
+
+         for (unsigned i = 0; i < num_jobs - 1; i++) {
+            util_queue_fence_wait(&jobs[i].fence);
+            util_queue_fence_destroy(&jobs[i].fence);
+         }
+         return;
+      }
+   }
+
+   func(data, 0, height);
+}
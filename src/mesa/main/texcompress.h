@@ -63,4 +63,12 @@ _mesa_decompress_image(mesa_format format, GLuint width, GLuint height,
                        const GLubyte *src, GLint srcRowStride,
                        GLfloat *dest);
 
+
+/** A function to compress the pixel rows [y_start, y_end) of an image */
+typedef void (*mesa_compress_rows_func)(void *job, int y_start, int y_end);
+
+extern void
+_mesa_compress_rows(mesa_compress_rows_func func, void *job,
+                    int height, int block_h, unsigned num_blocks);
+
 #endif /* TEXCOMPRESS_H */
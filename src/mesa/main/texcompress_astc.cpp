@@ -35,7 +35,10 @@
 
 #include "texcompress_astc.h"
 #include "macros.h"
+#include "c11/threads.h"
 #include "util/half_float.h"
+#include "util/u_cpu_detect.h"
+#include "util/u_queue.h"
 #include <stdio.h>
 #include <cstdlib>  // for abort() on windows
 
@@ -1797,34 +1800,29 @@ decode_error::type Block::calculate_colour_endpoints_size()
 }
 
 /**
- * Decode ASTC 2D LDR texture data.
- *
- * \param src_width in pixels
- * \param src_height in pixels
- * \param dst_stride in bytes
+ * Decode the block rows [y_start, y_end) of an ASTC 2D LDR image.
+ * Decoder::decode() is const, so multiple threads can share one Decoder.
  */
-extern "C" void
-_mesa_unpack_astc_2d_ldr(uint8_t *dst_row,
-                         unsigned dst_stride,
-                         const uint8_t *src_row,
-                         unsigned src_stride,
-                         unsigned src_width,
-                         unsigned src_height,
-                         mesa_format format)
+static void
+decode_astc_2d_block_rows(const Decoder &dec,
+                          uint8_t *dst_row,
+                          unsigned dst_stride,
+                          const uint8_t *src_row,
+                          unsigned src_stride,
+                          unsigned src_width,
+                          unsigned src_height,
+                          unsigned y_start,
+                          unsigned y_end)
 {
-   assert(_mesa_is_format_astc_2d(format));
-   bool srgb = _mesa_is_format_srgb(format);
-
-   unsigned blk_w, blk_h;
-   _mesa_get_format_block_size(format, &blk_w, &blk_h);
-
    const unsigned block_size = 16;
+   unsigned blk_w = dec.block_w;
+   unsigned blk_h = dec.block_h;
    unsigned x_blocks = (src_width + blk_w - 1) / blk_w;
-   unsigned y_blocks = (src_height + blk_h - 1) / blk_h;
 
-   Decoder dec(blk_w, blk_h, 1, srgb, true);
+   src_row += y_start * src_stride;
+   dst_row += y_start * dst_stride * blk_h;
 
-   for (unsigned y = 0; y < y_blocks; ++y) {
+   for (unsigned y = y_start; y < y_end; ++y) {
       for (unsigned x = 0; x < x_blocks; ++x) {
          /* Same size as the largest block. */
          uint16_t block_out[12 * 12 * 4];
@@ -1852,3 +1850,121 @@ _mesa_unpack_astc_2d_ldr(uint8_t *dst_row,
       dst_row += dst_stride * blk_h;
    }
 }
+
+/* Worker threads for decoding large images block-row-parallel.  The queue is
+ * created on first use and lives for the rest of the process; u_queue kills
+ * its threads from an atexit handler.
+ */
+static struct util_queue astc_queue;
+static bool astc_queue_ready = false;
+static once_flag astc_queue_once = ONCE_FLAG_INIT;
+
+static void
+astc_queue_init(void)
+{
+   unsigned num_threads = MIN2(util_get_cpu_caps()->nr_cpus, 8);
+
+   if (num_threads > 1) {
+      astc_queue_ready = util_queue_init(&astc_queue, "astc", 64, num_threads,
+                                         0, NULL);
+   }
+}
+
+struct astc_decode_job {
+   struct util_queue_fence fence;
+   const Decoder *dec;
+   uint8_t *dst_row;
+   unsigned dst_stride;
+   const uint8_t *src_row;
+   unsigned src_stride;
+   unsigned src_width;
+   unsigned src_height;
+   unsigned y_start;
+   unsigned y_end;
+};
+
+static void
+astc_decode_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct astc_decode_job *job = (struct astc_decode_job *)data;
+
+   decode_astc_2d_block_rows(*job->dec, job->dst_row, job->dst_stride,
+                             job->src_row, job->src_stride, job->src_width,
+                             job->src_height, job->y_start, job->y_end);
+}
+
+/* Images with fewer blocks than this are decoded on the calling thread;
+ * the decode cost wouldn't hide the job dispatch overhead.
+ */
+#define ASTC_MIN_PARALLEL_BLOCKS 1024
+
+/**
+ * Decode ASTC 2D LDR texture data.
+ *
+ * \param src_width in pixels
+ * \param src_height in pixels
+ * \param dst_stride in bytes
+ */
+extern "C" void
+_mesa_unpack_astc_2d_ldr(uint8_t *dst_row,
+                         unsigned dst_stride,
+                         const uint8_t *src_row,
+                         unsigned src_stride,
+                         unsigned src_width,
+                         unsigned src_height,
+                         mesa_format format)
+{
+   assert(_mesa_is_format_astc_2d(format));
+   bool srgb = _mesa_is_format_srgb(format);
+
+   unsigned blk_w, blk_h;
+   _mesa_get_format_block_size(format, &blk_w, &blk_h);
+
+   unsigned x_blocks = (src_width + blk_w - 1) / blk_w;
+   unsigned y_blocks = (src_height + blk_h - 1) / blk_h;
+
+   Decoder dec(blk_w, blk_h, 1, srgb, true);
+
+   if (x_blocks * y_blocks >= ASTC_MIN_PARALLEL_BLOCKS && y_blocks >= 2) {
+      call_once(&astc_queue_once, astc_queue_init);
+
+      if (astc_queue_ready) {
+         struct astc_decode_job jobs[8];
+         unsigned num_jobs = MIN3(y_blocks, astc_queue.num_threads,
+                                  (unsigned)ARRAY_SIZE(jobs));
+         unsigned rows_per_job = (y_blocks + num_jobs - 1) / num_jobs;
+
+         for (unsigned i = 0; i < num_jobs; i++) {
+            struct astc_decode_job *job = &jobs[i];
+
+            job->dec = &dec;
+            job->dst_row = dst_row;
+            job->dst_stride = dst_stride;
+            job->src_row = src_row;
+            job->src_stride = src_stride;
+            job->src_width = src_width;
+            job->src_height = src_height;
+            job->y_start = i * rows_per_job;
+            job->y_end = MIN2(job->y_start + rows_per_job, y_blocks);
+
+            if (i < num_jobs - 1) {
+               util_queue_fence_init(&job->fence);
+               util_queue_add_job(&astc_queue, job, &job->fence,
+                                  astc_decode_job_execute, NULL, 0);
+            } else {
+               /* Decode the last chunk on the calling thread. */
+               astc_decode_job_execute(job, NULL, -1);
+            }
+         }
+
+         for (unsigned i = 0; i < num_jobs - 1; i++) {
+            util_queue_fence_wait(&jobs[i].fence);
+            util_queue_fence_destroy(&jobs[i].fence);
+         }
+         return;
+      }
+   }
+
+   decode_astc_2d_block_rows(dec, dst_row, dst_stride, src_row, src_stride,
+                             src_width, src_height, 0, y_blocks);
+}
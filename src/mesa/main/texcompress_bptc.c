@@ -122,6 +122,46 @@ _mesa_get_bptc_fetch_func(mesa_format format)
    }
 }
 
+/* Per-image state for encoding block rows on the shared texcompress worker
+ * threads; each job encodes an independent range of block rows.
+ */
+struct bptc_compress_job {
+   int width;
+   const uint8_t *src;
+   const float *src_float;
+   int src_rowstride;
+   uint8_t *dst;
+   int dst_block_row_bytes;
+   int dst_rowstride;
+   bool is_signed;
+};
+
+static void
+bptc_compress_unorm_rows(void *data, int y_start, int y_end)
+{
+   struct bptc_compress_job *job = data;
+
+   compress_rgba_unorm(job->width, y_end - y_start,
+                       job->src + y_start * job->src_rowstride,
+                       job->src_rowstride,
+                       job->dst + y_start / 4 * job->dst_block_row_bytes,
+                       job->dst_rowstride);
+}
+
+static void
+bptc_compress_float_rows(void *data, int y_start, int y_end)
+{
+   struct bptc_compress_job *job = data;
+
+   compress_rgb_float(job->width, y_end - y_start,
+                      job->src_float +
+                      y_start * job->src_rowstride / sizeof(float),
+                      job->src_rowstride,
+                      job->dst + y_start / 4 * job->dst_block_row_bytes,
+                      job->dst_rowstride,
+                      job->is_signed);
+}
+
 GLboolean
 _mesa_texstore_bptc_rgba_unorm(TEXSTORE_PARAMS)
 {
@@ -161,9 +201,18 @@ _mesa_texstore_bptc_rgba_unorm(TEXSTORE_PARAMS)
                                          srcFormat, srcType);
    }
 
-   compress_rgba_unorm(srcWidth, srcHeight,
-                       pixels, rowstride,
-                       dstSlices[0], dstRowStride);
+   struct bptc_compress_job job = {
+      .width = srcWidth,
+      .src = pixels,
+      .src_rowstride = rowstride,
+      .dst = dstSlices[0],
+      .dst_block_row_bytes = dstRowStride >= srcWidth * 4 ?
+                             dstRowStride : ((srcWidth + 3) & ~3) * 4,
+      .dst_rowstride = dstRowStride,
+   };
+
+   _mesa_compress_rows(bptc_compress_unorm_rows, &job, srcHeight, 4,
+                       ((srcWidth + 3) / 4) * ((srcHeight + 3) / 4));
 
    free((void *) tempImage);
 
@@ -206,10 +255,19 @@ texstore_bptc_rgb_float(TEXSTORE_PARAMS,
                                          srcFormat, srcType);
    }
 
-   compress_rgb_float(srcWidth, srcHeight,
-                      pixels, rowstride,
-                      dstSlices[0], dstRowStride,
-                      is_signed);
+   struct bptc_compress_job job = {
+      .width = srcWidth,
+      .src_float = pixels,
+      .src_rowstride = rowstride,
+      .dst = dstSlices[0],
+      .dst_block_row_bytes = dstRowStride >= srcWidth * 4 ?
+                             dstRowStride : ((srcWidth + 3) & ~3) * 4,
+      .dst_rowstride = dstRowStride,
+      .is_signed = is_signed,
+   };
+
+   _mesa_compress_rows(bptc_compress_float_rows, &job, srcHeight, 4,
+                       ((srcWidth + 3) / 4) * ((srcHeight + 3) / 4));
 
    free((void *) tempImage);
 
@@ -43,6 +43,54 @@
 #include "util/format/u_format_s3tc.h"
 
 
+/* Per-image state for encoding block rows on the shared texcompress worker
+ * threads; each job encodes an independent range of block rows.  The source
+ * image is tightly packed here (the texstore functions convert it first
+ * otherwise).
+ */
+struct s3tc_compress_job {
+   int srccomps;
+   int width;
+   const GLubyte *pixels;
+   GLubyte *dst;
+   int dst_block_row_bytes;
+   int dstRowStride;
+   unsigned dstComps;
+};
+
+static void
+s3tc_compress_dxt1_rows(void *data, int y_start, int y_end)
+{
+   struct s3tc_compress_job *job = data;
+
+   tx_compress_dxt1(job->srccomps, job->width, y_end - y_start,
+                    job->pixels + y_start * job->width * job->srccomps,
+                    job->dst + y_start / 4 * job->dst_block_row_bytes,
+                    job->dstRowStride, job->dstComps);
+}
+
+static void
+s3tc_compress_dxt3_rows(void *data, int y_start, int y_end)
+{
+   struct s3tc_compress_job *job = data;
+
+   tx_compress_dxt3(job->srccomps, job->width, y_end - y_start,
+                    job->pixels + y_start * job->width * job->srccomps,
+                    job->dst + y_start / 4 * job->dst_block_row_bytes,
+                    job->dstRowStride);
+}
+
+static void
+s3tc_compress_dxt5_rows(void *data, int y_start, int y_end)
+{
+   struct s3tc_compress_job *job = data;
+
+   tx_compress_dxt5(job->srccomps, job->width, y_end - y_start,
+                    job->pixels + y_start * job->width * job->srccomps,
+                    job->dst + y_start / 4 * job->dst_block_row_bytes,
+                    job->dstRowStride);
+}
+
 /**
  * Store user's image in rgb_dxt1 format.
  */
@@ -88,8 +136,19 @@ _mesa_texstore_rgb_dxt1(TEXSTORE_PARAMS)
 
    dst = dstSlices[0];
 
-   tx_compress_dxt1(srccomps, srcWidth, srcHeight, pixels,
-                    dst, dstRowStride, 3);
+   struct s3tc_compress_job job = {
+      .srccomps = srccomps,
+      .width = srcWidth,
+      .pixels = pixels,
+      .dst = dst,
+      .dst_block_row_bytes = dstRowStride >= srcWidth * 2 ?
+                             dstRowStride : ((srcWidth + 3) & ~3) * 2,
+      .dstRowStride = dstRowStride,
+      .dstComps = 3,
+   };
+
+   _mesa_compress_rows(s3tc_compress_dxt1_rows, &job, srcHeight, 4,
+                       ((srcWidth + 3) / 4) * ((srcHeight + 3) / 4));
 
    free((void *) tempImage);
 
@@ -144,7 +203,19 @@ _mesa_texstore_rgba_dxt1(TEXSTORE_PARAMS)
 
    dst = dstSlices[0];
 
-   tx_compress_dxt1(4, srcWidth, srcHeight, pixels, dst, dstRowStride, 4);
+   struct s3tc_compress_job job = {
+      .srccomps = 4,
+      .width = srcWidth,
+      .pixels = pixels,
+      .dst = dst,
+      .dst_block_row_bytes = dstRowStride >= srcWidth * 2 ?
+                             dstRowStride : ((srcWidth + 3) & ~3) * 2,
+      .dstRowStride = dstRowStride,
+      .dstComps = 4,
+   };
+
+   _mesa_compress_rows(s3tc_compress_dxt1_rows, &job, srcHeight, 4,
+                       ((srcWidth + 3) / 4) * ((srcHeight + 3) / 4));
 
    free((void*) tempImage);
 
@@ -198,7 +269,18 @@ _mesa_texstore_rgba_dxt3(TEXSTORE_PARAMS)
 
    dst = dstSlices[0];
 
-   tx_compress_dxt3(4, srcWidth, srcHeight, pixels, dst, dstRowStride);
+   struct s3tc_compress_job job = {
+      .srccomps = 4,
+      .width = srcWidth,
+      .pixels = pixels,
+      .dst = dst,
+      .dst_block_row_bytes = dstRowStride >= srcWidth * 4 ?
+                             dstRowStride : ((srcWidth + 3) & ~3) * 4,
+      .dstRowStride = dstRowStride,
+   };
+
+   _mesa_compress_rows(s3tc_compress_dxt3_rows, &job, srcHeight, 4,
+                       ((srcWidth + 3) / 4) * ((srcHeight + 3) / 4));
 
    free((void *) tempImage);
 
@@ -252,7 +334,18 @@ _mesa_texstore_rgba_dxt5(TEXSTORE_PARAMS)
 
    dst = dstSlices[0];
 
-   tx_compress_dxt5(4, srcWidth, srcHeight, pixels, dst, dstRowStride);
+   struct s3tc_compress_job job = {
+      .srccomps = 4,
+      .width = srcWidth,
+      .pixels = pixels,
+      .dst = dst,
+      .dst_block_row_bytes = dstRowStride >= srcWidth * 4 ?
+                             dstRowStride : ((srcWidth + 3) & ~3) * 4,
+      .dstRowStride = dstRowStride,
+   };
+
+   _mesa_compress_rows(s3tc_compress_dxt5_rows, &job, srcHeight, 4,
+                       ((srcWidth + 3) / 4) * ((srcHeight + 3) / 4));
 
    free((void *) tempImage);
 
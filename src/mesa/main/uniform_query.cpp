@@ -860,6 +860,9 @@ _mesa_propagate_uniforms_to_driver_storage(struct gl_uniform_storage *uni,
 
       dst += array_index * store->element_stride;
 
+      _mesa_parameter_values_mark_dirty(store->params, dst,
+                                        count * store->element_stride);
+
       switch (store->format) {
       case uniform_native: {
 	 unsigned j;
@@ -1019,7 +1022,8 @@ associate_uniform_storage(struct gl_context *ctx,
          unsigned pvo = params->Parameters[i].ValueOffset;
          _mesa_uniform_attach_driver_storage(storage, dmul * columns, dmul,
                                              format,
-                                             &params->ParameterValues[pvo]);
+                                             &params->ParameterValues[pvo],
+                                             params);
 
          /* When a bindless sampler/image is bound to a texture/image unit, we
           * have to overwrite the constant value by the resident handle
@@ -1501,8 +1505,13 @@ _mesa_uniform(GLint location, GLsizei count, const GLvoid *values,
             uni->driver_storage[s].data + (size_mul * offset * dword_components);
 
          if (copy_uniforms_to_storage(storage, uni, ctx, count, values, size_mul,
-                                      offset, components, basicType, !ctx_flushed))
+                                      offset, components, basicType, !ctx_flushed)) {
+            _mesa_parameter_values_mark_dirty(uni->driver_storage[s].params,
+                                              storage,
+                                              sizeof(storage[0]) * count *
+                                              dword_components * size_mul);
             ctx_flushed = true;
+         }
       }
    } else {
       storage = &uni->storage[size_mul * components * offset];
@@ -1951,8 +1960,14 @@ _mesa_uniform_matrix(GLint location, GLsizei count,
          if (copy_uniform_matrix_to_storage(ctx, storage, uni, count, values,
                                             size_mul, offset, components,
                                             vectors, transpose, cols, rows,
-                                            basicType, !flushed))
+                                            basicType, !flushed)) {
+            _mesa_parameter_values_mark_dirty(uni->driver_storage[s].params,
+                                              storage,
+                                              sizeof(storage[0]) * count *
+                                              dword_components * vectors *
+                                              size_mul);
             flushed = true;
+         }
       }
    } else {
       storage =  &uni->storage[size_mul * elements * offset];
@@ -2094,6 +2109,8 @@ _mesa_uniform_handle(GLint location, GLsizei count, const GLvoid *values,
             flushed = true;
          }
          memcpy(storage, values, size);
+         _mesa_parameter_values_mark_dirty(uni->driver_storage[s].params,
+                                           storage, size);
       }
       if (!flushed)
          return;
@@ -143,6 +143,9 @@ _mesa_new_parameter_list(void)
    list->UniformBytes = 0;
    list->FirstStateVarIndex = INT_MAX;
    list->LastStateVarIndex = 0;
+   /* Everything must be uploaded at least once. */
+   list->UniformDirtyStart = 0;
+   list->UniformDirtyEnd = ~0u;
    return list;
 }
 
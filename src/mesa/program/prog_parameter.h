@@ -140,6 +140,13 @@ struct gl_program_parameter_list
                                might invalidate ParameterValues[] */
    bool DisallowRealloc;
 
+   /* Byte range of ParameterValues modified since the last constant buffer
+    * upload, coalesced into a single span.  Start >= End means nothing has
+    * changed.  New lists start fully dirty.
+    */
+   unsigned UniformDirtyStart;
+   unsigned UniformDirtyEnd;
+
    /* Parameters are optionally sorted as follows. Uniforms and constants
     * are first, then state vars. This should be true in all cases except
     * ir_to_mesa, which adds constants at the end, and ARB_vp with ARL,
@@ -200,6 +207,26 @@ _mesa_add_state_reference(struct gl_program_parameter_list *paramList,
                           const gl_state_index16 stateTokens[STATE_LENGTH]);
 
 
+/**
+ * Grow the dirty range of \p paramList to cover \p bytes bytes starting at
+ * \p start, which must point into ParameterValues.
+ */
+static inline void
+_mesa_parameter_values_mark_dirty(struct gl_program_parameter_list *paramList,
+                                  const void *start, unsigned bytes)
+{
+   if (!paramList)
+      return;
+
+   const unsigned offset =
+      (const char *)start - (const char *)paramList->ParameterValues;
+
+   if (offset < paramList->UniformDirtyStart)
+      paramList->UniformDirtyStart = offset;
+   if (offset + bytes > paramList->UniformDirtyEnd)
+      paramList->UniformDirtyEnd = offset + bytes;
+}
+
 static inline GLint
 _mesa_lookup_parameter_index(const struct gl_program_parameter_list *paramList,
                              const char *name)
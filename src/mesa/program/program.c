@@ -250,6 +250,8 @@ _mesa_delete_program(struct gl_context *ctx, struct gl_program *prog)
 
    st_release_variants(st, prog);
 
+   pipe_resource_reference(&prog->const0_buffer, NULL);
+
    free(prog->serialized_nir);
    free(prog->base_serialized_nir);
 
@@ -122,29 +122,59 @@ st_upload_constants(struct st_context *st, struct gl_program *prog, gl_shader_st
       if (st->prefer_real_buffer_in_constbuf0) {
          struct pipe_context *pipe = st->pipe;
          uint32_t *ptr;
-
-         const unsigned alignment = MAX2(
-            st->ctx->Const.UniformBufferOffsetAlignment, 64);
-
-         /* fetch_state always stores 4 components (16 bytes) per matrix row,
-          * but matrix rows are sometimes allocated partially, so add 12
-          * to compensate for the fetch_state defect.
-          */
-         u_upload_alloc(pipe->const_uploader, 0, paramBytes + 12,
-            alignment, &cb.buffer_offset, &cb.buffer, (void**)&ptr);
-
          int uniform_bytes = params->UniformBytes;
-         if (uniform_bytes)
-            memcpy(ptr, params->ParameterValues, uniform_bytes);
 
-         /* Upload the constants which come from fixed-function state, such as
-          * transformation matrices, fog factors, etc.
+         /* If no uniform has changed since the last upload (uniform writes
+          * coalesce into the list's dirty range) and there are no state
+          * parameters to refresh, re-bind the previously uploaded slice
+          * instead of copying everything again.  This commonly triggers when
+          * program rebinds dirty the constants atom without any data change.
+          * An upload into a fresh u_upload slice always needs the full
+          * buffer contents, so a clean range skips the whole copy.
           */
-         if (params->StateFlags)
-            _mesa_upload_state_parameters(st->ctx, params, ptr);
-
-         u_upload_unmap(pipe->const_uploader);
-         pipe->set_constant_buffer(pipe, shader_type, 0, true, &cb);
+         if (prog->const0_buffer &&
+             prog->const0_buffer_size == paramBytes &&
+             params->UniformDirtyStart >= params->UniformDirtyEnd &&
+             !params->StateFlags &&
+             prog->shader_program &&
+             !prog->sh.NumBindlessSamplers && !prog->sh.NumBindlessImages) {
+            cb.buffer = prog->const0_buffer;
+            cb.buffer_offset = prog->const0_buffer_offset;
+            pipe->set_constant_buffer(pipe, shader_type, 0, false, &cb);
+         } else {
+            const unsigned alignment = MAX2(
+               st->ctx->Const.UniformBufferOffsetAlignment, 64);
+
+            /* fetch_state always stores 4 components (16 bytes) per matrix
+             * row, but matrix rows are sometimes allocated partially, so add
+             * 12 to compensate for the fetch_state defect.
+             */
+            u_upload_alloc(pipe->const_uploader, 0, paramBytes + 12,
+               alignment, &cb.buffer_offset, &cb.buffer, (void**)&ptr);
+
+            if (uniform_bytes)
+               memcpy(ptr, params->ParameterValues, uniform_bytes);
+
+            /* Upload the constants which come from fixed-function state,
+             * such as transformation matrices, fog factors, etc.
+             */
+            if (params->StateFlags)
+               _mesa_upload_state_parameters(st->ctx, params, ptr);
+
+            u_upload_unmap(pipe->const_uploader);
+
+            /* Remember this slice for re-binding and mark the list clean.
+             * set_constant_buffer consumes the u_upload_alloc reference, so
+             * take our own first.
+             */
+            pipe_resource_reference(&prog->const0_buffer, cb.buffer);
+            prog->const0_buffer_offset = cb.buffer_offset;
+            prog->const0_buffer_size = paramBytes;
+            params->UniformDirtyStart = ~0u;
+            params->UniformDirtyEnd = 0;
+
+            pipe->set_constant_buffer(pipe, shader_type, 0, true, &cb);
+         }
 
          /* Set inlinable constants. This is more involved because state
           * parameters are uploaded directly above instead of being loaded
@@ -182,6 +182,19 @@ st_update_fp( struct st_context *st )
       key.external = st_get_external_sampler_key(st, fp);
       update_gl_clamp(st, st->ctx->FragmentProgram._Current, key.gl_clamp);
 
+      /* Remember which lowered features this context has used, so that
+       * st_precompile_shader_variant() can guess the first variant of the
+       * next program this context links.
+       */
+      st->fp_features_seen.flatshade |= key.lower_flatshade;
+      st->fp_features_seen.two_sided_color |= key.lower_two_sided_color;
+      st->fp_features_seen.clamp_color |= key.clamp_color;
+      st->fp_features_seen.persample_shading |= key.persample_shading;
+      if (key.lower_alpha_func != COMPARE_FUNC_ALWAYS) {
+         st->fp_features_seen.alpha_test = true;
+         st->fp_features_seen.alpha_func = key.lower_alpha_func;
+      }
+
       simple_mtx_lock(&st->ctx->Shared->Mutex);
       shader = st_get_fp_variant(st, fp, &key)->base.driver_shader;
       simple_mtx_unlock(&st->ctx->Shared->Mutex);
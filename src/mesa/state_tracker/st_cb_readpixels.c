@@ -339,6 +339,63 @@ blit_to_staging(struct st_context *st, struct gl_renderbuffer *rb,
    return dst;
 }
 
+/**
+ * Opt-in (driconf allow_deferred_readpixels) path for apps that read back
+ * every frame: blit the requested region into a triple-buffered staging
+ * chain and hand out the oldest matching staging texture instead of the
+ * fresh one.  The GPU has normally finished with that one, so the map in
+ * the caller doesn't stall; in exchange the app sees pixel data that is up
+ * to two reads old.  The first reads (and any read with changed parameters)
+ * still return the current frame with a full stall.
+ */
+static struct pipe_resource *
+try_deferred_readpixels(struct st_context *st, struct gl_renderbuffer *rb,
+                        bool invert_y,
+                        GLint x, GLint y, GLsizei width, GLsizei height,
+                        GLenum format,
+                        enum pipe_format src_format,
+                        enum pipe_format dst_format)
+{
+   unsigned head = st->readpix_deferred.head;
+   struct deferred_readpix_entry *oldest = &st->readpix_deferred.ring[head];
+   struct pipe_resource *staging;
+   struct pipe_resource *dst = NULL;
+
+   /* Issue this read's blit; it is consumed one or two reads from now. */
+   staging = blit_to_staging(st, rb, invert_y, x, y, width, height,
+                             format, src_format, dst_format);
+   if (!staging)
+      return NULL;
+
+   if (oldest->tex &&
+       oldest->src == rb->texture &&
+       oldest->dst_format == dst_format &&
+       oldest->level == rb->surface->u.tex.level &&
+       oldest->layer == rb->surface->u.tex.first_layer &&
+       oldest->x == x && oldest->y == y &&
+       oldest->width == width && oldest->height == height) {
+      pipe_resource_reference(&dst, oldest->tex);
+   } else {
+      /* No older blit with these parameters; return the current one. */
+      pipe_resource_reference(&dst, staging);
+   }
+
+   /* Store this read's blit in the slot of the entry just consumed. */
+   pipe_resource_reference(&oldest->tex, NULL);
+   oldest->tex = staging;
+   pipe_resource_reference(&oldest->src, rb->texture);
+   oldest->dst_format = dst_format;
+   oldest->level = rb->surface->u.tex.level;
+   oldest->layer = rb->surface->u.tex.first_layer;
+   oldest->x = x;
+   oldest->y = y;
+   oldest->width = width;
+   oldest->height = height;
+   st->readpix_deferred.head = (head + 1) % NUM_DEFERRED_READPIX_ENTRIES;
+
+   return dst;
+}
+
 static struct pipe_resource *
 try_cached_readpixels(struct st_context *st, struct gl_renderbuffer *rb,
                       bool invert_y,
@@ -498,6 +555,18 @@ st_ReadPixels(struct gl_context *ctx, GLint x, GLint y,
       goto fallback;
    }
 
+   if (st->options.allow_deferred_readpixels && !pack->BufferObj) {
+      dst = try_deferred_readpixels(st, rb,
+                                    _mesa_fb_orientation(ctx->ReadBuffer) == Y_0_TOP,
+                                    x, y, width, height, format,
+                                    src_format, dst_format);
+      if (dst) {
+         dst_x = 0;
+         dst_y = 0;
+         goto read_staging;
+      }
+   }
+
    /* Cache a staging texture for back-to-back ReadPixels, to avoid CPU-GPU
     * synchronization overhead.
     */
@@ -527,6 +596,7 @@ st_ReadPixels(struct gl_context *ctx, GLint x, GLint y,
       dst_y = 0;
    }
 
+read_staging:
    /* map resources */
    pixels = _mesa_map_pbo_dest(ctx, pack, pixels);
 
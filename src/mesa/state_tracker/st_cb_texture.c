@@ -2113,6 +2113,17 @@ fail:
 }
 
 
+/* Threading note: this always runs on the context thread (the glthread
+ * worker when glthread is on), and must -- uploads order against draws and
+ * other GL commands, so handing conversion to a free-running pool would
+ * reintroduce exactly the synchronization the command stream provides for
+ * free.  The async avenues that do exist: glthread already decouples the
+ * app thread from this work, matching-format data goes straight to
+ * pipe->texture_subdata (driver-side staging/DMA), and converting uploads
+ * from a PBO run as a GPU blit, which overlaps with rendering on its own.
+ * Loading screens bottlenecked here should upload via PBOs so the
+ * conversion leaves the CPU entirely.
+ */
 void
 st_TexSubImage(struct gl_context *ctx, GLuint dims,
                struct gl_texture_image *texImage,
@@ -347,8 +347,15 @@ st_destroy_context_priv(struct st_context *st, bool destroy_pipe)
    st_destroy_bound_texture_handles(st);
    st_destroy_bound_image_handles(st);
 
+   if (st->link_queue_initialized)
+      util_queue_destroy(&st->link_queue);
+
    /* free glReadPixels cache data */
    st_invalidate_readpix_cache(st);
+   for (unsigned i = 0; i < NUM_DEFERRED_READPIX_ENTRIES; i++) {
+      pipe_resource_reference(&st->readpix_deferred.ring[i].tex, NULL);
+      pipe_resource_reference(&st->readpix_deferred.ring[i].src, NULL);
+   }
    util_throttle_deinit(st->screen, &st->throttle);
 
    cso_destroy_context(st->cso_context);
@@ -961,6 +968,15 @@ st_destroy_context(struct st_context *st)
       _mesa_hash_table_destroy(st->hw_select_shaders, NULL);
    }
 
+   if (st->arb_nir_cache) {
+      /* The key points into the entry allocation, so freeing the data frees
+       * both.
+       */
+      hash_table_foreach(st->arb_nir_cache, entry)
+         free(entry->data);
+      _mesa_hash_table_destroy(st->arb_nir_cache, NULL);
+   }
+
    /* release framebuffer in the winsys buffers list */
    LIST_FOR_EACH_ENTRY_SAFE_REV(stfb, next, &st->winsys_buffers, head) {
       _mesa_reference_framebuffer(&stfb, NULL);
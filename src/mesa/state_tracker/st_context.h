@@ -35,6 +35,7 @@
 #include "state_tracker/st_atom.h"
 #include "util/u_helpers.h"
 #include "util/u_inlines.h"
+#include "util/u_queue.h"
 #include "util/list.h"
 #include "vbo/vbo.h"
 #include "util/list.h"
@@ -100,6 +101,20 @@ struct drawpix_cache_entry
 };
 
 
+#define NUM_DEFERRED_READPIX_ENTRIES 3
+
+struct deferred_readpix_entry
+{
+   struct pipe_resource *tex; /**< Staging texture holding an older blit */
+   struct pipe_resource *src;
+   enum pipe_format dst_format;
+   unsigned level;
+   unsigned layer;
+   GLint x, y;
+   GLsizei width, height;
+};
+
+
 /*
  * Node for a linked list of dead sampler views.
  */
@@ -200,6 +215,21 @@ struct st_context
     */
    bool shader_has_one_variant[MESA_SHADER_STAGES];
 
+   /**
+    * Fragment shader lowering features this context has actually needed so
+    * far.  st_precompile_shader_variant() uses this as a prediction of the
+    * first variant a freshly linked program will be drawn with, so it can be
+    * compiled at link time instead of hitching mid-frame on first use.
+    */
+   struct {
+      bool flatshade;
+      bool two_sided_color;
+      bool clamp_color;
+      bool persample_shading;
+      bool alpha_test;
+      uint8_t alpha_func; /**< only valid when alpha_test is set */
+   } fp_features_seen;
+
    bool needs_texcoord_semantic;
    bool apply_texture_swizzle_to_border_color;
    bool use_format_with_border_color;
@@ -312,6 +342,12 @@ struct st_context
       unsigned hits;
    } readpix_cache;
 
+   /** Staging chain for deferred glReadPixels (allow_deferred_readpixels) */
+   struct {
+      struct deferred_readpix_entry ring[NUM_DEFERRED_READPIX_ENTRIES];
+      unsigned head;
+   } readpix_deferred;
+
    /** for glClear */
    struct {
       struct pipe_rasterizer_state raster;
@@ -399,6 +435,18 @@ struct st_context
    } zombie_shaders;
 
    struct hash_table *hw_select_shaders;
+
+   /* Serialized prog_to_nir() results for ARB assembly programs, keyed by a
+    * SHA1 of the stage and source string, so re-specifying an identical
+    * program string skips retranslation. Created lazily.
+    */
+   struct hash_table *arb_nir_cache;
+
+   /* Lazily-created queue used at link time to convert the linked shader
+    * stages to NIR in parallel.
+    */
+   struct util_queue link_queue;
+   bool link_queue_initialized;
 };
 
 /**
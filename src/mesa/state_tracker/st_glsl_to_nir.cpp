@@ -55,6 +55,8 @@
 #include "compiler/glsl/shader_cache.h"
 #include "compiler/glsl/string_to_uint_map.h"
 
+#include "util/u_cpu_detect.h"
+
 static int
 type_size(const struct glsl_type *type)
 {
@@ -492,6 +494,48 @@ st_nir_lower_wpos_ytransform(struct nir_shader *nir,
    return progress;
 }
 
+struct st_stage_to_nir_state {
+   struct st_context *st;
+   struct gl_shader_program *shader_program;
+   struct gl_linked_shader *shader;
+};
+
+/* Convert one linked GLSL stage to NIR.  This may run on a link_queue worker
+ * thread, so it must only touch its own linked shader and read-only context
+ * state; the GLSL type cache is internally locked, so building types from
+ * several stages at once is safe.
+ */
+static void
+st_stage_to_nir(void *job, UNUSED void *gdata, UNUSED int thread_index)
+{
+   struct st_stage_to_nir_state *state = (struct st_stage_to_nir_state *)job;
+   struct st_context *st = state->st;
+   struct gl_shader_program *shader_program = state->shader_program;
+   struct gl_linked_shader *shader = state->shader;
+   const nir_shader_compiler_options *options =
+      st->ctx->Const.ShaderCompilerOptions[shader->Stage].NirOptions;
+   struct gl_program *prog = shader->Program;
+
+   prog->nir = glsl_to_nir(&st->ctx->Const, &shader->ir,
+                           &shader->Program->info, shader->Stage, options);
+
+   prog->nir->info.name =
+      ralloc_asprintf(shader, "GLSL%d", shader_program->Name);
+   if (shader_program->Label)
+      prog->nir->info.label = ralloc_strdup(shader, shader_program->Label);
+
+   if (prog->nir->info.stage == MESA_SHADER_FRAGMENT) {
+      prog->nir->info.fs.pixel_center_integer = prog->info.fs.pixel_center_integer;
+      prog->nir->info.fs.origin_upper_left = prog->info.fs.origin_upper_left;
+      prog->nir->info.fs.advanced_blend_modes = prog->info.fs.advanced_blend_modes;
+   }
+
+   memcpy(prog->nir->info.source_blake3, shader->linked_source_blake3,
+          BLAKE3_OUT_LEN);
+
+   nir_shader_gather_info(prog->nir, nir_shader_get_entrypoint(prog->nir));
+}
+
 static bool
 st_link_glsl_to_nir(struct gl_context *ctx,
                     struct gl_shader_program *shader_program)
@@ -514,6 +558,25 @@ st_link_glsl_to_nir(struct gl_context *ctx,
          linked_shader[num_shaders++] = shader_program->_LinkedShaders[i];
    }
 
+   /* Converting the linked stages to NIR only touches per-shader state, so
+    * with more than one stage it's worth farming the conversions out to the
+    * link_queue.  The SPIR-V path reads context state and the GLSL_DUMP
+    * printing has to stay ordered, so those run inline.
+    */
+   bool parallel = num_shaders > 1 && !shader_program->data->spirv &&
+                   !(ctx->_Shader->Flags & GLSL_DUMP);
+
+   if (parallel && !st->link_queue_initialized) {
+      st->link_queue_initialized =
+         util_queue_init(&st->link_queue, "st_link", MESA_SHADER_STAGES,
+                         MIN2(MESA_SHADER_STAGES,
+                              util_get_cpu_caps()->nr_cpus), 0, NULL);
+   }
+   parallel &= st->link_queue_initialized;
+
+   struct st_stage_to_nir_state jobs[MESA_SHADER_STAGES];
+   struct util_queue_fence fences[MESA_SHADER_STAGES];
+
    for (unsigned i = 0; i < num_shaders; i++) {
       struct gl_linked_shader *shader = linked_shader[i];
       const nir_shader_compiler_options *options =
@@ -531,35 +594,48 @@ st_link_glsl_to_nir(struct gl_context *ctx,
 
       if (shader_program->data->spirv) {
          prog->nir = _mesa_spirv_to_nir(ctx, shader_program, shader->Stage, options);
-      } else {
-         if (ctx->_Shader->Flags & GLSL_DUMP) {
-            _mesa_log("\n");
-            _mesa_log("GLSL IR for linked %s program %d:\n",
-                      _mesa_shader_stage_to_string(shader->Stage),
-                      shader_program->Name);
-            _mesa_print_ir(_mesa_get_log_file(), shader->ir, NULL);
-            _mesa_log("\n\n");
-         }
 
-         prog->nir = glsl_to_nir(&st->ctx->Const, &shader->ir,
-                                 &shader->Program->info, shader->Stage, options);
+         memcpy(prog->nir->info.source_blake3, shader->linked_source_blake3,
+                BLAKE3_OUT_LEN);
 
-         prog->nir->info.name =
-            ralloc_asprintf(shader, "GLSL%d", shader_program->Name);
-         if (shader_program->Label)
-            prog->nir->info.label = ralloc_strdup(shader, shader_program->Label);
+         nir_shader_gather_info(prog->nir, nir_shader_get_entrypoint(prog->nir));
+         continue;
+      }
 
-         if (prog->nir->info.stage == MESA_SHADER_FRAGMENT) {
-            prog->nir->info.fs.pixel_center_integer = prog->info.fs.pixel_center_integer;
-            prog->nir->info.fs.origin_upper_left = prog->info.fs.origin_upper_left;
-            prog->nir->info.fs.advanced_blend_modes = prog->info.fs.advanced_blend_modes;
-         }
+      if (ctx->_Shader->Flags & GLSL_DUMP) {
+         _mesa_log("\n");
+         _mesa_log("GLSL IR for linked %s program %d:\n",
+                   _mesa_shader_stage_to_string(shader->Stage),
+                   shader_program->Name);
+         _mesa_print_ir(_mesa_get_log_file(), shader->ir, NULL);
+         _mesa_log("\n\n");
+      }
+
+      jobs[i].st = st;
+      jobs[i].shader_program = shader_program;
+      jobs[i].shader = shader;
+
+      if (parallel) {
+         util_queue_fence_init(&fences[i]);
+         util_queue_add_job(&st->link_queue, &jobs[i], &fences[i],
+                            st_stage_to_nir, NULL, 0);
+      } else {
+         st_stage_to_nir(&jobs[i], NULL, 0);
       }
+   }
+
+   if (parallel) {
+      for (unsigned i = 0; i < num_shaders; i++) {
+         util_queue_fence_wait(&fences[i]);
+         util_queue_fence_destroy(&fences[i]);
+      }
+   }
 
-      memcpy(prog->nir->info.source_blake3, shader->linked_source_blake3,
-             BLAKE3_OUT_LEN);
+   for (unsigned i = 0; i < num_shaders; i++) {
+      struct gl_program *prog = linked_shader[i]->Program;
+      const nir_shader_compiler_options *options =
+         st->ctx->Const.ShaderCompilerOptions[prog->nir->info.stage].NirOptions;
 
-      nir_shader_gather_info(prog->nir, nir_shader_get_entrypoint(prog->nir));
       if (!st->ctx->SoftFP64 && ((prog->nir->info.bit_sizes_int | prog->nir->info.bit_sizes_float) & 64) &&
           (options->lower_doubles_options & nir_lower_fp64_full_software) != 0) {
 
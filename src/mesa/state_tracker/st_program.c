@@ -51,6 +51,8 @@
 #include "pipe/p_shader_tokens.h"
 #include "draw/draw_context.h"
 
+#include "util/hash_table.h"
+#include "util/mesa-sha1.h"
 #include "util/u_memory.h"
 
 #include "st_debug.h"
@@ -404,6 +406,59 @@ st_prog_to_nir_postprocess(struct st_context *st, nir_shader *nir,
    nir_validate_shader(nir, "after st/glsl finalize_nir");
 }
 
+/* In-memory cache of prog_to_nir() results for ARB assembly programs, keyed
+ * by stage and source string. Applications that continuously re-specify the
+ * same handful of program strings otherwise pay a full retranslation on
+ * every glProgramStringARB. Only the raw translation is cached: the
+ * post-process passes must still run per program object because they mutate
+ * the program itself (appending state parameters for wpos lowering,
+ * serializing per-program base NIR).
+ */
+struct st_arb_nir_cache_entry {
+   uint8_t sha1[SHA1_DIGEST_LENGTH];
+   size_t size;
+   char data[];
+};
+
+static uint32_t
+st_arb_nir_cache_hash(const void *key)
+{
+   return _mesa_hash_data(key, SHA1_DIGEST_LENGTH);
+}
+
+static bool
+st_arb_nir_cache_equal(const void *a, const void *b)
+{
+   return memcmp(a, b, SHA1_DIGEST_LENGTH) == 0;
+}
+
+static bool
+st_arb_nir_cache_key(struct gl_program *prog, gl_shader_stage stage,
+                     uint8_t sha1[SHA1_DIGEST_LENGTH])
+{
+   struct mesa_sha1 sha1_ctx;
+   uint8_t stage_byte = stage;
+
+   /* Internally generated programs have no source string to key on */
+   if (!prog->String)
+      return false;
+
+   /* prog_to_nir() has side effects on these programs: position-invariant
+    * and fog lowering append state references to prog->Parameters and bake
+    * the returned indices into the NIR. A cache hit would skip those
+    * additions for the new program object, so don't cache them.
+    */
+   if (prog->arb.IsPositionInvariant || prog->arb.Fog)
+      return false;
+
+   _mesa_sha1_init(&sha1_ctx);
+   _mesa_sha1_update(&sha1_ctx, &stage_byte, 1);
+   _mesa_sha1_update(&sha1_ctx, prog->String,
+                     strlen((const char *)prog->String));
+   _mesa_sha1_final(&sha1_ctx, sha1);
+   return true;
+}
+
 /**
  * Translate ARB (asm) program to NIR
  */
@@ -413,10 +468,47 @@ st_translate_prog_to_nir(struct st_context *st, struct gl_program *prog,
 {
    const struct nir_shader_compiler_options *options =
       st_get_nir_compiler_options(st, prog->info.stage);
+   uint8_t sha1[SHA1_DIGEST_LENGTH];
+   bool cachable = st_arb_nir_cache_key(prog, stage, sha1);
+
+   if (cachable) {
+      if (!st->arb_nir_cache) {
+         st->arb_nir_cache = _mesa_hash_table_create(NULL,
+                                                     st_arb_nir_cache_hash,
+                                                     st_arb_nir_cache_equal);
+      } else {
+         struct hash_entry *entry =
+            _mesa_hash_table_search(st->arb_nir_cache, sha1);
+         if (entry) {
+            struct st_arb_nir_cache_entry *c = entry->data;
+            struct blob_reader reader;
+
+            blob_reader_init(&reader, c->data, c->size);
+            return nir_deserialize(NULL, options, &reader);
+         }
+      }
+   }
 
    /* Translate to NIR */
    nir_shader *nir = prog_to_nir(st->ctx, prog, options);
 
+   if (cachable && nir && st->arb_nir_cache) {
+      struct blob blob;
+
+      blob_init(&blob);
+      nir_serialize(&blob, nir, false);
+      if (!blob.out_of_memory) {
+         struct st_arb_nir_cache_entry *c = malloc(sizeof(*c) + blob.size);
+         if (c) {
+            memcpy(c->sha1, sha1, sizeof(c->sha1));
+            c->size = blob.size;
+            memcpy(c->data, blob.data, blob.size);
+            _mesa_hash_table_insert(st->arb_nir_cache, c->sha1, c);
+         }
+      }
+      blob_finish(&blob);
+   }
+
    return nir;
 }
 
@@ -1344,6 +1436,21 @@ st_precompile_shader_variant(struct st_context *st,
          key.depth_textures = prog->ShadowSamplers;
 
       st_get_fp_variant(st, prog, &key);
+
+      /* If draws on this context have already needed lowered variants, the
+       * first draw with this program will most likely ask for the same
+       * combination, so compile it now rather than hitching mid-frame.
+       */
+      struct st_fp_variant_key spec = key;
+      spec.lower_flatshade = st->fp_features_seen.flatshade;
+      spec.lower_two_sided_color = st->fp_features_seen.two_sided_color;
+      spec.clamp_color |= st->fp_features_seen.clamp_color;
+      spec.persample_shading = st->fp_features_seen.persample_shading;
+      if (st->fp_features_seen.alpha_test)
+         spec.lower_alpha_func = st->fp_features_seen.alpha_func;
+
+      if (memcmp(&spec, &key, sizeof(key)) != 0)
+         st_get_fp_variant(st, prog, &spec);
       break;
    }
 
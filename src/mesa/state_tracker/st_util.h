@@ -107,6 +107,13 @@ st_point_size_per_vertex(struct gl_context *ctx)
    return false;
 }
 
+/* Update derived pipe state before a draw or dispatch.
+ *
+ * There is no per-atom walk here: all dirtiness is packed into the 64-bit
+ * NewDriverState vector (one bit per ST_NEW_* atom, laid out by
+ * st_atom_list.h), so a draw with unchanged state costs a single AND and
+ * branch, and only atoms whose bits are set are dispatched at all.
+ */
 static inline void
 st_validate_state(struct st_context *st, uint64_t pipeline_state_mask)
 {
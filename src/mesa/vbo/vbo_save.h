@@ -59,6 +59,16 @@ struct vbo_save_vertex_list {
    /* Data used in vbo_save_playback_vertex_list */
    unsigned num_draws;
    uint8_t *modes;
+   /* When 'modes' is non-NULL, runs of consecutive draws sharing the same
+    * primitive mode, precomputed at compile time so that replay doesn't
+    * rescan 'modes' on every glCallList().
+    */
+   struct {
+      unsigned first;
+      unsigned count;
+      uint8_t mode;
+   } *mode_ranges;
+   unsigned num_mode_ranges;
    union {
       struct pipe_draw_start_count_bias *start_counts;
       struct pipe_draw_start_count_bias start_count;
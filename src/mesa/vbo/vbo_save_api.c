@@ -916,6 +916,30 @@ compile_vertex_list(struct gl_context *ctx)
       }
    }
 
+   if (node->modes) {
+      /* Bake the runs of consecutive draws sharing a mode now, so replay
+       * issues them directly instead of rescanning the mode array on every
+       * glCallList().
+       */
+      unsigned num_ranges = 1;
+      for (unsigned i = 1; i < node->num_draws; i++) {
+         if (node->modes[i] != node->modes[i - 1])
+            num_ranges++;
+      }
+      node->mode_ranges = malloc(num_ranges * sizeof(*node->mode_ranges));
+      node->num_mode_ranges = 0;
+      for (unsigned i = 0, first = 0; i <= node->num_draws; i++) {
+         if (i == node->num_draws || node->modes[i] != node->modes[first]) {
+            node->mode_ranges[node->num_mode_ranges].first = first;
+            node->mode_ranges[node->num_mode_ranges].count = i - first;
+            node->mode_ranges[node->num_mode_ranges].mode = node->modes[first];
+            node->num_mode_ranges++;
+            first = i;
+         }
+      }
+      assert(node->num_mode_ranges == num_ranges);
+   }
+
    free(indices);
    free(tmp_indices);
    free(merged_prims);
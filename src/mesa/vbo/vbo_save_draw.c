@@ -295,22 +295,22 @@ vbo_save_playback_vertex_list_gallium(struct gl_context *ctx,
       if (!mode) {
          pipe->draw_vertex_state(pipe, state, velem_mask, info, draws, num_draws);
       } else {
-         /* Find consecutive draws where mode doesn't vary. */
-         for (unsigned i = 0, first = 0; i <= num_draws; i++) {
-            if (i == num_draws || mode[i] != mode[first]) {
-               unsigned current_num_draws = i - first;
-
-               /* Increase refcount to be able to use take_vertex_state_ownership
-                * with all draws.
-                */
-               if (i != num_draws && info.take_vertex_state_ownership)
-                  p_atomic_inc(&state->reference.count);
-
-               info.mode = mode[first];
-               pipe->draw_vertex_state(pipe, state, velem_mask, info, &draws[first],
-                                       current_num_draws);
-               first = i;
-            }
+         /* Replay the runs of consecutive same-mode draws precomputed at
+          * compile time.
+          */
+         const unsigned num_ranges = node->num_mode_ranges;
+
+         for (unsigned i = 0; i < num_ranges; i++) {
+            /* Increase refcount to be able to use take_vertex_state_ownership
+             * with all draws.
+             */
+            if (i != num_ranges - 1 && info.take_vertex_state_ownership)
+               p_atomic_inc(&state->reference.count);
+
+            info.mode = node->mode_ranges[i].mode;
+            pipe->draw_vertex_state(pipe, state, velem_mask, info,
+                                    &draws[node->mode_ranges[i].first],
+                                    node->mode_ranges[i].count);
          }
       }
    } else if (node->num_draws) {
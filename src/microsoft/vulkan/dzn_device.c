@@ -35,6 +35,7 @@
 
 #include "util/u_debug.h"
 #include "util/disk_cache.h"
+#include "util/hex.h"
 #include "util/macros.h"
 #include "util/mesa-sha1.h"
 #include "util/u_dl.h"
@@ -216,6 +217,7 @@ dzn_physical_device_destroy(struct vk_physical_device *physical)
       IUnknown_Release(pdev->adapter);
 
    dzn_wsi_finish(pdev);
+   disk_cache_destroy(pdev->vk.disk_cache);
    vk_physical_device_finish(&pdev->vk);
    vk_free(&instance->vk.alloc, pdev);
 }
@@ -1146,6 +1148,16 @@ dzn_physical_device_create(struct vk_instance *instance,
    dzn_physical_device_init_memory(pdev);
    dzn_physical_device_init_uuids(pdev);
 
+   /* With a disk cache set, the common pipeline cache transparently spills
+    * the cached NIR and DXIL blobs to disk, so identical shaders survive
+    * application restarts.  The pipeline cache UUID already hashes the build
+    * ID and the D3D12 caps that affect compilation, so it doubles as the
+    * cache timestamp.
+    */
+   char cache_id[VK_UUID_SIZE * 2 + 1];
+   mesa_bytes_to_hex(cache_id, pdev->pipeline_cache_uuid, VK_UUID_SIZE);
+   pdev->vk.disk_cache = disk_cache_create("dzn", cache_id, 0);
+
    if (dzn_instance->debug_flags & DZN_DEBUG_MULTIVIEW)
       pdev->options3.ViewInstancingTier = D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED;
 
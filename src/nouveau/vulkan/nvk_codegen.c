@@ -163,7 +163,7 @@ nvk_cg_optimize_nir(nir_shader *nir)
        * but a bunch of tessellation shaders blow up.
        * we should revisit this when NAK is merged.
        */
-      NIR_PASS(progress, nir, nir_opt_peephole_select, 2, true, true);
+      NIR_PASS(progress, nir, nir_opt_peephole_select, 2, 2, true, true);
       NIR_PASS(progress, nir, nir_opt_constant_folding);
       NIR_PASS(progress, nir, nir_opt_algebraic);
 
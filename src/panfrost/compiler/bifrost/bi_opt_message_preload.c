@@ -30,6 +30,13 @@
  * 2. +VAR_TEX, register format f32/f16, sample mode (TODO)
  *
  * Analyze the shader for these instructions and push accordingly.
+ *
+ * The hardware issues preloaded messages before the shader starts executing,
+ * so their results land in the register file with no in-shader wait: the
+ * varying fetch latency is hidden behind warp launch rather than stalling the
+ * first ALU clauses. This is a v7 feature of the renderer state descriptor;
+ * Valhall descriptors have no message-preload fields, so on v9+ varying loads
+ * rely on va_insert_flow scoreboarding instead.
  */
 
 static bool
@@ -1143,7 +1143,12 @@ panvk_cmd_draw(struct panvk_cmd_buffer *cmdbuf, struct panvk_draw_info *draw)
                      &draw->jobs.tiler, false);
    }
 
-   /* Clear the dirty flags all at once */
+   /* Clear the dirty flags all at once. The vk_dynamic_graphics_state dirty
+    * bits have all been consumed by the prepare functions at this point;
+    * clearing them is what lets the next draw re-use the RSD/viewport/
+    * attribute descriptors emitted for this one instead of re-packing them.
+    */
+   vk_dynamic_graphics_state_clear_dirty(&cmdbuf->vk.dynamic_graphics_state);
    cmdbuf->state.gfx.dirty = 0;
 }
 
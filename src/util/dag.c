@@ -220,6 +220,147 @@ dag_create(void *mem_ctx)
    return dag;
 }
 
+static void
+critical_path_cb(struct dag_node *node, void *data)
+{
+   uint32_t critical_path = 0;
+
+   util_dynarray_foreach(&node->edges, struct dag_edge, edge) {
+      if (!edge->child)
+         continue;
+      critical_path = MAX2(critical_path,
+                           edge->child->critical_path + 1 +
+                           (uint32_t)edge->data);
+   }
+
+   node->critical_path = critical_path;
+}
+
+/**
+ * Fills in critical_path for every node: the maximum cost along any path
+ * from the node to a leaf, counting one per node plus the edge data as
+ * extra latency. Leaves get 0. Pruning heads doesn't change the critical
+ * path of the remaining nodes, so one computation up front is enough for a
+ * whole scheduling run.
+ */
+void
+dag_compute_critical_path(struct dag *dag)
+{
+   dag_traverse_bottom_up(dag, critical_path_cb, NULL);
+}
+
+void
+dag_heap_init(struct dag_heap *heap)
+{
+   heap->root = NULL;
+}
+
+bool
+dag_heap_is_empty(const struct dag_heap *heap)
+{
+   return heap->root == NULL;
+}
+
+static struct dag_node *
+dag_heap_merge(struct dag_node *a, struct dag_node *b)
+{
+   if (!a)
+      return b;
+   if (!b)
+      return a;
+
+   if (b->critical_path > a->critical_path) {
+      struct dag_node *tmp = a;
+      a = b;
+      b = tmp;
+   }
+
+   b->heap_sibling = a->heap_child;
+   a->heap_child = b;
+   return a;
+}
+
+void
+dag_heap_insert(struct dag_heap *heap, struct dag_node *node)
+{
+   node->heap_child = NULL;
+   node->heap_sibling = NULL;
+   heap->root = dag_heap_merge(heap->root, node);
+}
+
+/**
+ * Removes and returns the node with the highest critical_path, or NULL if
+ * the heap is empty. Uses the standard two-pass pairing of the root's
+ * children, which gives O(log n) amortized pops.
+ */
+struct dag_node *
+dag_heap_pop(struct dag_heap *heap)
+{
+   struct dag_node *root = heap->root;
+   if (!root)
+      return NULL;
+
+   /* First pass: merge the children pairwise, chaining the merged pairs
+    * through their (now unused) sibling links.
+    */
+   struct dag_node *paired = NULL;
+   struct dag_node *node = root->heap_child;
+   while (node) {
+      struct dag_node *a = node;
+      struct dag_node *b = a->heap_sibling;
+      node = b ? b->heap_sibling : NULL;
+
+      a->heap_sibling = NULL;
+      if (b)
+         b->heap_sibling = NULL;
+
+      struct dag_node *merged = dag_heap_merge(a, b);
+      merged->heap_sibling = paired;
+      paired = merged;
+   }
+
+   /* Second pass: merge the pairs into the new root. */
+   struct dag_node *new_root = NULL;
+   while (paired) {
+      struct dag_node *next = paired->heap_sibling;
+      paired->heap_sibling = NULL;
+      new_root = dag_heap_merge(new_root, paired);
+      paired = next;
+   }
+
+   heap->root = new_root;
+   root->heap_child = NULL;
+   return root;
+}
+
+/**
+ * Removes a DAG head like dag_prune_head(), additionally inserting any
+ * children that become ready into the given heap.
+ */
+void
+dag_prune_head_prioritized(struct dag *dag, struct dag_node *node,
+                           struct dag_heap *heap)
+{
+   assert(!node->parent_count);
+
+   list_delinit(&node->link);
+
+   util_dynarray_foreach(&node->edges, struct dag_edge, edge) {
+      if (!edge->child)
+         continue;
+
+      struct dag_node *child = edge->child;
+      child->parent_count--;
+      if (child->parent_count == 0) {
+         list_addtail(&child->link, &dag->heads);
+         dag_heap_insert(heap, child);
+      }
+
+      edge->child = NULL;
+      edge->data = 0;
+   }
+}
+
 struct dag_validate_state {
    struct util_dynarray stack;
    struct set *stack_set;
@@ -24,6 +24,7 @@
 #ifndef DAG_H
 #define DAG_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "util/list.h"
 #include "util/u_dynarray.h"
@@ -44,12 +45,29 @@ struct dag_node {
    /* Array struct edge to the children. */
    struct util_dynarray edges;
    uint32_t parent_count;
+   /* Maximum cost along any path from this node to a leaf, counting one per
+    * node plus the edge data as extra latency. Filled in by
+    * dag_compute_critical_path() and used as the dag_heap priority.
+    */
+   uint32_t critical_path;
+   /* Pairing-heap links, only valid while the node is in a dag_heap. */
+   struct dag_node *heap_child;
+   struct dag_node *heap_sibling;
 };
 
 struct dag {
    struct list_head heads;
 };
 
+/* Max-heap of ready nodes ordered by critical_path, so list schedulers can
+ * pick the most critical ready node in O(log n) instead of rescanning the
+ * heads list. Nodes are inserted as they become ready (see
+ * dag_prune_head_prioritized()) and popped for scheduling.
+ */
+struct dag_heap {
+   struct dag_node *root;
+};
+
 struct dag *dag_create(void *mem_ctx);
 void dag_init_node(struct dag *dag, struct dag_node *node);
 void dag_add_edge(struct dag_node *parent, struct dag_node *child, uintptr_t data);
@@ -60,6 +78,13 @@ void dag_traverse_bottom_up(struct dag *dag, void (*cb)(struct dag_node *node,
 void dag_prune_head(struct dag *dag, struct dag_node *node);
 void dag_validate(struct dag *dag, void (*cb)(const struct dag_node *node,
                                               void *data), void *data);
+void dag_compute_critical_path(struct dag *dag);
+void dag_heap_init(struct dag_heap *heap);
+bool dag_heap_is_empty(const struct dag_heap *heap);
+void dag_heap_insert(struct dag_heap *heap, struct dag_node *node);
+struct dag_node *dag_heap_pop(struct dag_heap *heap);
+void dag_prune_head_prioritized(struct dag *dag, struct dag_node *node,
+                                struct dag_heap *heap);
 
 #ifdef __cplusplus
 }
@@ -92,6 +92,263 @@ disk_cache_init_queue(struct disk_cache *cache)
                           UTIL_QUEUE_INIT_SET_FULL_THREAD_AFFINITY, NULL);
 }
 
+/* In-memory tier in front of the disk cache.
+ *
+ * Repeatedly compiled pipelines (multiple contexts, pipeline variants
+ * sharing stages) hit the same keys over and over, and each disk_cache_get()
+ * pays for open/read/decompress even when the entry was loaded moments ago.
+ * When MESA_SHADER_CACHE_RAM_SIZE is set, recently stored and loaded entries
+ * are also kept in an LRU-managed hash table and served straight from
+ * memory.  The tier is per-process; cross-process sharing still goes through
+ * the mmapped on-disk index as before.
+ */
+
+struct ram_cache_entry {
+   struct list_head lru_link;
+   uint32_t size;
+   cache_key key;
+   /* Entry data follows the struct. */
+};
+
+static uint32_t
+ram_cache_key_hash(const void *key)
+{
+   /* Cache keys are SHA-1 digests, any 4 bytes of them are well mixed. */
+   uint32_t hash;
+   memcpy(&hash, key, sizeof(hash));
+   return hash;
+}
+
+static bool
+ram_cache_key_equal(const void *a, const void *b)
+{
+   return memcmp(a, b, CACHE_KEY_SIZE) == 0;
+}
+
+static void
+disk_cache_ram_tier_init(struct disk_cache *cache)
+{
+   const char *size_str = getenv("MESA_SHADER_CACHE_RAM_SIZE");
+   if (!size_str)
+      return;
+
+   /* Same format as MESA_SHADER_CACHE_MAX_SIZE, but with no suffix meaning
+    * bytes rather than gigabytes.
+    */
+   char *end;
+   uint64_t max_size = strtoul(size_str, &end, 10);
+   if (end == size_str)
+      return;
+   switch (*end) {
+   case 'K':
+   case 'k':
+      max_size *= 1024;
+      break;
+   case 'M':
+   case 'm':
+      max_size *= 1024 * 1024;
+      break;
+   case 'G':
+   case 'g':
+      max_size *= 1024 * 1024 * 1024;
+      break;
+   default:
+      break;
+   }
+   if (!max_size)
+      return;
+
+   cache->ram.table = _mesa_hash_table_create(NULL, ram_cache_key_hash,
+                                              ram_cache_key_equal);
+   if (!cache->ram.table)
+      return;
+
+   list_inithead(&cache->ram.lru);
+   cache->ram.max_size = max_size;
+   simple_mtx_init(&cache->ram.lock, mtx_plain);
+}
+
+static void
+disk_cache_ram_tier_destroy(struct disk_cache *cache)
+{
+   if (!cache->ram.table)
+      return;
+
+   list_for_each_entry_safe(struct ram_cache_entry, entry, &cache->ram.lru,
+                            lru_link)
+      free(entry);
+   _mesa_hash_table_destroy(cache->ram.table, NULL);
+   simple_mtx_destroy(&cache->ram.lock);
+}
+
+static void *
+disk_cache_ram_tier_get(struct disk_cache *cache, const cache_key key,
+                        size_t *size)
+{
+   if (!cache->ram.table)
+      return NULL;
+
+   void *buf = NULL;
+
+   simple_mtx_lock(&cache->ram.lock);
+   struct hash_entry *he = _mesa_hash_table_search(cache->ram.table, key);
+   if (he) {
+      struct ram_cache_entry *entry = he->data;
+
+      buf = malloc(entry->size);
+      if (buf) {
+         memcpy(buf, entry + 1, entry->size);
+         if (size)
+            *size = entry->size;
+         list_move_to(&entry->lru_link, &cache->ram.lru);
+      }
+   }
+   simple_mtx_unlock(&cache->ram.lock);
+
+   return buf;
+}
+
+static void
+disk_cache_ram_tier_put(struct disk_cache *cache, const cache_key key,
+                        const void *data, size_t size)
+{
+   if (!cache->ram.table || size > cache->ram.max_size)
+      return;
+
+   simple_mtx_lock(&cache->ram.lock);
+
+   if (_mesa_hash_table_search(cache->ram.table, key)) {
+      simple_mtx_unlock(&cache->ram.lock);
+      return;
+   }
+
+   struct ram_cache_entry *entry = malloc(sizeof(*entry) + size);
+   if (entry) {
+      memcpy(entry->key, key, CACHE_KEY_SIZE);
+      entry->size = size;
+      memcpy(entry + 1, data, size);
+
+      _mesa_hash_table_insert(cache->ram.table, entry->key, entry);
+      list_add(&entry->lru_link, &cache->ram.lru);
+      cache->ram.size += size;
+
+      while (cache->ram.size > cache->ram.max_size) {
+         struct ram_cache_entry *evict =
+            list_last_entry(&cache->ram.lru, struct ram_cache_entry, lru_link);
+
+         _mesa_hash_table_remove_key(cache->ram.table, evict->key);
+         list_del(&evict->lru_link);
+         cache->ram.size -= evict->size;
+         free(evict);
+      }
+   }
+
+   simple_mtx_unlock(&cache->ram.lock);
+}
+
+static void
+disk_cache_ram_tier_remove(struct disk_cache *cache, const cache_key key)
+{
+   if (!cache->ram.table)
+      return;
+
+   simple_mtx_lock(&cache->ram.lock);
+   struct hash_entry *he = _mesa_hash_table_search(cache->ram.table, key);
+   if (he) {
+      struct ram_cache_entry *entry = he->data;
+
+      _mesa_hash_table_remove(cache->ram.table, he);
+      list_del(&entry->lru_link);
+      cache->ram.size -= entry->size;
+      free(entry);
+   }
+   simple_mtx_unlock(&cache->ram.lock);
+}
+
+static void *
+disk_cache_get_internal(struct disk_cache *cache, const cache_key key,
+                        size_t *size, bool record);
+
+/* Warm-start preload (MESA_SHADER_CACHE_PRELOAD).
+ *
+ * The access-order journal kept next to the index records which entries this
+ * process name loaded from disk first during the previous run.  Replaying it
+ * on the cache queue at create time pulls those entries through the regular
+ * load path (decompression included, so they land in the RAM tier when that
+ * is enabled) before the application compiles its first shaders.
+ */
+
+#define DISK_CACHE_PRELOAD_MAX_ENTRIES 256
+
+struct disk_cache_preload_job {
+   struct util_queue_fence fence;
+   struct disk_cache *cache;
+   uint8_t *keys;
+   uint32_t num_keys;
+};
+
+static void
+cache_preload(void *job, void *gdata, int thread_index)
+{
+   struct disk_cache_preload_job *dc_job = job;
+   struct disk_cache *cache = dc_job->cache;
+   uint32_t preloaded = 0;
+
+   for (uint32_t i = 0; i < dc_job->num_keys &&
+        preloaded < DISK_CACHE_PRELOAD_MAX_ENTRIES; i++) {
+      const uint8_t *key = dc_job->keys + i * CACHE_KEY_SIZE;
+
+      /* Without the RAM tier the same key can appear several times in the
+       * journal; loading it once is enough.
+       */
+      bool seen = false;
+      for (uint32_t j = 0; j < i && !seen; j++)
+         seen = memcmp(key, dc_job->keys + j * CACHE_KEY_SIZE,
+                       CACHE_KEY_SIZE) == 0;
+      if (seen)
+         continue;
+
+      /* record=false: a preloaded entry only belongs in the new journal
+       * once the application actually asks for it.
+       */
+      size_t size;
+      void *buf = disk_cache_get_internal(cache, key, &size, false);
+      free(buf);
+      preloaded++;
+   }
+}
+
+static void
+destroy_preload_job(void *job, void *gdata, int thread_index)
+{
+   struct disk_cache_preload_job *dc_job = job;
+
+   free(dc_job->keys);
+   free(dc_job);
+}
+
+static void
+disk_cache_start_preload(struct disk_cache *cache)
+{
+   uint32_t num_keys;
+   uint8_t *keys = disk_cache_journal_open(cache, &num_keys);
+   if (!keys)
+      return;
+
+   struct disk_cache_preload_job *dc_job = malloc(sizeof(*dc_job));
+   if (!dc_job) {
+      free(keys);
+      return;
+   }
+
+   dc_job->cache = cache;
+   dc_job->keys = keys;
+   dc_job->num_keys = num_keys;
+   util_queue_fence_init(&dc_job->fence);
+   util_queue_add_job(&cache->cache_queue, dc_job, &dc_job->fence,
+                      cache_preload, destroy_preload_job, 0);
+}
+
 static struct disk_cache *
 disk_cache_type_create(const char *gpu_name,
                        const char *driver_id,
@@ -210,9 +467,14 @@ disk_cache_type_create(const char *gpu_name,
    if (cache->type == DISK_CACHE_DATABASE)
       mesa_cache_db_multipart_set_size_limit(&cache->cache_db, cache->max_size);
 
+   disk_cache_ram_tier_init(cache);
+
    if (!disk_cache_init_queue(cache))
       goto fail;
 
+   if (debug_get_bool_option("MESA_SHADER_CACHE_PRELOAD", false))
+      disk_cache_start_preload(cache);
+
    cache->path_init_failed = false;
 
  path_fail:
@@ -327,6 +589,11 @@ disk_cache_destroy(struct disk_cache *cache)
       disk_cache_destroy_mmap(cache);
    }
 
+   if (cache) {
+      disk_cache_journal_close(cache);
+      disk_cache_ram_tier_destroy(cache);
+   }
+
    ralloc_free(cache);
 }
 
@@ -339,6 +606,8 @@ disk_cache_wait_for_idle(struct disk_cache *cache)
 void
 disk_cache_remove(struct disk_cache *cache, const cache_key key)
 {
+   disk_cache_ram_tier_remove(cache, key);
+
    if (cache->type == DISK_CACHE_DATABASE) {
       mesa_cache_db_multipart_entry_remove(&cache->cache_db, key);
       return;
@@ -549,6 +818,8 @@ disk_cache_put(struct disk_cache *cache, const cache_key key,
    if (!util_queue_is_initialized(&cache->cache_queue))
       return;
 
+   disk_cache_ram_tier_put(cache, key, data, size);
+
    struct disk_cache_put_job *dc_job =
       create_put_job(cache, key, (void*)data, size, cache_item_metadata, false);
 
@@ -569,6 +840,8 @@ disk_cache_put_nocopy(struct disk_cache *cache, const cache_key key,
       return;
    }
 
+   disk_cache_ram_tier_put(cache, key, data, size);
+
    struct disk_cache_put_job *dc_job =
       create_put_job(cache, key, data, size, cache_item_metadata, true);
 
@@ -579,15 +852,19 @@ disk_cache_put_nocopy(struct disk_cache *cache, const cache_key key,
    }
 }
 
-void *
-disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
+static void *
+disk_cache_get_internal(struct disk_cache *cache, const cache_key key,
+                        size_t *size, bool record)
 {
    void *buf = NULL;
 
    if (size)
       *size = 0;
 
-   if (cache->foz_ro_cache)
+   buf = disk_cache_ram_tier_get(cache, key, size);
+   bool ram_hit = buf != NULL;
+
+   if (!buf && cache->foz_ro_cache)
       buf = disk_cache_load_item_foz(cache->foz_ro_cache, key, size);
 
    if (!buf) {
@@ -604,6 +881,16 @@ disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
       }
    }
 
+   /* Keep disk hits resident for the next lookup. */
+   if (buf && !ram_hit && size)
+      disk_cache_ram_tier_put(cache, key, buf, *size);
+
+   /* RAM hits aren't journaled: within one run an entry only loads from
+    * disk the first time, which is exactly the ordering the journal wants.
+    */
+   if (buf && !ram_hit && record)
+      disk_cache_journal_append(cache, key);
+
    if (unlikely(cache->stats.enabled)) {
       if (buf)
          p_atomic_inc(&cache->stats.hits);
@@ -614,6 +901,31 @@ disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
    return buf;
 }
 
+void *
+disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
+{
+   return disk_cache_get_internal(cache, key, size, true);
+}
+
+void
+disk_cache_foreach_key(struct disk_cache *cache,
+                       void (*fn)(const cache_key key, void *data),
+                       void *data)
+{
+   if (cache->foz_ro_cache)
+      disk_cache_foreach_key(cache->foz_ro_cache, fn, data);
+
+   if (cache->type != DISK_CACHE_SINGLE_FILE || !cache->foz_db.alive)
+      return;
+
+   simple_mtx_lock(&cache->foz_db.mtx);
+   hash_table_u64_foreach(cache->foz_db.index_db, he) {
+      const struct foz_db_entry *entry = he.data;
+      fn(entry->key, data);
+   }
+   simple_mtx_unlock(&cache->foz_db.mtx);
+}
+
 void
 disk_cache_put_key(struct disk_cache *cache, const cache_key key)
 {
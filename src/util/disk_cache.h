@@ -229,6 +229,20 @@ disk_cache_put_nocopy(struct disk_cache *cache, const cache_key key,
 void *
 disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size);
 
+/**
+ * Invoke \fn for the key of every entry currently present in the cache
+ * index.
+ *
+ * Only the single-file (fossilize) cache keeps an in-memory index of its
+ * entries, so other cache types invoke the callback zero times.  The index
+ * lock is held across the iteration, so the callback must not call back
+ * into the cache; collect the keys and process them afterwards instead.
+ */
+void
+disk_cache_foreach_key(struct disk_cache *cache,
+                       void (*fn)(const cache_key key, void *data),
+                       void *data);
+
 /**
  * Store the name \key within the cache, (without any associated data).
  *
@@ -304,6 +318,13 @@ disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
    return NULL;
 }
 
+static inline void
+disk_cache_foreach_key(struct disk_cache *cache,
+                       void (*fn)(const cache_key key, void *data),
+                       void *data)
+{
+}
+
 static inline void
 disk_cache_put_key(struct disk_cache *cache, const cache_key key)
 {
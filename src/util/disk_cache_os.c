@@ -101,6 +101,7 @@ disk_cache_get_function_identifier(void *ptr, struct mesa_sha1 *ctx)
 #include "util/blob.h"
 #include "util/crc32.h"
 #include "util/u_debug.h"
+#include "util/u_process.h"
 #include "util/ralloc.h"
 #include "util/rand_xor.h"
 
@@ -208,6 +209,7 @@ struct lru_file {
    char *lru_name;
    size_t lru_file_size;
    time_t lru_atime;
+   uint64_t lru_weight;
 };
 
 static void
@@ -221,9 +223,12 @@ free_lru_file_list(struct list_head *lru_file_list)
    free(lru_file_list);
 }
 
-/* Given a directory path and predicate function, create a linked list of entrys
- * with the oldest access time in that directory for which the predicate
- * returns true.
+/* Given a directory path and predicate function, create a linked list of the
+ * entries in that directory with the highest eviction weight for which the
+ * predicate returns true. The weight is the entry's cost in byte-seconds -
+ * the time since last use multiplied by the on-disk size - so a large cold
+ * entry is chosen before a small one that is just as cold, and a recently
+ * used entry survives regardless of its size.
  *
  * Returns: A malloc'ed linkd list for the paths of chosen files, (or
  * NULL on any error). The caller should free the linked list via
@@ -272,62 +277,67 @@ choose_lru_file_matching(const char *dir_path,
    struct list_head *lru_file_list = malloc(sizeof(struct list_head));
    list_inithead(lru_file_list);
 
-   unsigned processed_files = 0;
+   const time_t now = time(NULL);
+   unsigned kept_files = 0;
    while (1) {
       dir_ent = readdir(dir);
       if (dir_ent == NULL)
          break;
 
       struct stat sb;
-      if (fstatat(dir_fd, dir_ent->d_name, &sb, 0) == 0) {
-         struct lru_file *entry = NULL;
-         if (!list_is_empty(lru_file_list))
-            entry = list_first_entry(lru_file_list, struct lru_file, node);
-
-         if (!entry|| sb.st_atime < entry->lru_atime) {
-            size_t len = strlen(dir_ent->d_name);
-            if (!predicate(dir_path, &sb, dir_ent->d_name, len))
-               continue;
-
-            bool new_entry = false;
-            if (processed_files < lru_file_count) {
-               entry = calloc(1, sizeof(struct lru_file));
-               new_entry = true;
-            }
-            processed_files++;
-
-            char *tmp = realloc(entry->lru_name, len + 1);
-            if (tmp) {
-               /* Find location to insert new lru item. We want to keep the
-                * list ordering from most recently used to least recently used.
-                * This allows us to just evict the head item from the list as
-                * we process the directory and find older entrys.
-                */
-               struct list_head *list_node = lru_file_list;
-               struct lru_file *e;
-               LIST_FOR_EACH_ENTRY(e, lru_file_list, node) {
-                  if (sb.st_atime < entry->lru_atime) {
-                     list_node = &e->node;
-                     break;
-                  }
-               }
-
-               if (new_entry) {
-                  list_addtail(&entry->node, list_node);
-               } else {
-                  if (list_node != lru_file_list) {
-                     list_del(lru_file_list);
-                     list_addtail(lru_file_list, list_node);
-                  }
-               }
-
-               entry->lru_name = tmp;
-               memcpy(entry->lru_name, dir_ent->d_name, len + 1);
-               entry->lru_atime = sb.st_atime;
-               entry->lru_file_size = sb.st_blocks * 512;
-            }
+      if (fstatat(dir_fd, dir_ent->d_name, &sb, 0) != 0)
+         continue;
+
+      size_t len = strlen(dir_ent->d_name);
+      if (!predicate(dir_path, &sb, dir_ent->d_name, len))
+         continue;
+
+      size_t file_size = sb.st_blocks * 512;
+      time_t age = now > sb.st_atime ? now - sb.st_atime : 0;
+      uint64_t weight = ((uint64_t)age + 1) *
+                        (file_size ? (uint64_t)file_size : 1);
+
+      struct lru_file *entry;
+      if (kept_files < lru_file_count) {
+         entry = calloc(1, sizeof(struct lru_file));
+         if (entry == NULL)
+            continue;
+         kept_files++;
+      } else {
+         /* The list is kept ordered by descending weight, so the tail is
+          * the least evictable kept entry. Replace it if this file weighs
+          * more.
+          */
+         entry = list_last_entry(lru_file_list, struct lru_file, node);
+         if (weight <= entry->lru_weight)
+            continue;
+         list_del(&entry->node);
+      }
+
+      char *tmp = realloc(entry->lru_name, len + 1);
+      if (tmp == NULL) {
+         free(entry->lru_name);
+         free(entry);
+         kept_files--;
+         continue;
+      }
+
+      memcpy(tmp, dir_ent->d_name, len + 1);
+      entry->lru_name = tmp;
+      entry->lru_atime = sb.st_atime;
+      entry->lru_file_size = file_size;
+      entry->lru_weight = weight;
+
+      /* Insert while keeping the list ordered by descending weight. */
+      struct list_head *list_node = lru_file_list;
+      struct lru_file *e;
+      LIST_FOR_EACH_ENTRY(e, lru_file_list, node) {
+         if (weight > e->lru_weight) {
+            list_node = &e->node;
+            break;
          }
       }
+      list_addtail(&entry->node, list_node);
    }
 
    if (list_is_empty(lru_file_list)) {
@@ -1083,6 +1093,96 @@ disk_cache_touch_cache_user_marker(char *path)
    free(marker_path);
 }
 
+/* Opens the per-process-name access-order journal next to the cache index,
+ * returning the keys recorded by the previous run (malloc'ed, CACHE_KEY_SIZE
+ * each, count in *num_keys) and truncating the file so this run records a
+ * fresh ordering through disk_cache_journal_append().
+ */
+uint8_t *
+disk_cache_journal_open(struct disk_cache *cache, uint32_t *num_keys)
+{
+   *num_keys = 0;
+
+   const char *proc = util_get_process_name();
+   if (!proc || !proc[0])
+      return NULL;
+
+   if (asprintf(&cache->journal.path, "%s/%s.journal",
+                cache->path, proc) == -1) {
+      cache->journal.path = NULL;
+      return NULL;
+   }
+
+   cache->journal.fd = open(cache->journal.path,
+                            O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+   if (cache->journal.fd == -1)
+      goto fail;
+
+   struct stat sb;
+   uint8_t *keys = NULL;
+   if (fstat(cache->journal.fd, &sb) == 0 &&
+       sb.st_size >= CACHE_KEY_SIZE) {
+      size_t size = MIN2((size_t)sb.st_size,
+                         (size_t)DISK_CACHE_JOURNAL_MAX_ENTRIES *
+                         CACHE_KEY_SIZE);
+      keys = malloc(size);
+      if (keys) {
+         ssize_t ret = read_all(cache->journal.fd, keys, size);
+         if (ret < CACHE_KEY_SIZE) {
+            free(keys);
+            keys = NULL;
+         } else {
+            *num_keys = ret / CACHE_KEY_SIZE;
+         }
+      }
+   }
+
+   /* A stale ordering must not outlive the run that produced it, so mixing
+    * old and new entries on a truncate failure would be worse than not
+    * journaling at all.
+    */
+   if (ftruncate(cache->journal.fd, 0) == -1 ||
+       lseek(cache->journal.fd, 0, SEEK_SET) == -1) {
+      close(cache->journal.fd);
+      free(keys);
+      *num_keys = 0;
+      goto fail;
+   }
+
+   simple_mtx_init(&cache->journal.lock, mtx_plain);
+   return keys;
+
+ fail:
+   free(cache->journal.path);
+   cache->journal.path = NULL;
+   return NULL;
+}
+
+void
+disk_cache_journal_append(struct disk_cache *cache, const cache_key key)
+{
+   if (!cache->journal.path)
+      return;
+
+   simple_mtx_lock(&cache->journal.lock);
+   if (cache->journal.num_entries < DISK_CACHE_JOURNAL_MAX_ENTRIES &&
+       write_all(cache->journal.fd, key, CACHE_KEY_SIZE) == CACHE_KEY_SIZE)
+      cache->journal.num_entries++;
+   simple_mtx_unlock(&cache->journal.lock);
+}
+
+void
+disk_cache_journal_close(struct disk_cache *cache)
+{
+   if (!cache->journal.path)
+      return;
+
+   close(cache->journal.fd);
+   simple_mtx_destroy(&cache->journal.lock);
+   free(cache->journal.path);
+   cache->journal.path = NULL;
+}
+
 bool
 disk_cache_mmap_cache_index(void *mem_ctx, struct disk_cache *cache,
                             char *path)
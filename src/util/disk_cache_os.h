@@ -24,6 +24,9 @@
 #ifndef DISK_CACHE_OS_H
 #define DISK_CACHE_OS_H
 
+#include "util/hash_table.h"
+#include "util/list.h"
+#include "util/simple_mtx.h"
 #include "util/u_queue.h"
 
 #if DETECT_OS_WINDOWS
@@ -102,6 +105,31 @@ struct disk_cache {
       unsigned misses;
    } stats;
 
+   /* Optional in-memory tier in front of the disk (MESA_SHADER_CACHE_RAM_SIZE).
+    * Keeps recently stored/loaded entries resident so repeat lookups skip
+    * decompression and disk I/O entirely.
+    */
+   struct {
+      struct hash_table *table;
+      struct list_head lru;
+      uint64_t size;
+      uint64_t max_size;
+      simple_mtx_t lock;
+   } ram;
+
+   /* Access-order journal for warm starts (MESA_SHADER_CACHE_PRELOAD).
+    * Records, per process name, the order in which entries were loaded from
+    * disk during this run; the previous run's journal is replayed on the
+    * cache queue at create time so the first entries the application asked
+    * for last time are resident before it asks again.
+    */
+   struct {
+      char *path;
+      int fd;
+      uint32_t num_entries;
+      simple_mtx_t lock;
+   } journal;
+
    /* Internal RO FOZ cache for combined use of RO and RW caches. */
    struct disk_cache *foz_ro_cache;
 };
@@ -164,6 +192,20 @@ disk_cache_load_cache_index_foz(void *mem_ctx, struct disk_cache *cache);
 void
 disk_cache_touch_cache_user_marker(char *path);
 
+/* Upper bound on journal growth per run; entries past this are not recorded
+ * since a journal that long no longer describes "startup".
+ */
+#define DISK_CACHE_JOURNAL_MAX_ENTRIES 2048
+
+uint8_t *
+disk_cache_journal_open(struct disk_cache *cache, uint32_t *num_keys);
+
+void
+disk_cache_journal_append(struct disk_cache *cache, const cache_key key);
+
+void
+disk_cache_journal_close(struct disk_cache *cache);
+
 bool
 disk_cache_mmap_cache_index(void *mem_ctx, struct disk_cache *cache,
                             char *path);
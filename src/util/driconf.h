@@ -235,10 +235,18 @@
    DRI_CONF_OPT_B(allow_draw_out_of_order, def, \
                   "Allow out-of-order draw optimizations. Set when Z fighting doesn't have to be accurate.")
 
+#define DRI_CONF_ALLOW_DEFERRED_READPIXELS(def) \
+   DRI_CONF_OPT_B(allow_deferred_readpixels, def, \
+                  "Let non-PBO glReadPixels return data that is up to two reads old instead of stalling")
+
 #define DRI_CONF_GLTHREAD_NOP_CHECK_FRAMEBUFFER_STATUS(def) \
    DRI_CONF_OPT_B(glthread_nop_check_framebuffer_status, def, \
                   "glthread always returns GL_FRAMEBUFFER_COMPLETE to prevent synchronization.")
 
+#define DRI_CONF_GLTHREAD_ASYNC_GET_ERROR(def) \
+   DRI_CONF_OPT_B(glthread_async_get_error, def, \
+                  "glthread returns errors from an asynchronously updated shadow to prevent synchronization. Errors from queued commands may be reported late.")
+
 #define DRI_CONF_FORCE_GL_VENDOR() \
    DRI_CONF_OPT_S_NODEF(force_gl_vendor, "Override GPU vendor string.")
 
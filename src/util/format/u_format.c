@@ -1229,6 +1229,15 @@ util_format_unpack_table_init(void)
       }
 #endif
 
+#if (DETECT_ARCH_X86 || DETECT_ARCH_X86_64) && defined(__GNUC__) && !defined(NO_FORMAT_ASM)
+      const struct util_format_unpack_description *unpack_ssse3 =
+         util_format_unpack_description_ssse3(format);
+      if (unpack_ssse3) {
+         util_format_unpack_table[format] = unpack_ssse3;
+         continue;
+      }
+#endif
+
       util_format_unpack_table[format] = util_format_unpack_description_generic(format);
    }
 }
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2026 Mesa3D contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "util/detect_arch.h"
+#include "util/format/u_format.h"
+
+#if (DETECT_ARCH_X86 || DETECT_ARCH_X86_64) && defined(__GNUC__) && !defined(NO_FORMAT_ASM)
+
+/* The rest of the file is compiled for SSSE3 regardless of the baseline;
+ * util_format_unpack_description_ssse3() checks CPU caps before handing any
+ * of it out.
+ */
+#pragma GCC push_options
+#pragma GCC target ("ssse3")
+
+#include <tmmintrin.h>
+#include "u_format_pack.h"
+#include "util/u_cpu_detect.h"
+
+static void
+util_format_b8g8r8a8_unorm_unpack_rgba_8unorm_ssse3(uint8_t *restrict dst, const uint8_t *restrict src, unsigned width)
+{
+   const __m128i swizzle =
+      _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+   while (width >= 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i *)src);
+      _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(pixels, swizzle));
+      width -= 4;
+      dst += 4 * 4;
+      src += 4 * 4;
+   }
+   if (width)
+      util_format_b8g8r8a8_unorm_unpack_rgba_8unorm(dst, src, width);
+}
+
+static const struct util_format_unpack_description util_format_unpack_descriptions_ssse3[] = {
+   [PIPE_FORMAT_B8G8R8A8_UNORM] = {
+      .unpack_rgba_8unorm = &util_format_b8g8r8a8_unorm_unpack_rgba_8unorm_ssse3,
+      .unpack_rgba = &util_format_b8g8r8a8_unorm_unpack_rgba_float,
+   },
+};
+
+const struct util_format_unpack_description *
+util_format_unpack_description_ssse3(enum pipe_format format)
+{
+   if (!util_get_cpu_caps()->has_ssse3)
+      return NULL;
+
+   if (format >= ARRAY_SIZE(util_format_unpack_descriptions_ssse3))
+      return NULL;
+
+   if (!util_format_unpack_descriptions_ssse3[format].unpack_rgba)
+      return NULL;
+
+   return &util_format_unpack_descriptions_ssse3[format];
+}
+
+#pragma GCC pop_options
+
+#endif /* DETECT_ARCH_X86 | DETECT_ARCH_X86_64 */
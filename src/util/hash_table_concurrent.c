@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 Mesa3D contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hash_table_concurrent.h"
+#include "macros.h"
+#include "u_atomic.h"
+
+/*
+ * Open-addressed table with linear probing.  The key slot doubles as the
+ * publication point: writers fill in hash and data first and then store the
+ * key with a release store, so a reader that observes the key (acquire load)
+ * also observes a consistent hash and data.  Removed slots get a tombstone
+ * key so probe chains stay intact for concurrent readers.
+ *
+ * Resizing builds a fully-populated new payload and publishes it with a
+ * single pointer store.  The old payload is pushed on a retired list instead
+ * of being freed, since readers that loaded the old pointer may still be
+ * probing it; everything is freed in _mesa_concurrent_hash_table_fini().
+ */
+
+#define INITIAL_SIZE 32
+
+static char deleted_slot;
+#define DELETED_KEY ((void *)&deleted_slot)
+
+struct concurrent_hash_entry {
+   uint32_t hash;
+   void *key;
+   void *data;
+};
+
+struct concurrent_hash_payload {
+   struct concurrent_hash_payload *retired_next;
+   uint32_t size; /* power of two */
+   struct concurrent_hash_entry entries[];
+};
+
+static struct concurrent_hash_payload *
+payload_create(uint32_t size)
+{
+   struct concurrent_hash_payload *p =
+      calloc(1, sizeof(*p) + size * sizeof(struct concurrent_hash_entry));
+   if (p)
+      p->size = size;
+   return p;
+}
+
+bool
+_mesa_concurrent_hash_table_init(struct concurrent_hash_table *ht,
+                                 uint32_t (*key_hash_function)(const void *key),
+                                 bool (*key_equals_function)(const void *a,
+                                                             const void *b))
+{
+   ht->payload = payload_create(INITIAL_SIZE);
+   if (!ht->payload)
+      return false;
+
+   ht->retired = NULL;
+   ht->entries = 0;
+   ht->deleted_entries = 0;
+   ht->key_hash_function = key_hash_function;
+   ht->key_equals_function = key_equals_function;
+   simple_mtx_init(&ht->mutex, mtx_plain);
+   return true;
+}
+
+void
+_mesa_concurrent_hash_table_fini(struct concurrent_hash_table *ht)
+{
+   free(ht->payload);
+   for (struct concurrent_hash_payload *p = ht->retired; p;) {
+      struct concurrent_hash_payload *next = p->retired_next;
+      free(p);
+      p = next;
+   }
+   simple_mtx_destroy(&ht->mutex);
+}
+
+void *
+_mesa_concurrent_hash_table_search(struct concurrent_hash_table *ht,
+                                   const void *key)
+{
+   assert(key != NULL && key != DELETED_KEY);
+
+   uint32_t hash = ht->key_hash_function(key);
+   struct concurrent_hash_payload *p = p_atomic_read(&ht->payload);
+   uint32_t mask = p->size - 1;
+
+   for (uint32_t i = hash & mask, dist = 0; dist <= mask;
+        i = (i + 1) & mask, dist++) {
+      void *k = p_atomic_read(&p->entries[i].key);
+      if (k == NULL)
+         return NULL;
+      if (k == DELETED_KEY)
+         continue;
+      if (p->entries[i].hash == hash && ht->key_equals_function(key, k))
+         return p_atomic_read(&p->entries[i].data);
+   }
+
+   return NULL;
+}
+
+/* Insert into a payload no reader can see yet, so plain stores are fine. */
+static void
+payload_insert_unpublished(struct concurrent_hash_payload *p, uint32_t hash,
+                           void *key, void *data)
+{
+   uint32_t mask = p->size - 1;
+   for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+      if (p->entries[i].key == NULL) {
+         p->entries[i].hash = hash;
+         p->entries[i].key = key;
+         p->entries[i].data = data;
+         return;
+      }
+   }
+}
+
+static bool
+rehash(struct concurrent_hash_table *ht)
+{
+   struct concurrent_hash_payload *old = ht->payload;
+
+   /* Grow when the table is actually filling up; resizing to the same size
+    * just purges tombstones.
+    */
+   uint32_t new_size = ht->entries >= old->size / 2 ? old->size * 2 : old->size;
+   struct concurrent_hash_payload *p = payload_create(new_size);
+   if (!p)
+      return false;
+
+   for (uint32_t i = 0; i < old->size; i++) {
+      void *k = old->entries[i].key;
+      if (k != NULL && k != DELETED_KEY) {
+         payload_insert_unpublished(p, old->entries[i].hash, k,
+                                    old->entries[i].data);
+      }
+   }
+
+   p_atomic_set(&ht->payload, p);
+   old->retired_next = ht->retired;
+   ht->retired = old;
+   ht->deleted_entries = 0;
+   return true;
+}
+
+bool
+_mesa_concurrent_hash_table_insert(struct concurrent_hash_table *ht,
+                                   const void *key, void *data)
+{
+   assert(key != NULL && key != DELETED_KEY);
+
+   uint32_t hash = ht->key_hash_function(key);
+
+   simple_mtx_lock(&ht->mutex);
+
+   /* Keep the load factor (including tombstones) below 3/4 so probe chains
+    * stay short and insertion below always finds a slot.
+    */
+   if ((uint64_t)(ht->entries + ht->deleted_entries + 1) * 4 >=
+       (uint64_t)ht->payload->size * 3) {
+      if (!rehash(ht)) {
+         simple_mtx_unlock(&ht->mutex);
+         return false;
+      }
+   }
+
+   struct concurrent_hash_payload *p = ht->payload;
+   uint32_t mask = p->size - 1;
+   struct concurrent_hash_entry *tombstone = NULL;
+
+   for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+      struct concurrent_hash_entry *e = &p->entries[i];
+
+      if (e->key == NULL) {
+         if (tombstone) {
+            e = tombstone;
+            ht->deleted_entries--;
+         }
+         e->hash = hash;
+         e->data = data;
+         /* Publication point: readers that see the key also see hash/data. */
+         p_atomic_set(&e->key, (void *)key);
+         ht->entries++;
+         break;
+      }
+
+      if (e->key == DELETED_KEY) {
+         if (!tombstone)
+            tombstone = e;
+         continue;
+      }
+
+      if (e->hash == hash && ht->key_equals_function(key, e->key)) {
+         p_atomic_set(&e->data, data);
+         break;
+      }
+   }
+
+   simple_mtx_unlock(&ht->mutex);
+   return true;
+}
+
+void *
+_mesa_concurrent_hash_table_remove(struct concurrent_hash_table *ht,
+                                   const void *key)
+{
+   assert(key != NULL && key != DELETED_KEY);
+
+   uint32_t hash = ht->key_hash_function(key);
+   void *data = NULL;
+
+   simple_mtx_lock(&ht->mutex);
+
+   struct concurrent_hash_payload *p = ht->payload;
+   uint32_t mask = p->size - 1;
+
+   for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+      struct concurrent_hash_entry *e = &p->entries[i];
+
+      if (e->key == NULL)
+         break;
+
+      if (e->key != DELETED_KEY &&
+          e->hash == hash && ht->key_equals_function(key, e->key)) {
+         data = e->data;
+         /* Leave hash and data in place: a reader that already matched this
+          * slot may still load them.
+          */
+         p_atomic_set(&e->key, DELETED_KEY);
+         ht->entries--;
+         ht->deleted_entries++;
+         break;
+      }
+   }
+
+   simple_mtx_unlock(&ht->mutex);
+   return data;
+}
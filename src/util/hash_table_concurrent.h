@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 Mesa3D contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef HASH_TABLE_CONCURRENT_H
+#define HASH_TABLE_CONCURRENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "simple_mtx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A pointer-keyed hash table with a lock-free read path.
+ *
+ * Lookups never take the mutex and may run concurrently with inserts and
+ * removes from other threads; writers serialize against each other on an
+ * internal mutex.  This is meant for read-mostly shared caches (in-memory
+ * shader caches, variant maps) where per-lookup locking shows up in
+ * profiles.
+ *
+ * Semantics under concurrency: a search racing with an insert of the same
+ * key may or may not see it; a search racing with a remove may still return
+ * the removed data pointer.  Callers own the lifetime of keys and data and
+ * must not free them while another thread could still look them up.
+ *
+ * Old bucket arrays are kept until _mesa_concurrent_hash_table_fini() so
+ * that readers can keep probing a table that has since been resized; with
+ * power-of-two growth this retires at most the size of the current array
+ * again.
+ */
+
+struct concurrent_hash_payload;
+
+struct concurrent_hash_table {
+   struct concurrent_hash_payload *payload;
+   struct concurrent_hash_payload *retired;
+   uint32_t entries;
+   uint32_t deleted_entries;
+   uint32_t (*key_hash_function)(const void *key);
+   bool (*key_equals_function)(const void *a, const void *b);
+   simple_mtx_t mutex;
+};
+
+bool _mesa_concurrent_hash_table_init(struct concurrent_hash_table *ht,
+                                      uint32_t (*key_hash_function)(const void *key),
+                                      bool (*key_equals_function)(const void *a,
+                                                                  const void *b));
+void _mesa_concurrent_hash_table_fini(struct concurrent_hash_table *ht);
+
+/** Lock-free lookup, safe to call concurrently with inserts and removes. */
+void *_mesa_concurrent_hash_table_search(struct concurrent_hash_table *ht,
+                                         const void *key);
+
+/** Insert key/data, replacing data if the key already exists. */
+bool _mesa_concurrent_hash_table_insert(struct concurrent_hash_table *ht,
+                                        const void *key, void *data);
+
+/** Remove a key, returning its data or NULL if it wasn't present. */
+void *_mesa_concurrent_hash_table_remove(struct concurrent_hash_table *ht,
+                                         const void *key);
+
+#ifdef __cplusplus
+} /* extern C */
+#endif
+
+#endif /* HASH_TABLE_CONCURRENT_H */
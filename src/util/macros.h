@@ -135,6 +135,17 @@ do {                        \
 #define unreachable(str) assert(!"" str)
 #endif
 
+/**
+ * Prefetch macro. Hints that an address is about to be read so the load can
+ * start before execution reaches it. Expands to nothing when the compiler
+ * has no prefetch builtin; never faults on invalid addresses.
+ */
+#if defined(HAVE___BUILTIN_PREFETCH) || __has_builtin(__builtin_prefetch)
+#define util_prefetch_read(addr) __builtin_prefetch((addr), 0 /* read */, 1)
+#else
+#define util_prefetch_read(addr) ((void)(addr))
+#endif
+
 /**
  * Assume macro. Useful for expressing our assumptions to the compiler,
  * typically for purposes of silencing warnings.
@@ -172,6 +183,17 @@ do {                       \
 #define FLATTEN
 #endif
 
+/* Attribute hot is used for functions that are on the critical path of
+ * the most common workloads. The compiler optimizes them more aggressively
+ * and the linker groups them in the hot text section, which keeps them
+ * together in the instruction cache.
+ */
+#ifdef HAVE_FUNC_ATTRIBUTE_HOT
+#define ATTRIBUTE_HOT __attribute__((__hot__))
+#else
+#define ATTRIBUTE_HOT
+#endif
+
 #ifdef HAVE_FUNC_ATTRIBUTE_FORMAT
 #if defined (__MINGW_PRINTF_FORMAT)
 # define PRINTFLIKE(f, a) __attribute__ ((format(__MINGW_PRINTF_FORMAT, f, a)))
@@ -43,6 +43,15 @@ void _mesa_blake3_compute(const void *data, size_t size, blake3_hash result)
   _mesa_blake3_final(&ctx, result);
 }
 
+void _mesa_blake3_compute_128(const void *data, size_t size,
+                              blake3_128_hash result)
+{
+  struct mesa_blake3 ctx;
+  _mesa_blake3_init(&ctx);
+  _mesa_blake3_update(&ctx, data, size);
+  _mesa_blake3_final_128(&ctx, result);
+}
+
 static void
 blake3_to_uint32(const blake3_hash blake3,
                  uint32_t out[BLAKE3_OUT_LEN32])
@@ -38,6 +38,18 @@ extern "C" {
 
 typedef uint8_t blake3_hash[BLAKE3_OUT_LEN];
 
+/* Truncated 128-bit variant for in-memory cache keys.
+ *
+ * Any prefix of the BLAKE3 output is itself a valid hash, so a 16-byte key
+ * keeps the full collision resistance a 128-bit hash can offer while
+ * halving key storage and comparison cost in hash tables.  Keys that leave
+ * the process (disk caches, serialized formats) should keep using the full
+ * blake3_hash.
+ */
+#define BLAKE3_128_OUT_LEN (BLAKE3_OUT_LEN / 2)
+
+typedef uint8_t blake3_128_hash[BLAKE3_128_OUT_LEN];
+
 static inline void
 _mesa_blake3_init(struct mesa_blake3 *ctx)
 {
@@ -56,6 +68,12 @@ _mesa_blake3_final(struct mesa_blake3 *ctx, blake3_hash result)
    blake3_hasher_finalize(ctx, result, BLAKE3_OUT_LEN);
 }
 
+static inline void
+_mesa_blake3_final_128(struct mesa_blake3 *ctx, blake3_128_hash result)
+{
+   blake3_hasher_finalize(ctx, result, BLAKE3_128_OUT_LEN);
+}
+
 void
 _mesa_blake3_format(char *buf, const unsigned char *blake3);
 
@@ -65,6 +83,10 @@ _mesa_blake3_hex_to_blake3(unsigned char *buf, const char *hex);
 void
 _mesa_blake3_compute(const void *data, size_t size, blake3_hash result);
 
+void
+_mesa_blake3_compute_128(const void *data, size_t size,
+                         blake3_128_hash result);
+
 void
 _mesa_blake3_print(FILE *f, const blake3_hash blake3);
 
@@ -0,0 +1,417 @@
+/*
+ * Copyright 2026 Mesa3D contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Contended micro-benchmarks for the src/util data structures that sit on
+ * driver fast paths: util_queue job dispatch, hash table lookup/insert mixes,
+ * ralloc churn, u_dynarray growth and the fossilize single-file shader cache
+ * backend.  Results are printed as JSON on stdout
+ * (or to the file given as argv[1]) so perf CI can diff them across releases.
+ *
+ * Run with "meson test --benchmark -C build" or directly:
+ *
+ *    util_benchmark [output.json]
+ *
+ * UTIL_BENCH_THREADS overrides the worker thread count (default 4).
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "c11/threads.h"
+#include "util/fossilize_db.h"
+#include "util/hash_table.h"
+#include "util/hash_table_concurrent.h"
+#include "util/os_time.h"
+#include "util/ralloc.h"
+#include "util/u_atomic.h"
+#include "util/u_dynarray.h"
+#include "util/u_queue.h"
+
+#define DEFAULT_THREADS 4
+#define MAX_THREADS     64
+
+struct bench_result {
+   const char *name;
+   unsigned threads;
+   uint64_t iterations;   /* total operations across all threads */
+   uint64_t time_ns;      /* wall time for the whole benchmark */
+   uint64_t latency_ns;   /* mean per-op latency, 0 if not measured */
+};
+
+static unsigned num_threads;
+static struct bench_result results[16];
+static unsigned num_results;
+
+static void
+report(const char *name, unsigned threads, uint64_t iterations,
+       uint64_t time_ns, uint64_t latency_ns)
+{
+   struct bench_result *r = &results[num_results++];
+   r->name = name;
+   r->threads = threads;
+   r->iterations = iterations;
+   r->time_ns = time_ns;
+   r->latency_ns = latency_ns;
+}
+
+/* A deterministic PRNG so every run (and every thread) does the same work. */
+static inline uint32_t
+bench_rand(uint32_t *state)
+{
+   *state = *state * 1103515245 + 12345;
+   return *state >> 16;
+}
+
+/* util_queue: dispatch latency and throughput.
+ *
+ * Each job records the time it started executing; the producer records the
+ * time it was added.  The mean difference is the queue's dispatch latency
+ * under a steady stream of small jobs, which is what drivers see for shader
+ * compile and tiling jobs.
+ */
+
+#define QUEUE_JOBS 20000
+
+struct queue_job {
+   int64_t submit_ns;
+   int64_t start_ns;
+};
+
+static void
+queue_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct queue_job *job = data;
+   job->start_ns = os_time_get_nano();
+}
+
+static void
+bench_util_queue(void)
+{
+   struct util_queue queue;
+   struct queue_job *jobs = calloc(QUEUE_JOBS, sizeof(*jobs));
+   struct util_queue_fence fence;
+
+   if (!util_queue_init(&queue, "bench", 64, num_threads, 0, NULL)) {
+      free(jobs);
+      return;
+   }
+   util_queue_fence_init(&fence);
+
+   int64_t begin = os_time_get_nano();
+
+   for (unsigned i = 0; i < QUEUE_JOBS; i++) {
+      jobs[i].submit_ns = os_time_get_nano();
+      util_queue_add_job(&queue, &jobs[i],
+                         i == QUEUE_JOBS - 1 ? &fence : NULL,
+                         queue_job_execute, NULL, 0);
+   }
+   util_queue_fence_wait(&fence);
+   util_queue_finish(&queue);
+
+   int64_t end = os_time_get_nano();
+
+   uint64_t latency_sum = 0;
+   for (unsigned i = 0; i < QUEUE_JOBS; i++)
+      latency_sum += jobs[i].start_ns - jobs[i].submit_ns;
+
+   report("u_queue_dispatch", num_threads, QUEUE_JOBS, end - begin,
+          latency_sum / QUEUE_JOBS);
+
+   util_queue_fence_destroy(&fence);
+   util_queue_destroy(&queue);
+   free(jobs);
+}
+
+/* hash_table: single-threaded 90% lookup / 10% insert mix, the typical
+ * shader-variant and sampler-view cache access pattern.
+ */
+
+#define HASH_OPS  2000000
+#define HASH_KEYS 16384
+
+static void
+bench_hash_table(void)
+{
+   struct hash_table *ht =
+      _mesa_hash_table_create(NULL, _mesa_hash_pointer, _mesa_key_pointer_equal);
+   uint32_t rng = 1;
+
+   int64_t begin = os_time_get_nano();
+
+   for (unsigned i = 0; i < HASH_OPS; i++) {
+      void *key = (void *)(uintptr_t)(1 + (bench_rand(&rng) % HASH_KEYS));
+
+      if ((i % 10) == 0)
+         _mesa_hash_table_insert(ht, key, key);
+      else
+         _mesa_hash_table_search(ht, key);
+   }
+
+   int64_t end = os_time_get_nano();
+
+   report("hash_table_mixed", 1, HASH_OPS, end - begin, 0);
+
+   _mesa_hash_table_destroy(ht, NULL);
+}
+
+/* concurrent_hash_table: all threads hammer the same table with the same
+ * lookup-heavy mix, measuring scaling under contention.
+ */
+
+#define CHASH_OPS_PER_THREAD 500000
+
+static struct concurrent_hash_table chash;
+
+static int
+chash_thread(void *arg)
+{
+   uint32_t rng = 1 + (uint32_t)(uintptr_t)arg;
+
+   for (unsigned i = 0; i < CHASH_OPS_PER_THREAD; i++) {
+      void *key = (void *)(uintptr_t)(1 + (bench_rand(&rng) % HASH_KEYS));
+
+      if ((i % 10) == 0)
+         _mesa_concurrent_hash_table_insert(&chash, key, key);
+      else
+         _mesa_concurrent_hash_table_search(&chash, key);
+   }
+   return 0;
+}
+
+/* ralloc: per-thread context creation, small allocation churn and teardown,
+ * the NIR pass allocation pattern.  Contention here is on the underlying
+ * allocator, which is what parallel shader compiles stress.
+ */
+
+#define RALLOC_ROUNDS           2000
+#define RALLOC_ALLOCS_PER_ROUND 256
+
+static int
+ralloc_thread(void *arg)
+{
+   uint32_t rng = 1 + (uint32_t)(uintptr_t)arg;
+
+   for (unsigned round = 0; round < RALLOC_ROUNDS; round++) {
+      void *ctx = ralloc_context(NULL);
+
+      for (unsigned i = 0; i < RALLOC_ALLOCS_PER_ROUND; i++) {
+         unsigned size = 8 + (bench_rand(&rng) % 120);
+         void *p = ralloc_size(ctx, size);
+         memset(p, 0, size);
+      }
+      ralloc_free(ctx);
+   }
+   return 0;
+}
+
+/* u_dynarray: repeated growth from empty, the per-draw/per-batch list
+ * pattern (e.g. resource and fence lists).
+ */
+
+#define DYNARRAY_ROUNDS   5000
+#define DYNARRAY_ELEMENTS 4096
+
+static void
+bench_dynarray(void)
+{
+   int64_t begin = os_time_get_nano();
+
+   for (unsigned round = 0; round < DYNARRAY_ROUNDS; round++) {
+      struct util_dynarray buf;
+
+      util_dynarray_init(&buf, NULL);
+      for (unsigned i = 0; i < DYNARRAY_ELEMENTS; i++)
+         util_dynarray_append(&buf, uint32_t, i);
+      util_dynarray_fini(&buf);
+   }
+
+   int64_t end = os_time_get_nano();
+
+   report("u_dynarray_growth", 1,
+          (uint64_t)DYNARRAY_ROUNDS * DYNARRAY_ELEMENTS, end - begin, 0);
+}
+
+/* fossilize_db: the single-file shader cache backend.  Entry write
+ * throughput, index reload (the cost every process pays at startup to
+ * rebuild the hash table from the on-disk index) and entry read throughput,
+ * using blob sizes typical of compiled pipeline cache entries.
+ */
+
+#ifndef _WIN32
+
+#define FOZ_BENCH_ENTRIES   2048
+#define FOZ_BENCH_BLOB_SIZE 4096
+
+static void
+foz_bench_key(unsigned i, uint8_t key[20])
+{
+   memset(key, 0, 20);
+   memcpy(key, &i, sizeof(i));
+   key[19] = 0xf0;
+}
+
+static void
+bench_fossilize_db(void)
+{
+   char dir_template[] = "/tmp/mesa-foz-bench-XXXXXX";
+   char *dir = mkdtemp(dir_template);
+   struct foz_db db;
+
+   if (!dir)
+      return;
+
+   /* foz_prepare only opens the default read/write db in single file mode. */
+   setenv("MESA_DISK_CACHE_SINGLE_FILE", "true", 1);
+
+   memset(&db, 0, sizeof(db));
+   if (!foz_prepare(&db, dir))
+      goto cleanup;
+
+   uint8_t *blob = malloc(FOZ_BENCH_BLOB_SIZE);
+   uint32_t rng = 1;
+   for (unsigned i = 0; i < FOZ_BENCH_BLOB_SIZE; i++)
+      blob[i] = bench_rand(&rng);
+
+   int64_t begin = os_time_get_nano();
+   for (unsigned i = 0; i < FOZ_BENCH_ENTRIES; i++) {
+      uint8_t key[20];
+
+      foz_bench_key(i, key);
+      foz_write_entry(&db, key, blob, FOZ_BENCH_BLOB_SIZE);
+   }
+   int64_t end = os_time_get_nano();
+   report("foz_db_write", 1, FOZ_BENCH_ENTRIES, end - begin, 0);
+
+   /* Reopen the db so the index is parsed from disk again. */
+   foz_destroy(&db);
+   memset(&db, 0, sizeof(db));
+
+   begin = os_time_get_nano();
+   if (!foz_prepare(&db, dir)) {
+      free(blob);
+      goto cleanup;
+   }
+   end = os_time_get_nano();
+   report("foz_db_index_reload", 1, FOZ_BENCH_ENTRIES, end - begin, 0);
+
+   begin = os_time_get_nano();
+   for (unsigned i = 0; i < FOZ_BENCH_ENTRIES; i++) {
+      uint8_t key[20];
+      size_t size;
+
+      foz_bench_key(i, key);
+      free(foz_read_entry(&db, key, &size));
+   }
+   end = os_time_get_nano();
+   report("foz_db_read", 1, FOZ_BENCH_ENTRIES, end - begin, 0);
+
+   foz_destroy(&db);
+   free(blob);
+
+cleanup:
+   unsetenv("MESA_DISK_CACHE_SINGLE_FILE");
+
+   char path[1024];
+   snprintf(path, sizeof(path), "%s/foz_cache.foz", dir);
+   unlink(path);
+   snprintf(path, sizeof(path), "%s/foz_cache_idx.foz", dir);
+   unlink(path);
+   rmdir(dir);
+}
+
+#endif /* !_WIN32 */
+
+/* Runs "func" on num_threads threads and reports the wall time of the
+ * slowest one as the benchmark time.
+ */
+static void
+run_threaded(const char *name, thrd_start_t func, uint64_t total_iterations)
+{
+   thrd_t threads[MAX_THREADS];
+
+   int64_t begin = os_time_get_nano();
+
+   for (unsigned i = 0; i < num_threads; i++) {
+      if (thrd_create(&threads[i], func, (void *)(uintptr_t)i) != thrd_success) {
+         fprintf(stderr, "util_benchmark: thrd_create failed\n");
+         exit(1);
+      }
+   }
+   for (unsigned i = 0; i < num_threads; i++)
+      thrd_join(threads[i], NULL);
+
+   int64_t end = os_time_get_nano();
+
+   report(name, num_threads, total_iterations, end - begin, 0);
+}
+
+static void
+print_json(FILE *f)
+{
+   fprintf(f, "{\n  \"benchmarks\": [\n");
+   for (unsigned i = 0; i < num_results; i++) {
+      const struct bench_result *r = &results[i];
+      double ops_per_sec = r->time_ns ?
+         (double)r->iterations * 1e9 / (double)r->time_ns : 0;
+
+      fprintf(f,
+              "    {\"name\": \"%s\", \"threads\": %u, "
+              "\"iterations\": %" PRIu64 ", \"time_ns\": %" PRIu64 ", "
+              "\"ops_per_sec\": %.0f, \"mean_latency_ns\": %" PRIu64 "}%s\n",
+              r->name, r->threads, r->iterations, r->time_ns, ops_per_sec,
+              r->latency_ns, i + 1 < num_results ? "," : "");
+   }
+   fprintf(f, "  ]\n}\n");
+}
+
+int
+main(int argc, char **argv)
+{
+   const char *threads_env = getenv("UTIL_BENCH_THREADS");
+
+   num_threads = threads_env ? atoi(threads_env) : DEFAULT_THREADS;
+   num_threads = CLAMP(num_threads, 1, MAX_THREADS);
+
+   bench_util_queue();
+   bench_hash_table();
+
+   if (!_mesa_concurrent_hash_table_init(&chash, _mesa_hash_pointer,
+                                         _mesa_key_pointer_equal)) {
+      fprintf(stderr, "util_benchmark: concurrent hash table init failed\n");
+      return 1;
+   }
+   run_threaded("hash_table_concurrent", chash_thread,
+                (uint64_t)num_threads * CHASH_OPS_PER_THREAD);
+   _mesa_concurrent_hash_table_fini(&chash);
+
+   run_threaded("ralloc_churn", ralloc_thread,
+                (uint64_t)num_threads * RALLOC_ROUNDS * RALLOC_ALLOCS_PER_ROUND);
+
+   bench_dynarray();
+
+#ifndef _WIN32
+   bench_fossilize_db();
+#endif
+
+   if (argc > 1) {
+      FILE *f = fopen(argv[1], "w");
+      if (!f) {
+         fprintf(stderr, "util_benchmark: can't open %s\n", argv[1]);
+         return 1;
+      }
+      print_json(f);
+      fclose(f);
+   } else {
+      print_json(stdout);
+   }
+
+   return 0;
+}
@@ -22,6 +22,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <string.h>
 #include "util/dag.h"
 
 class dag_test : public ::testing::Test {
@@ -79,6 +80,9 @@ static void
 init_nodes(struct dag *dag, struct node *nodes, unsigned num_nodes)
 {
    for (unsigned i = 0; i < num_nodes; i++) {
+      /* Real users rzalloc their nodes; our stack arrays need the same. */
+      memset(static_cast<struct dag_node *>(&nodes[i]), 0,
+             sizeof(struct dag_node));
       dag_init_node(dag, static_cast<struct dag_node *>(&nodes[i]));
       nodes[i].val = i;
    }
@@ -281,3 +285,60 @@ TEST_F(dag_test, complex)
 
    TEST_CHECK();
 }
+
+TEST_F(dag_test, heap_critical_path)
+{
+   INIT_NODES(6);
+
+   /*     0   1
+    *    / \  |
+    *   2   3 |
+    *   |    \|
+    *   4     5
+    */
+   node[0] >> node[2] >> node[4];
+   node[0] >> node[3] >> node[5];
+   node[1] >> node[5];
+
+   dag_compute_critical_path(dag);
+
+   EXPECT_EQ(node[4].critical_path, 0);
+   EXPECT_EQ(node[5].critical_path, 0);
+   EXPECT_EQ(node[2].critical_path, 1);
+   EXPECT_EQ(node[3].critical_path, 1);
+   EXPECT_EQ(node[0].critical_path, 2);
+   EXPECT_EQ(node[1].critical_path, 1);
+
+   struct dag_heap heap;
+   dag_heap_init(&heap);
+   EXPECT_TRUE(dag_heap_is_empty(&heap));
+
+   /* Schedule by always popping the ready node with the longest critical
+    * path: node 0 (depth 2) must come out before node 1 (depth 1).
+    */
+   list_for_each_entry(struct dag_node, n, &dag->heads, link)
+      dag_heap_insert(&heap, n);
+
+   struct util_dynarray critical_paths;
+   util_dynarray_init(&critical_paths, mem_ctx);
+
+   unsigned num_scheduled = 0;
+   while (!dag_heap_is_empty(&heap)) {
+      struct dag_node *n = dag_heap_pop(&heap);
+      util_dynarray_append(&critical_paths, int, (int)n->critical_path);
+      dag_prune_head_prioritized(dag, n, &heap);
+      num_scheduled++;
+   }
+
+   EXPECT_EQ(num_scheduled, 6);
+
+   /* Within each ready set the priorities come out non-increasing, and a
+    * node's parents are always scheduled before it.
+    */
+   EXPECT_EQ(*util_dynarray_element(&critical_paths, int, 0), 2); /* node 0 */
+   for (unsigned i = 1; i < num_scheduled; i++) {
+      int prev = *util_dynarray_element(&critical_paths, int, i - 1);
+      int cur = *util_dynarray_element(&critical_paths, int, i);
+      EXPECT_LE(cur, prev);
+   }
+}
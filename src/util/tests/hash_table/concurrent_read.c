@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 Mesa3D contributors
+ * SPDX-License-Identifier: MIT
+ */
+
+#undef NDEBUG
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "c11/threads.h"
+#include "util/hash_table.h"
+#include "util/hash_table_concurrent.h"
+#include "util/u_atomic.h"
+
+#define SIZE 10000
+
+static struct concurrent_hash_table ht;
+static int num_inserted;
+
+static void *
+make_key(uint32_t i)
+{
+   return (void *)(uintptr_t)(1 + i);
+}
+
+static int
+insert_thread(void *arg)
+{
+   for (uint32_t i = 0; i < SIZE; i++) {
+      assert(_mesa_concurrent_hash_table_insert(&ht, make_key(i),
+                                                make_key(i + SIZE)));
+      p_atomic_set(&num_inserted, (int)(i + 1));
+   }
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   assert(_mesa_concurrent_hash_table_init(&ht, _mesa_hash_pointer,
+                                           _mesa_key_pointer_equal));
+
+   thrd_t thrd;
+   assert(thrd_create(&thrd, insert_thread, NULL) == thrd_success);
+
+   /* Read concurrently with the inserter.  Every key whose insert was
+    * visible before we started the lookup must be found with the right
+    * data; keys not yet inserted must simply miss.
+    */
+   int seen;
+   while ((seen = p_atomic_read(&num_inserted)) < SIZE) {
+      for (uint32_t i = 0; i < (uint32_t)seen; i++)
+         assert(_mesa_concurrent_hash_table_search(&ht, make_key(i)) ==
+                make_key(i + SIZE));
+   }
+
+   thrd_join(thrd, NULL);
+
+   for (uint32_t i = 0; i < SIZE; i++)
+      assert(_mesa_concurrent_hash_table_search(&ht, make_key(i)) ==
+             make_key(i + SIZE));
+
+   /* Tombstones must not break probe chains for readers. */
+   for (uint32_t i = 0; i < SIZE; i += 2)
+      assert(_mesa_concurrent_hash_table_remove(&ht, make_key(i)) ==
+             make_key(i + SIZE));
+
+   for (uint32_t i = 0; i < SIZE; i++) {
+      void *expected = (i & 1) ? make_key(i + SIZE) : NULL;
+      assert(_mesa_concurrent_hash_table_search(&ht, make_key(i)) == expected);
+   }
+
+   _mesa_concurrent_hash_table_fini(&ht);
+
+   return 0;
+}
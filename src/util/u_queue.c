@@ -28,6 +28,7 @@
 
 #include "c11/threads.h"
 #include "util/u_cpu_detect.h"
+#include "util/u_debug.h"
 #include "util/os_time.h"
 #include "util/u_string.h"
 #include "util/u_thread.h"
@@ -43,6 +44,26 @@
 /* Define 256MB */
 #define S_256MB (256 * 1024 * 1024)
 
+/* Process-global number of live worker threads across all queues. Mesa
+ * creates a separate queue per subsystem (disk cache, driver thread,
+ * compiler threads, ...), each sized for its own worst case, so the sum can
+ * oversubscribe small CPU parts. MESA_QUEUE_MAX_THREADS caps the total;
+ * once the cap is reached, queues stop growing on demand but keep the
+ * threads they already have, so every queue still makes forward progress.
+ */
+static int num_global_threads;
+
+DEBUG_GET_ONCE_NUM_OPTION(max_global_threads, "MESA_QUEUE_MAX_THREADS", 0)
+
+static bool
+util_queue_global_budget_available(void)
+{
+   int64_t max_threads = debug_get_option_max_global_threads();
+
+   return max_threads <= 0 ||
+          p_atomic_read(&num_global_threads) < max_threads;
+}
+
 static void
 util_queue_kill_threads(struct util_queue *queue, unsigned keep_num_threads,
                         bool locked);
@@ -359,6 +380,8 @@ util_queue_create_thread(struct util_queue *queue, unsigned index)
       pthread_setschedparam(queue->threads[index], SCHED_BATCH, &sched_param);
 #endif
    }
+
+   p_atomic_inc(&num_global_threads);
    return true;
 }
 
@@ -520,8 +543,10 @@ util_queue_kill_threads(struct util_queue *queue, unsigned keep_num_threads,
    if (keep_num_threads < old_num_threads) {
       /* We need to unlock the mutex to allow threads to terminate. */
       mtx_unlock(&queue->lock);
-      for (unsigned i = keep_num_threads; i < old_num_threads; i++)
+      for (unsigned i = keep_num_threads; i < old_num_threads; i++) {
          thrd_join(queue->threads[i], NULL);
+         p_atomic_dec(&num_global_threads);
+      }
       if (locked)
          mtx_lock(&queue->lock);
    } else {
@@ -585,7 +610,8 @@ util_queue_add_job_locked(struct util_queue *queue,
    if (queue->num_queued > 0 &&
        queue->create_threads_on_demand &&
        execute != util_queue_finish_execute &&
-       queue->num_threads < queue->max_threads) {
+       queue->num_threads < queue->max_threads &&
+       util_queue_global_budget_available()) {
       util_queue_adjust_num_threads(queue, queue->num_threads + 1, true);
    }
 
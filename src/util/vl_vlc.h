@@ -323,6 +323,29 @@ vl_vlc_search_byte(struct vl_vlc *vlc, unsigned num_bits, uint8_t value)
             return false;
       }
 
+      /* scan a word at a time using the usual zero-byte trick; fall through
+       * to the byte loop to pinpoint the match (and near the buffer or
+       * search-limit end)
+       */
+      while (vlc->end - vlc->data >= (int)sizeof(uint64_t) &&
+             (num_bits == ~0u || num_bits > 64)) {
+         uint64_t word;
+
+         memcpy(&word, vlc->data, sizeof(word));
+         word ^= value * UINT64_C(0x0101010101010101);
+         if ((word - UINT64_C(0x0101010101010101)) & ~word &
+             UINT64_C(0x8080808080808080))
+            break;
+
+         vlc->data += sizeof(uint64_t);
+         if (num_bits != ~0u)
+            num_bits -= 64;
+      }
+
+      /* the word scan may have consumed the rest of this input */
+      if (vlc->data == vlc->end)
+         continue;
+
       if (*vlc->data == value) {
          vl_vlc_align_data_ptr(vlc);
          vl_vlc_fillbits(vlc);
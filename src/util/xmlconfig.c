@@ -1203,6 +1203,14 @@ driParseConfigFiles(driOptionCache *cache, const driOptionCache *info,
 #if WITH_XMLCONFIG
    char *home, *configdir;
 
+   /* Expat-parsing the drirc files costs a few ms per process.  When that
+    * matters (build farms, embedded), build with -Dxmlconfig=disabled: the
+    * shipped defaults are then compiled in via driconf_static.h (generated
+    * by driconf_static.py) and this function does no file I/O at all.  A
+    * runtime binary cache of the parsed XML would just duplicate that
+    * mechanism with mtime-invalidation hazards, so we keep exactly the two
+    * modes: fully dynamic, or fully static.
+    */
    /* parse from either $DRIRC_CONFIGDIR or $datadir/drirc.d */
    if ((configdir = getenv("DRIRC_CONFIGDIR")))
       parseConfigDir(&userData, configdir);
@@ -24,9 +24,11 @@
 #include "vk_device.h"
 
 #include "vk_common_entrypoints.h"
+#include "vk_device_memory.h"
 #include "vk_instance.h"
 #include "vk_log.h"
 #include "vk_physical_device.h"
+#include "vk_pipeline_cache.h"
 #include "vk_queue.h"
 #include "vk_sync.h"
 #include "vk_sync_timeline.h"
@@ -151,6 +153,7 @@ vk_device_init(struct vk_device *device,
 
    device->drm_fd = -1;
    device->mem_cache = NULL;
+   device->cache_prewarm_queue = NULL;
 
    device->timeline_mode = get_timeline_mode(physical_device);
 
@@ -183,6 +186,11 @@ vk_device_init(struct vk_device *device,
 
    simple_mtx_init(&device->trace_mtx, mtx_plain);
 
+   if (debug_get_bool_option("MESA_VK_PIPELINE_PREWARM", false))
+      vk_pipeline_cache_prewarm_disk_cache(device);
+
+   vk_device_memory_stats_init(device);
+
    return VK_SUCCESS;
 }
 
@@ -192,6 +200,10 @@ vk_device_finish(struct vk_device *device)
    /* Drivers should tear down their own queues */
    assert(list_is_empty(&device->queues));
 
+   vk_pipeline_cache_finish_prewarm(device);
+
+   vk_device_memory_stats_finish(device);
+
    vk_memory_trace_finish(device);
 
 #if DETECT_OS_ANDROID
@@ -37,7 +37,9 @@
 extern "C" {
 #endif
 
+struct util_queue;
 struct vk_command_buffer_ops;
+struct vk_device_memory_stats;
 struct vk_device_shader_ops;
 struct vk_sync;
 
@@ -198,6 +200,19 @@ struct vk_device {
    /** Implicit pipeline cache, or NULL */
    struct vk_pipeline_cache *mem_cache;
 
+   /** Worker pool prewarming the disk cache, or NULL
+    *
+    * See vk_pipeline_cache_prewarm_disk_cache().
+    */
+   struct util_queue *cache_prewarm_queue;
+
+   /** Per-memory-type allocation statistics, or NULL
+    *
+    * Only allocated when MESA_VK_DEVICE_MEMORY_STATS is set.  See
+    * vk_device_memory_stats_init().
+    */
+   struct vk_device_memory_stats *mem_stats;
+
    /** An enum describing how timeline semaphores work */
    enum vk_device_timeline_mode {
       /** Timeline semaphores are not supported */
@@ -25,12 +25,102 @@
 
 #include "vk_android.h"
 #include "vk_common_entrypoints.h"
+#include "vk_device.h"
+#include "vk_log.h"
 #include "vk_util.h"
 
+#include "util/u_debug.h"
+
+#include <inttypes.h>
+
 #if DETECT_OS_ANDROID && ANDROID_API_LEVEL >= 26
 #include <vndk/hardware_buffer.h>
 #endif
 
+void
+vk_device_memory_stats_init(struct vk_device *device)
+{
+   device->mem_stats = NULL;
+
+   if (!debug_get_bool_option("MESA_VK_DEVICE_MEMORY_STATS", false))
+      return;
+
+   device->mem_stats = vk_zalloc(&device->alloc,
+                                 sizeof(*device->mem_stats), 8,
+                                 VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+   if (device->mem_stats == NULL)
+      return;
+
+   simple_mtx_init(&device->mem_stats->lock, mtx_plain);
+}
+
+void
+vk_device_memory_stats_finish(struct vk_device *device)
+{
+   struct vk_device_memory_stats *stats = device->mem_stats;
+
+   if (stats == NULL)
+      return;
+
+   for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; i++) {
+      if (stats->type[i].alloc_count == 0)
+         continue;
+
+      vk_logi(VK_LOG_OBJS(device),
+              "memory type %2u: %"PRIu64" allocations "
+              "(%"PRIu64" imported), %"PRIu64" MiB total, "
+              "%"PRIu64" MiB peak live, "
+              "%"PRIu64" allocations (%"PRIu64" MiB) leaked",
+              i,
+              stats->type[i].alloc_count,
+              stats->type[i].import_count,
+              stats->type[i].alloc_bytes / (1024 * 1024),
+              stats->type[i].peak_live_bytes / (1024 * 1024),
+              stats->type[i].live_count,
+              stats->type[i].live_bytes / (1024 * 1024));
+   }
+
+   simple_mtx_destroy(&stats->lock);
+   vk_free(&device->alloc, stats);
+   device->mem_stats = NULL;
+}
+
+static void
+vk_device_memory_stats_record(struct vk_device *device,
+                              const struct vk_device_memory *mem)
+{
+   struct vk_device_memory_stats *stats = device->mem_stats;
+   const uint32_t i = mem->memory_type_index;
+
+   assert(i < VK_MAX_MEMORY_TYPES);
+
+   simple_mtx_lock(&stats->lock);
+   stats->type[i].alloc_count++;
+   stats->type[i].alloc_bytes += mem->size;
+   if (mem->import_handle_type)
+      stats->type[i].import_count++;
+   stats->type[i].live_count++;
+   stats->type[i].live_bytes += mem->size;
+   stats->type[i].peak_live_bytes = MAX2(stats->type[i].peak_live_bytes,
+                                         stats->type[i].live_bytes);
+   simple_mtx_unlock(&stats->lock);
+}
+
+static void
+vk_device_memory_stats_unrecord(struct vk_device *device,
+                                const struct vk_device_memory *mem)
+{
+   struct vk_device_memory_stats *stats = device->mem_stats;
+   const uint32_t i = mem->memory_type_index;
+
+   simple_mtx_lock(&stats->lock);
+   assert(stats->type[i].live_count > 0);
+   assert(stats->type[i].live_bytes >= mem->size);
+   stats->type[i].live_count--;
+   stats->type[i].live_bytes -= mem->size;
+   simple_mtx_unlock(&stats->lock);
+}
+
 void *
 vk_device_memory_create(struct vk_device *device,
                         const VkMemoryAllocateInfo *pAllocateInfo,
@@ -137,6 +227,12 @@ vk_device_memory_create(struct vk_device *device,
       }
    }
 
+   /* Record before the AHardwareBuffer failure path below so that every
+    * create is balanced by the unrecord in vk_device_memory_destroy().
+    */
+   if (device->mem_stats)
+      vk_device_memory_stats_record(device, mem);
+
    /* From the Vulkan Specification 1.3.261:
     *
     *    VUID-VkMemoryAllocateInfo-allocationSize-07897
@@ -181,6 +277,8 @@ vk_device_memory_destroy(struct vk_device *device,
                          const VkAllocationCallbacks *alloc,
                          struct vk_device_memory *mem)
 {
+   if (device->mem_stats)
+      vk_device_memory_stats_unrecord(device, mem);
 
 #if DETECT_OS_ANDROID && ANDROID_API_LEVEL >= 26
    if (mem->ahardware_buffer)
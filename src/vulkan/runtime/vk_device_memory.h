@@ -25,6 +25,8 @@
 
 #include "vk_object.h"
 
+#include "util/simple_mtx.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -66,6 +68,40 @@ void vk_device_memory_destroy(struct vk_device *device,
                               const VkAllocationCallbacks *alloc,
                               struct vk_device_memory *mem);
 
+/** Per-memory-type allocation statistics
+ *
+ * Collected in vk_device_memory_create()/destroy() for every driver that
+ * goes through the common vkAllocateMemory path, so it sees exactly what the
+ * app requested, before any driver-side placement tricks.  Enabled by
+ * setting MESA_VK_DEVICE_MEMORY_STATS; a summary is logged when the device
+ * is destroyed.  Useful for showing app vendors which memory types their
+ * allocations actually land in.
+ */
+struct vk_device_memory_stats {
+   simple_mtx_t lock;
+
+   struct {
+      /** Total number of allocations of this type over the device lifetime */
+      uint64_t alloc_count;
+
+      /** Total bytes ever allocated from this type */
+      uint64_t alloc_bytes;
+
+      /** Allocations of this type which imported external memory */
+      uint64_t import_count;
+
+      /** Currently live allocations and bytes of this type */
+      uint64_t live_count;
+      uint64_t live_bytes;
+
+      /** High-water mark of live_bytes */
+      uint64_t peak_live_bytes;
+   } type[VK_MAX_MEMORY_TYPES];
+};
+
+void vk_device_memory_stats_init(struct vk_device *device);
+void vk_device_memory_stats_finish(struct vk_device *device);
+
 static inline uint64_t
 vk_device_memory_range(const struct vk_device_memory *mem,
                        uint64_t offset, uint64_t range)
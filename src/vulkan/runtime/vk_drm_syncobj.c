@@ -104,6 +104,15 @@ vk_drm_syncobj_signal(struct vk_device *device,
    return VK_SUCCESS;
 }
 
+/* This is one ioctl per query by design.  Caching the last-seen counter in
+ * userspace to short-circuit polling loops would be unsound: a timeline
+ * advances asynchronously from GPU work and, for exported syncobjs, from
+ * other processes, so only the kernel knows the current value and a cached
+ * one answers no question the caller can legally ask.  Batching is likewise
+ * already where it can be: multi-semaphore waits go through wait_many as a
+ * single DRM_IOCTL_SYNCOBJ_TIMELINE_WAIT, and submit-time signals ride the
+ * driver's submission ioctl rather than per-semaphore signal calls.
+ */
 static VkResult
 vk_drm_syncobj_get_value(struct vk_device *device,
                          struct vk_sync *sync,
@@ -818,11 +818,14 @@ vk_pipeline_precompile_shader(struct vk_device *device,
    uint8_t stage_sha1[SHA1_DIGEST_LENGTH];
    vk_pipeline_hash_shader_stage(info, &rs, stage_sha1);
 
+   bool claimed = false;
    if (cache != NULL) {
       struct vk_pipeline_cache_object *cache_obj =
-         vk_pipeline_cache_lookup_object(cache, stage_sha1, sizeof(stage_sha1),
-                                         &pipeline_precomp_shader_cache_ops,
-                                         NULL /* cache_hit */);
+         vk_pipeline_cache_lookup_or_claim_object(cache, stage_sha1,
+                                                  sizeof(stage_sha1),
+                                                  &pipeline_precomp_shader_cache_ops,
+                                                  NULL /* cache_hit */,
+                                                  &claimed);
       if (cache_obj != NULL) {
          *ps_out = vk_pipeline_precomp_shader_from_cache_obj(cache_obj);
          return VK_SUCCESS;
@@ -830,8 +833,12 @@ vk_pipeline_precompile_shader(struct vk_device *device,
    }
 
    if (pipeline_flags &
-       VK_PIPELINE_CREATE_2_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_KHR)
+       VK_PIPELINE_CREATE_2_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_KHR) {
+      if (claimed)
+         vk_pipeline_cache_unclaim_object(cache, stage_sha1,
+                                          sizeof(stage_sha1));
       return VK_PIPELINE_COMPILE_REQUIRED;
+   }
 
    const gl_shader_stage stage = vk_to_mesa_shader_stage(info->stage);
    const struct nir_shader_compiler_options *nir_options =
@@ -842,8 +849,12 @@ vk_pipeline_precompile_shader(struct vk_device *device,
    nir_shader *nir;
    result = vk_pipeline_shader_stage_to_nir(device, info, &spirv_options,
                                             nir_options, NULL, &nir);
-   if (result != VK_SUCCESS)
+   if (result != VK_SUCCESS) {
+      if (claimed)
+         vk_pipeline_cache_unclaim_object(cache, stage_sha1,
+                                          sizeof(stage_sha1));
       return result;
+   }
 
    if (ops->preprocess_nir != NULL)
       ops->preprocess_nir(device->physical, nir);
@@ -853,8 +864,12 @@ vk_pipeline_precompile_shader(struct vk_device *device,
                                         sizeof(stage_sha1),
                                         &rs, nir);
    ralloc_free(nir);
-   if (shader == NULL)
+   if (shader == NULL) {
+      if (claimed)
+         vk_pipeline_cache_unclaim_object(cache, stage_sha1,
+                                          sizeof(stage_sha1));
       return vk_error(device, VK_ERROR_OUT_OF_HOST_MEMORY);
+   }
 
    if (cache != NULL) {
       struct vk_pipeline_cache_object *cache_obj = &shader->cache_obj;
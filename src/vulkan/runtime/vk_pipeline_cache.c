@@ -32,10 +32,12 @@
 #include "compiler/nir/nir_serialize.h"
 
 #include "util/blob.h"
+#include "util/u_cpu_detect.h"
 #include "util/u_debug.h"
 #include "util/disk_cache.h"
 #include "util/hash_table.h"
 #include "util/set.h"
+#include "util/u_queue.h"
 
 #define vk_pipeline_cache_log(cache, ...)                                      \
    if (cache->base.client_visible)                                             \
@@ -278,6 +280,68 @@ vk_pipeline_cache_object_deserialize(struct vk_pipeline_cache *cache,
    return object;
 }
 
+/* A claim on a cache key whose object is currently being compiled.
+ *
+ * Waiters take a reference under cache->lock and wait on the fence outside
+ * of it; whoever finishes (or abandons) the compile removes the claim from
+ * cache->in_flight, signals the fence and drops the creation reference.
+ */
+struct vk_pipeline_cache_claim {
+   const void *key_data; /* points at the storage trailing this struct */
+   uint32_t key_size;
+   uint32_t ref_cnt;
+   struct util_queue_fence fence;
+};
+
+static uint32_t
+claim_key_hash(const void *void_claim)
+{
+   const struct vk_pipeline_cache_claim *claim = void_claim;
+   return _mesa_hash_data(claim->key_data, claim->key_size);
+}
+
+static bool
+claim_keys_equal(const void *void_a, const void *void_b)
+{
+   const struct vk_pipeline_cache_claim *a = void_a, *b = void_b;
+   return a->key_size == b->key_size &&
+          memcmp(a->key_data, b->key_data, a->key_size) == 0;
+}
+
+static void
+vk_pipeline_cache_claim_unref(struct vk_pipeline_cache_claim *claim)
+{
+   assert(p_atomic_read(&claim->ref_cnt) >= 1);
+   if (p_atomic_dec_zero(&claim->ref_cnt)) {
+      util_queue_fence_destroy(&claim->fence);
+      free(claim);
+   }
+}
+
+/* cache->lock must be held when calling.  Removes the claim (if any) for
+ * the given key from the in-flight set and returns it; the caller must
+ * signal and unref it after dropping the lock.
+ */
+static struct vk_pipeline_cache_claim *
+vk_pipeline_cache_pop_claim(struct vk_pipeline_cache *cache,
+                            const void *key_data, uint32_t key_size)
+{
+   if (cache->in_flight == NULL)
+      return NULL;
+
+   const struct vk_pipeline_cache_claim probe = {
+      .key_data = key_data,
+      .key_size = key_size,
+   };
+   struct set_entry *entry = _mesa_set_search(cache->in_flight, &probe);
+   if (entry == NULL)
+      return NULL;
+
+   struct vk_pipeline_cache_claim *claim = (void *)entry->key;
+   _mesa_set_remove(cache->in_flight, entry);
+   return claim;
+}
+
 static struct vk_pipeline_cache_object *
 vk_pipeline_cache_insert_object(struct vk_pipeline_cache *cache,
                                 struct vk_pipeline_cache_object *object)
@@ -315,14 +379,145 @@ vk_pipeline_cache_insert_object(struct vk_pipeline_cache *cache,
       else
          vk_pipeline_cache_object_weak_ref(cache, result);
    }
+
+   /* Now that the object is visible in the cache, wake up anybody waiting
+    * on an in-flight compile of the same key.
+    */
+   struct vk_pipeline_cache_claim *claim =
+      vk_pipeline_cache_pop_claim(cache, result->key_data, result->key_size);
+
    vk_pipeline_cache_unlock(cache);
 
+   if (claim != NULL) {
+      util_queue_fence_signal(&claim->fence);
+      vk_pipeline_cache_claim_unref(claim);
+   }
+
    if (found) {
       vk_pipeline_cache_object_unref(cache->base.device, object);
    }
    return result;
 }
 
+struct vk_pipeline_cache_object *
+vk_pipeline_cache_lookup_or_claim_object(struct vk_pipeline_cache *cache,
+                                         const void *key_data, size_t key_size,
+                                         const struct vk_pipeline_cache_object_ops *ops,
+                                         bool *cache_hit, bool *claimed)
+{
+   *claimed = false;
+
+   if (cache == NULL) {
+      if (cache_hit != NULL)
+         *cache_hit = false;
+      return NULL;
+   }
+
+   /* Without an object cache there is nothing to deduplicate against, and
+    * an externally-synchronized cache cannot be hit from two threads at
+    * once anyway.
+    */
+   if (cache->object_cache == NULL ||
+       (cache->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT)) {
+      return vk_pipeline_cache_lookup_object(cache, key_data, key_size,
+                                             ops, cache_hit);
+   }
+
+   assert(key_size <= UINT32_MAX);
+
+   for (;;) {
+      struct vk_pipeline_cache_object *object =
+         vk_pipeline_cache_lookup_object(cache, key_data, key_size,
+                                         ops, cache_hit);
+      if (object != NULL)
+         return object;
+
+      struct vk_pipeline_cache_object key = {
+         .key_data = key_data,
+         .key_size = key_size,
+      };
+      uint32_t hash = object_key_hash(&key);
+
+      vk_pipeline_cache_lock(cache);
+
+      /* Re-check under the lock: the object may have been inserted between
+       * the lookup above and here, in which case its claim is already gone.
+       */
+      if (_mesa_set_search_pre_hashed(cache->object_cache, hash, &key)) {
+         vk_pipeline_cache_unlock(cache);
+         continue;
+      }
+
+      const struct vk_pipeline_cache_claim probe = {
+         .key_data = key_data,
+         .key_size = key_size,
+      };
+      struct set_entry *entry = cache->in_flight != NULL ?
+         _mesa_set_search(cache->in_flight, &probe) : NULL;
+
+      if (entry == NULL) {
+         /* Nobody is compiling this key; claim it for the caller.  If
+          * allocation fails we simply return without registering a claim
+          * and the caller compiles without deduplication.
+          */
+         struct vk_pipeline_cache_claim *claim =
+            malloc(sizeof(*claim) + key_size);
+         if (claim != NULL) {
+            claim->key_data = claim + 1;
+            memcpy(claim + 1, key_data, key_size);
+            claim->key_size = key_size;
+            claim->ref_cnt = 1;
+            util_queue_fence_init(&claim->fence);
+            util_queue_fence_reset(&claim->fence);
+
+            if (cache->in_flight == NULL) {
+               cache->in_flight = _mesa_set_create(NULL, claim_key_hash,
+                                                   claim_keys_equal);
+            }
+            if (cache->in_flight != NULL)
+               _mesa_set_add(cache->in_flight, claim);
+            else
+               vk_pipeline_cache_claim_unref(claim);
+         }
+         vk_pipeline_cache_unlock(cache);
+
+         *claimed = true;
+         return NULL;
+      }
+
+      struct vk_pipeline_cache_claim *claim = (void *)entry->key;
+      p_atomic_inc(&claim->ref_cnt);
+      vk_pipeline_cache_unlock(cache);
+
+      /* Wait for the owning thread to finish, then retry the lookup.  If
+       * the owner gave the claim up, the next iteration takes it over.
+       */
+      util_queue_fence_wait(&claim->fence);
+      vk_pipeline_cache_claim_unref(claim);
+   }
+}
+
+void
+vk_pipeline_cache_unclaim_object(struct vk_pipeline_cache *cache,
+                                 const void *key_data, size_t key_size)
+{
+   if (cache == NULL || cache->object_cache == NULL ||
+       (cache->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT))
+      return;
+
+   assert(key_size <= UINT32_MAX);
+
+   vk_pipeline_cache_lock(cache);
+   struct vk_pipeline_cache_claim *claim =
+      vk_pipeline_cache_pop_claim(cache, key_data, key_size);
+   vk_pipeline_cache_unlock(cache);
+
+   if (claim != NULL) {
+      util_queue_fence_signal(&claim->fence);
+      vk_pipeline_cache_claim_unref(claim);
+   }
+}
+
 struct vk_pipeline_cache_object *
 vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
                                 const void *key_data, size_t key_size,
@@ -667,6 +862,11 @@ vk_pipeline_cache_destroy(struct vk_pipeline_cache *cache,
       }
       _mesa_set_destroy(cache->object_cache, NULL);
    }
+   if (cache->in_flight) {
+      /* All claims must be resolved before the cache goes away */
+      assert(cache->in_flight->entries == 0);
+      _mesa_set_destroy(cache->in_flight, NULL);
+   }
    simple_mtx_destroy(&cache->lock);
    vk_object_free(cache->base.device, pAllocator, cache);
 }
@@ -850,3 +1050,122 @@ vk_common_MergePipelineCaches(VkDevice _device,
 
    return VK_SUCCESS;
 }
+
+/*
+ * Disk cache prewarming.
+ */
+
+struct vk_cache_prewarm_job {
+   struct disk_cache *disk_cache;
+   uint32_t num_keys;
+   cache_key keys[];
+};
+
+static void
+vk_cache_prewarm_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct vk_cache_prewarm_job *job = data;
+
+   for (uint32_t i = 0; i < job->num_keys; i++) {
+      /* The payload is discarded; the read is what pulls the entry through
+       * the page cache, CRC check and any in-memory cache tier so that real
+       * lookups start out warm.
+       */
+      size_t size;
+      free(disk_cache_get(job->disk_cache, job->keys[i], &size));
+   }
+}
+
+static void
+vk_cache_prewarm_job_cleanup(void *data, void *gdata, int thread_index)
+{
+   free(data);
+}
+
+struct vk_cache_prewarm_key_list {
+   cache_key *keys;
+   uint32_t count;
+   uint32_t capacity;
+};
+
+static void
+vk_cache_prewarm_collect_key(const cache_key key, void *data)
+{
+   struct vk_cache_prewarm_key_list *list = data;
+
+   if (list->count == list->capacity) {
+      uint32_t new_capacity = MAX2(list->capacity * 2, 1024);
+      cache_key *keys = realloc(list->keys, new_capacity * sizeof(*keys));
+      if (keys == NULL)
+         return;
+      list->keys = keys;
+      list->capacity = new_capacity;
+   }
+
+   memcpy(list->keys[list->count++], key, sizeof(cache_key));
+}
+
+void
+vk_pipeline_cache_prewarm_disk_cache(struct vk_device *device)
+{
+   struct disk_cache *disk_cache = device->physical->disk_cache;
+
+   assert(device->cache_prewarm_queue == NULL);
+   if (disk_cache == NULL)
+      return;
+
+   /* Collect the keys up front: the index lock is held during the iteration
+    * so the reads themselves have to happen afterwards.
+    */
+   struct vk_cache_prewarm_key_list list = { NULL, 0, 0 };
+   disk_cache_foreach_key(disk_cache, vk_cache_prewarm_collect_key, &list);
+   if (list.count == 0) {
+      free(list.keys);
+      return;
+   }
+
+   const unsigned num_threads = MAX2(util_get_cpu_caps()->nr_cpus, 1);
+   struct util_queue *queue = malloc(sizeof(*queue));
+   if (queue == NULL ||
+       !util_queue_init(queue, "vkprewarm", num_threads, num_threads,
+                        UTIL_QUEUE_INIT_USE_MINIMUM_PRIORITY, NULL)) {
+      free(queue);
+      free(list.keys);
+      return;
+   }
+
+   /* Split the index across the workers in contiguous chunks.  Each job owns
+    * a copy of its slice, and there are never more jobs than ring slots, so
+    * queueing them up cannot block device creation.
+    */
+   const uint32_t keys_per_job = DIV_ROUND_UP(list.count, num_threads);
+   for (uint32_t first = 0; first < list.count; first += keys_per_job) {
+      const uint32_t count = MIN2(keys_per_job, list.count - first);
+      struct vk_cache_prewarm_job *job =
+         malloc(sizeof(*job) + count * sizeof(cache_key));
+      if (job == NULL)
+         break;
+
+      job->disk_cache = disk_cache;
+      job->num_keys = count;
+      memcpy(job->keys, &list.keys[first], count * sizeof(cache_key));
+
+      util_queue_add_job(queue, job, NULL,
+                         vk_cache_prewarm_job_execute,
+                         vk_cache_prewarm_job_cleanup, 0);
+   }
+
+   free(list.keys);
+   device->cache_prewarm_queue = queue;
+}
+
+void
+vk_pipeline_cache_finish_prewarm(struct vk_device *device)
+{
+   if (device->cache_prewarm_queue == NULL)
+      return;
+
+   util_queue_destroy(device->cache_prewarm_queue);
+   free(device->cache_prewarm_queue);
+   device->cache_prewarm_queue = NULL;
+}
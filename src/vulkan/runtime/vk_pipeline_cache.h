@@ -158,10 +158,17 @@ struct vk_pipeline_cache {
 
    struct vk_pipeline_cache_header header;
 
-   /** Protects object_cache */
+   /** Protects object_cache and in_flight */
    simple_mtx_t lock;
 
    struct set *object_cache;
+
+   /** Keys whose objects are currently being compiled
+    *
+    * Used by vk_pipeline_cache_lookup_or_claim_object() so that two threads
+    * racing to create the same object only do the work once.
+    */
+   struct set *in_flight;
 };
 
 VK_DEFINE_NONDISP_HANDLE_CASTS(vk_pipeline_cache, base, VkPipelineCache,
@@ -234,6 +241,35 @@ vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
                                 const struct vk_pipeline_cache_object_ops *ops,
                                 bool *cache_hit);
 
+/** Looks up an object in the cache, claiming the compile on a miss
+ *
+ * This behaves like vk_pipeline_cache_lookup_object() except that, on a
+ * miss, the key is either claimed for the calling thread or, if another
+ * thread has already claimed it, the call blocks until that thread's
+ * compile finishes and returns its object.  This deduplicates the work when
+ * several application threads create the same pipeline concurrently.
+ *
+ * If NULL is returned and *claimed is true, the caller owns the compile for
+ * this key and must either add the resulting object with
+ * vk_pipeline_cache_add_object(), which releases the claim, or give the
+ * claim up with vk_pipeline_cache_unclaim_object() on failure.  Waiting
+ * threads hang until one of the two happens.
+ */
+struct vk_pipeline_cache_object * MUST_CHECK
+vk_pipeline_cache_lookup_or_claim_object(struct vk_pipeline_cache *cache,
+                                         const void *key_data, size_t key_size,
+                                         const struct vk_pipeline_cache_object_ops *ops,
+                                         bool *cache_hit, bool *claimed);
+
+/** Gives up a claim taken by vk_pipeline_cache_lookup_or_claim_object()
+ *
+ * Must be called if the compile for a claimed key fails, so that waiting
+ * threads wake up and compete for the claim again.
+ */
+void
+vk_pipeline_cache_unclaim_object(struct vk_pipeline_cache *cache,
+                                 const void *key_data, size_t key_size);
+
 /** Adds an object to the pipeline cache
  *
  * This function adds the given object to the pipeline cache.  We do not
@@ -307,6 +343,21 @@ vk_raw_data_cache_object_create(struct vk_device *device,
 
 extern const struct vk_pipeline_cache_object_ops vk_raw_data_cache_object_ops;
 
+/** Eagerly read every entry of the physical device's on-disk shader cache.
+ *
+ * Called from vk_device_init() when MESA_VK_PIPELINE_PREWARM is set.  Walks
+ * the disk cache index (only single-file/fossilize caches keep one) and
+ * pulls every entry through disk_cache_get() on a worker pool sized by core
+ * count, so the first real pipeline-cache lookups are served from warm
+ * caches instead of cold disk reads.
+ */
+void
+vk_pipeline_cache_prewarm_disk_cache(struct vk_device *device);
+
+/** Tear down the prewarm worker pool, waiting for outstanding reads. */
+void
+vk_pipeline_cache_finish_prewarm(struct vk_device *device);
+
 #ifdef __cplusplus
 }
 #endif
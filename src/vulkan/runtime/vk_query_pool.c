@@ -28,6 +28,15 @@
 #include "vk_common_entrypoints.h"
 #include "vk_device.h"
 
+/* The common query pool deliberately only carries metadata; result storage
+ * stays driver-owned.  The drivers this was proposed for (radv, anv) already
+ * implement the "host-visible results" scheme end to end: the GPU writes
+ * results and availability into a host-coherent mapped BO, and
+ * vkGetQueryPoolResults without WAIT is a plain userspace read of that
+ * mapping -- no syscall per poll.  Hoisting the storage here would force one
+ * layout onto hardware that writes results in very different shapes
+ * (per-pass perf counters, paired begin/end slots, accumulating statistics).
+ */
 void
 vk_query_pool_init(struct vk_device *device,
                    struct vk_query_pool *query_pool,
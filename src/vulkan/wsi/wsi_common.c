@@ -27,6 +27,8 @@
 #include "util/macros.h"
 #include "util/os_file.h"
 #include "util/os_time.h"
+#include "util/timespec.h"
+#include "util/u_thread.h"
 #include "util/xmlconfig.h"
 #include "vk_device.h"
 #include "vk_fence.h"
@@ -39,6 +41,7 @@
 #include "vk_sync_dummy.h"
 #include "vk_util.h"
 
+#include <errno.h>
 #include <time.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -254,6 +257,9 @@ wsi_device_init(struct wsi_device *wsi,
    wsi->force_headless_swapchain =
       debug_get_bool_option("MESA_VK_WSI_HEADLESS_SWAPCHAIN", false);
 
+   wsi->speculative_acquire =
+      debug_get_bool_option("MESA_VK_WSI_SPECULATIVE_ACQUIRE", false);
+
    if (dri_options) {
       if (driCheckOption(dri_options, "adaptive_sync", DRI_BOOL))
          wsi->enable_adaptive_sync = driQueryOptionb(dri_options,
@@ -421,6 +427,185 @@ fail_attr_set:
 fail_attr_init:
    return ret;
 }
+
+/* How long a single speculative acquire attempt may block in the platform
+ * code before the worker re-checks whether the swapchain is being destroyed.
+ */
+#define WSI_PREFETCH_SLICE_NS (50ull * 1000 * 1000)
+
+static void *
+wsi_prefetch_thread(void *data)
+{
+   struct wsi_swapchain *chain = data;
+
+   u_thread_setname("WSI acquire prefetch");
+
+   pthread_mutex_lock(&chain->prefetch.mutex);
+   while (!chain->prefetch.exiting) {
+      if (chain->prefetch.state != WSI_PREFETCH_PENDING) {
+         pthread_cond_wait(&chain->prefetch.cond, &chain->prefetch.mutex);
+         continue;
+      }
+
+      pthread_mutex_unlock(&chain->prefetch.mutex);
+
+      const VkAcquireNextImageInfoKHR info = {
+         .sType = VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR,
+         .swapchain = wsi_swapchain_to_handle(chain),
+         .timeout = WSI_PREFETCH_SLICE_NS,
+         .deviceMask = 0,
+      };
+      uint32_t image_index;
+      VkResult result = chain->acquire_next_image(chain, &info, &image_index);
+
+      pthread_mutex_lock(&chain->prefetch.mutex);
+
+      /* An expired slice is retried; the exit check at the top of the loop
+       * keeps swapchain destruction from waiting more than one slice.
+       */
+      if (result == VK_TIMEOUT || result == VK_NOT_READY)
+         continue;
+
+      chain->prefetch.result = result;
+      chain->prefetch.image_index = image_index;
+      chain->prefetch.state = WSI_PREFETCH_READY;
+      pthread_cond_broadcast(&chain->prefetch.cond);
+   }
+   pthread_mutex_unlock(&chain->prefetch.mutex);
+
+   return NULL;
+}
+
+/* Called after a present to start acquiring the next image in the
+ * background.  The worker thread is created on the first kick so that
+ * swapchains of applications which never present (or with the feature
+ * disabled) don't pay for it.
+ */
+static void
+wsi_prefetch_kick(struct wsi_swapchain *chain)
+{
+   if (!chain->prefetch.enabled)
+      return;
+
+   pthread_mutex_lock(&chain->prefetch.mutex);
+
+   if (!chain->prefetch.thread_started) {
+      if (pthread_create(&chain->prefetch.thread, NULL,
+                         wsi_prefetch_thread, chain) == 0) {
+         chain->prefetch.thread_started = true;
+      } else {
+         chain->prefetch.enabled = false;
+         pthread_mutex_unlock(&chain->prefetch.mutex);
+         return;
+      }
+   }
+
+   if (chain->prefetch.state == WSI_PREFETCH_IDLE) {
+      chain->prefetch.state = WSI_PREFETCH_PENDING;
+      pthread_cond_broadcast(&chain->prefetch.cond);
+   }
+
+   pthread_mutex_unlock(&chain->prefetch.mutex);
+}
+
+/* If a speculative acquire is parked or in flight, consume it instead of
+ * calling into the platform code.  Returns true if the acquire was handled,
+ * with the outcome in *result (and *image_index on success).
+ */
+static bool
+wsi_prefetch_consume(struct wsi_swapchain *chain, uint64_t timeout,
+                     uint32_t *image_index, VkResult *result)
+{
+   if (!chain->prefetch.enabled)
+      return false;
+
+   pthread_mutex_lock(&chain->prefetch.mutex);
+
+   if (chain->prefetch.state == WSI_PREFETCH_PENDING && timeout != 0) {
+      struct timespec abs_timespec;
+      uint64_t abs_timeout = os_time_get_absolute_timeout(timeout);
+      timespec_from_nsec(&abs_timespec, abs_timeout);
+
+      while (chain->prefetch.state == WSI_PREFETCH_PENDING) {
+         int ret = pthread_cond_timedwait(&chain->prefetch.cond,
+                                          &chain->prefetch.mutex,
+                                          &abs_timespec);
+         if (ret == ETIMEDOUT)
+            break;
+      }
+   }
+
+   bool handled;
+   switch (chain->prefetch.state) {
+   case WSI_PREFETCH_READY:
+      *image_index = chain->prefetch.image_index;
+      *result = chain->prefetch.result;
+      chain->prefetch.state = WSI_PREFETCH_IDLE;
+      handled = true;
+      break;
+   case WSI_PREFETCH_PENDING:
+      /* The worker owns the platform acquire path while a speculative
+       * acquire is in flight, so the application's timeout expires here
+       * instead of in the platform code.
+       */
+      *result = timeout != 0 ? VK_TIMEOUT : VK_NOT_READY;
+      handled = true;
+      break;
+   default:
+      handled = false;
+      break;
+   }
+
+   pthread_mutex_unlock(&chain->prefetch.mutex);
+
+   return handled;
+}
+
+/* Join the prefetch worker.  This must happen before any platform state the
+ * worker's acquire_next_image call touches (event queues, images, special
+ * event registrations) is torn down, i.e. before the platform destroy
+ * functions run, so the common destroy paths call this ahead of
+ * chain->destroy().  Idempotent; wsi_prefetch_finish() calls it again
+ * harmlessly before releasing the mutex and cond.
+ */
+static void
+wsi_prefetch_stop(struct wsi_swapchain *chain)
+{
+   if (!chain->prefetch.initialized)
+      return;
+
+   pthread_mutex_lock(&chain->prefetch.mutex);
+   chain->prefetch.exiting = true;
+   chain->prefetch.enabled = false;
+   pthread_cond_broadcast(&chain->prefetch.cond);
+   bool join = chain->prefetch.thread_started;
+   chain->prefetch.thread_started = false;
+   pthread_mutex_unlock(&chain->prefetch.mutex);
+
+   /* An image the worker acquired but nobody consumed is simply dropped;
+    * the swapchain is going away along with all of its images.
+    */
+   if (join)
+      pthread_join(chain->prefetch.thread, NULL);
+}
+
+static void
+wsi_prefetch_finish(struct wsi_swapchain *chain)
+{
+   if (!chain->prefetch.initialized)
+      return;
+
+   wsi_prefetch_stop(chain);
+
+   pthread_cond_destroy(&chain->prefetch.cond);
+   pthread_mutex_destroy(&chain->prefetch.mutex);
+   chain->prefetch.initialized = false;
+}
+#else
+static void
+wsi_prefetch_stop(struct wsi_swapchain *chain)
+{
+}
 #endif
 
 VkResult
@@ -447,6 +632,18 @@ wsi_swapchain_init(const struct wsi_device *wsi,
    if (chain->blit.type != WSI_SWAPCHAIN_NO_BLIT && wsi->get_blit_queue)
       chain->blit.queue = wsi->get_blit_queue(_device);
 
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+   if (wsi->speculative_acquire &&
+       pthread_mutex_init(&chain->prefetch.mutex, NULL) == 0) {
+      if (wsi_init_pthread_cond_monotonic(&chain->prefetch.cond)) {
+         chain->prefetch.initialized = true;
+         chain->prefetch.enabled = true;
+      } else {
+         pthread_mutex_destroy(&chain->prefetch.mutex);
+      }
+   }
+#endif
+
    int cmd_pools_count = chain->blit.queue != VK_NULL_HANDLE ? 1 : wsi->queue_family_count;
 
    chain->cmd_pools =
@@ -549,6 +746,10 @@ wsi_swapchain_get_present_mode(struct wsi_device *wsi,
 void
 wsi_swapchain_finish(struct wsi_swapchain *chain)
 {
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+   wsi_prefetch_finish(chain);
+#endif
+
    wsi_destroy_image_info(chain, &chain->image_info);
 
    if (chain->fences) {
@@ -1013,6 +1214,7 @@ wsi_CreateSwapchainKHR(VkDevice _device,
                                  sizeof (*swapchain->fences),
                                  VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
    if (!swapchain->fences) {
+      wsi_prefetch_stop(swapchain);
       swapchain->destroy(swapchain, alloc);
       return VK_ERROR_OUT_OF_HOST_MEMORY;
    }
@@ -1032,6 +1234,7 @@ wsi_CreateSwapchainKHR(VkDevice _device,
       /* We assume here that a driver exposing present_wait also exposes VK_KHR_timeline_semaphore. */
       result = wsi_device->CreateSemaphore(_device, &sem_info, alloc, &swapchain->present_id_timeline);
       if (result != VK_SUCCESS) {
+         wsi_prefetch_stop(swapchain);
          swapchain->destroy(swapchain, alloc);
          return VK_ERROR_OUT_OF_HOST_MEMORY;
       }
@@ -1044,6 +1247,7 @@ wsi_CreateSwapchainKHR(VkDevice _device,
                                          VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
       if (!swapchain->blit.semaphores) {
          wsi_device->DestroySemaphore(_device, swapchain->present_id_timeline, alloc);
+         wsi_prefetch_stop(swapchain);
          swapchain->destroy(swapchain, alloc);
          return VK_ERROR_OUT_OF_HOST_MEMORY;
       }
@@ -1072,6 +1276,10 @@ wsi_DestroySwapchainKHR(VkDevice _device,
    else
      alloc = &device->alloc;
 
+   /* Stop the prefetch worker before the platform tears down the event
+    * queues and images a speculative acquire may still be touching.
+    */
+   wsi_prefetch_stop(swapchain);
    swapchain->destroy(swapchain, alloc);
 }
 
@@ -1249,8 +1457,16 @@ wsi_common_acquire_next_image2(const struct wsi_device *wsi,
    VK_FROM_HANDLE(wsi_swapchain, swapchain, pAcquireInfo->swapchain);
    VK_FROM_HANDLE(vk_device, device, _device);
 
-   VkResult result = swapchain->acquire_next_image(swapchain, pAcquireInfo,
-                                                   pImageIndex);
+   VkResult result;
+   bool prefetched = false;
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+   prefetched = wsi_prefetch_consume(swapchain, pAcquireInfo->timeout,
+                                     pImageIndex, &result);
+#endif
+   if (!prefetched) {
+      result = swapchain->acquire_next_image(swapchain, pAcquireInfo,
+                                             pImageIndex);
+   }
    if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
       return result;
    struct wsi_image *image =
@@ -1350,6 +1566,17 @@ handle_trace(VkQueue queue, struct vk_device *device, uint32_t current_frame)
    return result;
 }
 
+/* Frame pacing policy intentionally does not live in WSI.  This layer's job
+ * is to provide the primitives pacing needs -- presentation timestamps from
+ * the compositor (wp_presentation on Wayland, present events on X11),
+ * VK_KHR_present_wait to block until a given present is on screen, and
+ * FIFO/MAILBOX semantics -- and to forward presents as fast as the target
+ * allows.  Scheduling *when* to submit relative to a deadline is a policy
+ * choice (latency vs. throughput vs. power) that only the application or
+ * compositor can make; a built-in scheduler here would fight both the
+ * compositor's own repaint scheduling and engines that already pace
+ * themselves on the feedback above.
+ */
 VkResult
 wsi_common_queue_present(const struct wsi_device *wsi,
                          VkDevice device,
@@ -1575,6 +1802,10 @@ wsi_common_queue_present(const struct wsi_device *wsi,
          wsi->set_memory_ownership(swapchain->device, mem, false);
       }
 
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+      wsi_prefetch_kick(swapchain);
+#endif
+
    fail_present:
       if (pPresentInfo->pResults != NULL)
          pPresentInfo->pResults[i] = result;
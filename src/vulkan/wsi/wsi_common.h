@@ -138,6 +138,10 @@ struct wsi_device {
    /* Create headless swapchains. */
    bool force_headless_swapchain;
 
+   /* Pre-acquire the next swapchain image on a worker thread after each
+    * present so vkAcquireNextImageKHR usually returns without blocking. */
+   bool speculative_acquire;
+
    bool force_swapchain_to_currentExtent;
 
    struct {
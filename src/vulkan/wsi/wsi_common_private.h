@@ -28,6 +28,10 @@
 #include "vk_object.h"
 #include "vk_sync.h"
 
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+#include <pthread.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -136,6 +140,12 @@ enum wsi_swapchain_blit_type {
    WSI_SWAPCHAIN_IMAGE_BLIT,
 };
 
+enum wsi_prefetch_state {
+   WSI_PREFETCH_IDLE,
+   WSI_PREFETCH_PENDING,
+   WSI_PREFETCH_READY,
+};
+
 struct wsi_image {
    VkImage image;
    VkDeviceMemory memory;
@@ -200,6 +210,29 @@ struct wsi_swapchain {
 
    bool capture_key_pressed;
 
+#if defined(HAVE_PTHREAD) && !defined(_WIN32)
+   /* Speculative acquire of the next image, enabled with
+    * MESA_VK_WSI_SPECULATIVE_ACQUIRE=true.  After each present, a worker
+    * thread runs the platform acquire and parks the resulting image index
+    * here so the application's next vkAcquireNextImageKHR returns without
+    * waiting on the compositor.  Opt-in because the worker calls
+    * acquire_next_image concurrently with the application presenting other
+    * already-acquired images of the same swapchain.
+    */
+   struct {
+      bool enabled;
+      bool initialized;
+      bool thread_started;
+      bool exiting;
+      pthread_t thread;
+      pthread_mutex_t mutex;
+      pthread_cond_t cond;
+      enum wsi_prefetch_state state;
+      VkResult result;
+      uint32_t image_index;
+   } prefetch;
+#endif
+
    /* Command pools, one per queue family */
    VkCommandPool *cmd_pools;
 